@@ -0,0 +1,687 @@
+#ifdef HAVE_CONFIG_H
+# include "elementary_config.h"
+#endif
+#include <Elementary.h>
+
+/* Headless benchmarks for the widget hot paths.
+ *
+ * Every case builds its widgets outside of the measured region and times
+ * only the operation under test, including the main loop iterations and
+ * renders it needs to settle. Windows are rendered manually so the numbers
+ * do not depend on the idle enterer that normally drives ecore_evas, and
+ * the buffer engine is forced unless ELM_ENGINE says otherwise. Results are
+ * printed as JSON so two runs can be diffed. */
+
+#define BENCH_WIN_W 480
+#define BENCH_WIN_H 800
+#define BENCH_SETTLE_QUIET 3
+#define BENCH_SETTLE_MAX 100000
+
+typedef struct _Bench        Bench;
+typedef struct _Bench_Case   Bench_Case;
+typedef struct _Bench_Metric Bench_Metric;
+
+struct _Bench
+{
+   Evas_Object  *win;
+   Eina_List    *metrics;
+   unsigned int  items;
+   unsigned int  pages;
+   double        t0;
+   Eina_Bool     record : 1;
+};
+
+struct _Bench_Metric
+{
+   const char   *name;
+   unsigned int  n;
+   double       *samples;
+   unsigned int  count;
+   unsigned int  size;
+};
+
+struct _Bench_Case
+{
+   const char *name;
+   void      (*run)(Bench *b);
+};
+
+static const char *_bench_words[] = {
+   "apple", "banana", "cherry", "damson", "elderberry", "fig", "grape",
+   "huckleberry", "jackfruit", "kiwi", "lemon", "mango", "nectarine",
+   "orange", "papaya", "quince", "raspberry", "strawberry", "tangerine",
+   "watermelon"
+};
+
+#define BENCH_WORDS (sizeof(_bench_words) / sizeof(_bench_words[0]))
+
+static const char *
+_bench_word(unsigned int i)
+{
+   return _bench_words[i % BENCH_WORDS];
+}
+
+static Bench_Metric *
+_bench_metric_get(Bench *b, const char *name, unsigned int n)
+{
+   Bench_Metric *m;
+   Eina_List *l;
+
+   EINA_LIST_FOREACH(b->metrics, l, m)
+     if (!strcmp(m->name, name)) return m;
+
+   m = calloc(1, sizeof(Bench_Metric));
+   if (!m) return NULL;
+   m->name = name;
+   m->n = n;
+   b->metrics = eina_list_append(b->metrics, m);
+   return m;
+}
+
+static void
+_bench_start(Bench *b)
+{
+   b->t0 = ecore_time_get();
+}
+
+static void
+_bench_stop(Bench *b, const char *name, unsigned int n)
+{
+   double t = ecore_time_get() - b->t0;
+   Bench_Metric *m;
+
+   if (!b->record) return;
+
+   m = _bench_metric_get(b, name, n);
+   if (!m) return;
+   if (m->count == m->size)
+     {
+        double *tmp;
+        unsigned int size = m->size ? m->size * 2 : 8;
+
+        tmp = realloc(m->samples, size * sizeof(double));
+        if (!tmp) return;
+        m->samples = tmp;
+        m->size = size;
+     }
+   m->samples[m->count++] = t * 1000.0;
+}
+
+/* One frame: whatever the main loop has pending, then recalculate and
+ * render. Returns whether anything on the canvas changed. */
+static Eina_Bool
+_bench_frame(Bench *b)
+{
+   Evas *e = evas_object_evas_get(b->win);
+   Eina_List *updates;
+
+   ecore_main_loop_iterate();
+   evas_smart_objects_calculate(e);
+   updates = evas_render_updates(e);
+   if (!updates) return EINA_FALSE;
+   evas_render_updates_free(updates);
+   return EINA_TRUE;
+}
+
+/* Render without running the main loop, for operations that are expected
+ * to be complete once the smart objects are calculated. */
+static void
+_bench_render(Bench *b)
+{
+   Evas *e = evas_object_evas_get(b->win);
+   Eina_List *updates;
+
+   evas_smart_objects_calculate(e);
+   updates = evas_render_updates(e);
+   evas_render_updates_free(updates);
+}
+
+static void
+_bench_settle(Bench *b)
+{
+   unsigned int quiet = 0, i;
+
+   for (i = 0; (i < BENCH_SETTLE_MAX) && (quiet < BENCH_SETTLE_QUIET); i++)
+     {
+        if (_bench_frame(b)) quiet = 0;
+        else quiet++;
+     }
+}
+
+static Evas_Object *
+_bench_win_add(void)
+{
+   Evas_Object *win;
+
+   win = elm_win_util_standard_add("elm_bench", "elm_bench");
+   if (!win) return NULL;
+   elm_win_autodel_set(win, EINA_TRUE);
+   ecore_evas_manual_render_set
+     (ecore_evas_ecore_evas_get(evas_object_evas_get(win)), EINA_TRUE);
+   evas_object_resize(win, BENCH_WIN_W, BENCH_WIN_H);
+   evas_object_show(win);
+   return win;
+}
+
+static Evas_Object *
+_bench_content_add(Bench *b, Evas_Object *obj)
+{
+   evas_object_size_hint_weight_set(obj, EVAS_HINT_EXPAND, EVAS_HINT_EXPAND);
+   evas_object_size_hint_align_set(obj, EVAS_HINT_FILL, EVAS_HINT_FILL);
+   elm_win_resize_object_add(b->win, obj);
+   evas_object_show(obj);
+   return obj;
+}
+
+/* Scroll the scrollable one viewport at a time, top to bottom, for at most
+ * b->pages pages, rendering a frame for each page. */
+static unsigned int
+_bench_scroll_pages(Bench *b, Evas_Object *obj)
+{
+   Evas_Coord vw, vh, cw, ch, y;
+   unsigned int i;
+
+   elm_interface_scrollable_content_viewport_geometry_get
+     (obj, NULL, NULL, &vw, &vh);
+   elm_interface_scrollable_content_size_get(obj, &cw, &ch);
+   if (vh <= 0) return 0;
+
+   for (i = 0, y = vh; (i < b->pages) && (y < ch); i++, y += vh)
+     {
+        elm_interface_scrollable_content_region_show(obj, 0, y, vw, vh);
+        _bench_frame(b);
+     }
+
+   return i;
+}
+
+static char *
+_bench_gl_text_get(void *data, Evas_Object *obj EINA_UNUSED,
+                   const char *part EINA_UNUSED)
+{
+   char buf[64];
+
+   snprintf(buf, sizeof(buf), "%s %u",
+            _bench_word((uintptr_t)data), (unsigned int)(uintptr_t)data);
+   return strdup(buf);
+}
+
+static Eina_Bool
+_bench_gl_filter_get(void *data, Evas_Object *obj EINA_UNUSED, void *key)
+{
+   return !!strstr(_bench_word((uintptr_t)data), key);
+}
+
+static void
+_bench_filter_done_cb(void *data, Evas_Object *obj EINA_UNUSED,
+                      void *event_info EINA_UNUSED)
+{
+   Eina_Bool *done = data;
+
+   *done = EINA_TRUE;
+}
+
+static void
+_bench_genlist(Bench *b)
+{
+   Elm_Genlist_Item_Class *itc;
+   Evas_Object *gl;
+   Eina_Bool done = EINA_FALSE;
+   unsigned int i, pages;
+
+   itc = elm_genlist_item_class_new();
+   itc->item_style = "default";
+   itc->func.text_get = _bench_gl_text_get;
+   itc->func.filter_get = _bench_gl_filter_get;
+
+   gl = _bench_content_add(b, elm_genlist_add(b->win));
+   elm_genlist_homogeneous_set(gl, EINA_TRUE);
+   evas_object_smart_callback_add(gl, "filter,done",
+                                  _bench_filter_done_cb, &done);
+   _bench_settle(b);
+
+   _bench_start(b);
+   for (i = 0; i < b->items; i++)
+     elm_genlist_item_append(gl, itc, (void *)(uintptr_t)i, NULL,
+                             ELM_GENLIST_ITEM_NONE, NULL, NULL);
+   _bench_settle(b);
+   _bench_stop(b, "genlist.append", b->items);
+
+   _bench_start(b);
+   pages = _bench_scroll_pages(b, gl);
+   _bench_stop(b, "genlist.scroll", pages);
+
+   elm_interface_scrollable_content_region_show(gl, 0, 0, 1, 1);
+   _bench_settle(b);
+
+   _bench_start(b);
+   elm_genlist_filter_set(gl, "an");
+   for (i = 0; (i < BENCH_SETTLE_MAX) && (!done); i++)
+     _bench_frame(b);
+   _bench_settle(b);
+   _bench_stop(b, "genlist.filter", b->items);
+
+   _bench_start(b);
+   elm_genlist_clear(gl);
+   _bench_settle(b);
+   _bench_stop(b, "genlist.clear", b->items);
+
+   evas_object_del(gl);
+   elm_genlist_item_class_free(itc);
+}
+
+static void
+_bench_gengrid(Bench *b)
+{
+   Elm_Gengrid_Item_Class *gic;
+   Evas_Object *gg;
+   unsigned int i, pages;
+
+   gic = elm_gengrid_item_class_new();
+   gic->item_style = "default";
+   gic->func.text_get = _bench_gl_text_get;
+
+   gg = _bench_content_add(b, elm_gengrid_add(b->win));
+   elm_gengrid_item_size_set(gg, 96, 96);
+   _bench_settle(b);
+
+   _bench_start(b);
+   for (i = 0; i < b->items; i++)
+     elm_gengrid_item_append(gg, gic, (void *)(uintptr_t)i, NULL, NULL);
+   _bench_settle(b);
+   _bench_stop(b, "gengrid.append", b->items);
+
+   _bench_start(b);
+   pages = _bench_scroll_pages(b, gg);
+   _bench_stop(b, "gengrid.scroll", pages);
+
+   _bench_start(b);
+   elm_gengrid_clear(gg);
+   _bench_settle(b);
+   _bench_stop(b, "gengrid.clear", b->items);
+
+   evas_object_del(gg);
+   elm_gengrid_item_class_free(gic);
+}
+
+static void
+_bench_entry(Bench *b)
+{
+   Eina_Strbuf *buf;
+   Evas_Object *en;
+   unsigned int i;
+   char line[128];
+
+   buf = eina_strbuf_new();
+   for (i = 0; i < b->items; i++)
+     {
+        snprintf(line, sizeof(line),
+                 "<b>%u</b> %s %s %s<br/>", i, _bench_word(i),
+                 _bench_word(i + 7), _bench_word(i + 13));
+        eina_strbuf_append(buf, line);
+     }
+
+   en = _bench_content_add(b, elm_entry_add(b->win));
+   elm_entry_scrollable_set(en, EINA_TRUE);
+   _bench_settle(b);
+
+   _bench_start(b);
+   elm_object_text_set(en, eina_strbuf_string_get(buf));
+   _bench_settle(b);
+   _bench_stop(b, "entry.set", b->items);
+
+   elm_object_text_set(en, "");
+   _bench_settle(b);
+
+   _bench_start(b);
+   for (i = 0; i < b->pages; i++)
+     {
+        snprintf(line, sizeof(line), "%s %s<br/>",
+                 _bench_word(i), _bench_word(i + 3));
+        elm_entry_entry_append(en, line);
+        _bench_frame(b);
+     }
+   _bench_settle(b);
+   _bench_stop(b, "entry.append", b->pages);
+
+   evas_object_del(en);
+   eina_strbuf_free(buf);
+}
+
+static void
+_bench_theme(Bench *b)
+{
+   Evas_Object *sc, *bx, *bt;
+   unsigned int i, n = 1000;
+   char label[32];
+
+   sc = _bench_content_add(b, elm_scroller_add(b->win));
+   bx = elm_box_add(sc);
+   evas_object_size_hint_weight_set(bx, EVAS_HINT_EXPAND, 0.0);
+   elm_object_content_set(sc, bx);
+
+   for (i = 0; i < n; i++)
+     {
+        bt = elm_button_add(bx);
+        snprintf(label, sizeof(label), "%s %u", _bench_word(i), i);
+        elm_object_text_set(bt, label);
+        elm_box_pack_end(bx, bt);
+        evas_object_show(bt);
+     }
+   _bench_settle(b);
+
+   _bench_start(b);
+   elm_theme_flush(NULL);
+   _bench_settle(b);
+   _bench_stop(b, "theme.apply", n);
+
+   evas_object_del(sc);
+}
+
+static void
+_bench_win(Bench *b)
+{
+   Evas_Object *win;
+   unsigned int i, n = 20;
+
+   _bench_start(b);
+   for (i = 0; i < n; i++)
+     {
+        Bench wb = *b;
+
+        win = _bench_win_add();
+        if (!win) continue;
+        wb.win = win;
+        _bench_settle(&wb);
+        evas_object_del(win);
+     }
+   _bench_stop(b, "win.create", n);
+}
+
+static void
+_bench_map(Bench *b)
+{
+   Evas_Object *map;
+   unsigned int i;
+
+   map = _bench_content_add(b, elm_map_add(b->win));
+   elm_map_zoom_mode_set(map, ELM_MAP_ZOOM_MODE_MANUAL);
+   elm_map_zoom_set(map, 12);
+   elm_map_region_show(map, 2.352, 48.856);
+   _bench_render(b);
+
+   /* tiles are fetched asynchronously, so only the synchronous part of the
+    * pan is measured and the main loop is left alone */
+   _bench_start(b);
+   for (i = 0; i < b->pages; i++)
+     {
+        elm_map_region_show(map, 2.352 + (i * 0.01), 48.856 - (i * 0.005));
+        _bench_render(b);
+     }
+   _bench_stop(b, "map.pan", b->pages);
+
+   evas_object_del(map);
+}
+
+static void
+_bench_photocam(Bench *b)
+{
+   Evas_Object *pc;
+   unsigned int i;
+   int w = 0, h = 0;
+   char path[PATH_MAX];
+
+   snprintf(path, sizeof(path), "%s/images/insanely_huge_test_image.jpg",
+            elm_app_data_dir_get());
+
+   pc = _bench_content_add(b, elm_photocam_add(b->win));
+   if (elm_photocam_file_set(pc, path) != EVAS_LOAD_ERROR_NONE)
+     {
+        fprintf(stderr, "elm_bench: photocam: cannot load %s, skipped\n", path);
+        evas_object_del(pc);
+        return;
+     }
+   elm_photocam_zoom_mode_set(pc, ELM_PHOTOCAM_ZOOM_MODE_MANUAL);
+   elm_photocam_zoom_set(pc, 1.0);
+   _bench_settle(b);
+   elm_photocam_image_size_get(pc, &w, &h);
+
+   _bench_start(b);
+   for (i = 0; i < b->pages; i++)
+     {
+        elm_photocam_image_region_show
+          (pc, ((i * BENCH_WIN_W) / 2) % MAX(w - BENCH_WIN_W, 1),
+           ((i * BENCH_WIN_H) / 4) % MAX(h - BENCH_WIN_H, 1),
+           BENCH_WIN_W, BENCH_WIN_H);
+        _bench_render(b);
+     }
+   _bench_stop(b, "photocam.pan", b->pages);
+
+   evas_object_del(pc);
+}
+
+static void
+_bench_transit(Bench *b)
+{
+   Elm_Transit *transit;
+   Eina_List *objs = NULL;
+   Evas_Object *bt;
+   unsigned int i, n = 100;
+
+   transit = elm_transit_add();
+   for (i = 0; i < n; i++)
+     {
+        bt = elm_button_add(b->win);
+        elm_object_text_set(bt, _bench_word(i));
+        evas_object_move(bt, (i % 10) * 40, (i / 10) * 60);
+        evas_object_resize(bt, 80, 40);
+        evas_object_show(bt);
+        elm_transit_object_add(transit, bt);
+        objs = eina_list_append(objs, bt);
+     }
+   elm_transit_effect_translation_add(transit, 0, 0, 100, 100);
+   elm_transit_effect_zoom_add(transit, 1.0, 1.5);
+   elm_transit_objects_final_state_keep_set(transit, EINA_TRUE);
+   /* long enough that every tick below has the effects running */
+   elm_transit_duration_set(transit, 3600.0);
+   _bench_settle(b);
+
+   /* drive the animators by hand, so the cost of a tick is not hidden
+    * behind the frame timer */
+   ecore_animator_source_set(ECORE_ANIMATOR_SOURCE_CUSTOM);
+   elm_transit_go(transit);
+   _bench_frame(b);
+
+   _bench_start(b);
+   for (i = 0; i < b->pages; i++)
+     {
+        ecore_animator_custom_tick();
+        _bench_render(b);
+     }
+   _bench_stop(b, "transit.tick", b->pages);
+
+   elm_transit_del(transit);
+   ecore_animator_source_set(ECORE_ANIMATOR_SOURCE_TIMER);
+   EINA_LIST_FREE(objs, bt)
+     evas_object_del(bt);
+}
+
+static const Bench_Case _bench_cases[] = {
+   { "genlist", _bench_genlist },
+   { "gengrid", _bench_gengrid },
+   { "entry", _bench_entry },
+   { "theme", _bench_theme },
+   { "win", _bench_win },
+   { "map", _bench_map },
+   { "photocam", _bench_photocam },
+   { "transit", _bench_transit },
+   { NULL, NULL }
+};
+
+static int
+_bench_cmp(const void *a, const void *b)
+{
+   double da = *(const double *)a, db = *(const double *)b;
+
+   if (da < db) return -1;
+   if (da > db) return 1;
+   return 0;
+}
+
+static void
+_bench_json_print(FILE *f, Bench *b, unsigned int repeat)
+{
+   Bench_Metric *m;
+   Eina_List *l;
+   const char *engine = getenv("ELM_ENGINE");
+
+   fprintf(f, "{\n");
+   fprintf(f, "  \"elementary\": \"%d.%d.%d\",\n",
+           elm_version->major, elm_version->minor, elm_version->micro);
+   fprintf(f, "  \"engine\": \"%s\",\n", engine ? engine : "");
+   fprintf(f, "  \"items\": %u,\n", b->items);
+   fprintf(f, "  \"pages\": %u,\n", b->pages);
+   fprintf(f, "  \"repeat\": %u,\n", repeat);
+   fprintf(f, "  \"unit\": \"ms\",\n");
+   fprintf(f, "  \"results\": [");
+   EINA_LIST_FOREACH(b->metrics, l, m)
+     {
+        double sum = 0.0, mean, var = 0.0, median;
+        unsigned int i;
+
+        qsort(m->samples, m->count, sizeof(double), _bench_cmp);
+        for (i = 0; i < m->count; i++) sum += m->samples[i];
+        mean = sum / m->count;
+        for (i = 0; i < m->count; i++)
+          var += (m->samples[i] - mean) * (m->samples[i] - mean);
+        var /= m->count;
+        if (m->count % 2) median = m->samples[m->count / 2];
+        else
+          median = (m->samples[m->count / 2 - 1] +
+                    m->samples[m->count / 2]) / 2.0;
+
+        fprintf(f, "%s\n    { \"name\": \"%s\", \"n\": %u, \"runs\": %u, "
+                "\"min\": %.4f, \"median\": %.4f, \"mean\": %.4f, "
+                "\"max\": %.4f, \"stddev\": %.4f }",
+                (l == b->metrics) ? "" : ",", m->name, m->n, m->count,
+                m->samples[0], median, mean, m->samples[m->count - 1],
+                sqrt(var));
+     }
+   fprintf(f, "\n  ]\n}\n");
+}
+
+static Eina_Bool
+_bench_selected(const Bench_Case *c, int argc, char **argv, int first)
+{
+   int i;
+
+   if (first >= argc) return EINA_TRUE;
+   for (i = first; i < argc; i++)
+     if (!strcmp(argv[i], c->name)) return EINA_TRUE;
+   return EINA_FALSE;
+}
+
+static void
+_bench_usage(const char *prog)
+{
+   printf("Usage: %s [options] [benchmark ...]\n"
+          "  -h            This help\n"
+          "  -l            List the benchmarks and exit\n"
+          "  -r REPEAT     Measured runs of every benchmark (default 5)\n"
+          "  -w WARMUP     Unmeasured runs before those (default 1)\n"
+          "  -n ITEMS      Items or text lines per benchmark (default 10000)\n"
+          "  -p PAGES      Pages scrolled, panned or ticked (default 100)\n"
+          "  -o FILE       Write the JSON results to FILE instead of stdout\n",
+          prog);
+}
+
+int
+main(int argc, char **argv)
+{
+   const Bench_Case *c;
+   Bench b;
+   Bench_Metric *m;
+   unsigned int repeat = 5, warmup = 1, i;
+   const char *out = NULL;
+   FILE *f = stdout;
+   int first;
+
+   memset(&b, 0, sizeof(b));
+   b.items = 10000;
+   b.pages = 100;
+
+   for (first = 1; first < argc; first++)
+     {
+        if (!strcmp(argv[first], "-h"))
+          {
+             _bench_usage(argv[0]);
+             return 0;
+          }
+        else if (!strcmp(argv[first], "-l"))
+          {
+             for (c = _bench_cases; c->name; c++) printf("%s\n", c->name);
+             return 0;
+          }
+        else if ((!strcmp(argv[first], "-r")) && (first < argc - 1))
+          repeat = MAX(atoi(argv[++first]), 1);
+        else if ((!strcmp(argv[first], "-w")) && (first < argc - 1))
+          warmup = MAX(atoi(argv[++first]), 0);
+        else if ((!strcmp(argv[first], "-n")) && (first < argc - 1))
+          b.items = MAX(atoi(argv[++first]), 1);
+        else if ((!strcmp(argv[first], "-p")) && (first < argc - 1))
+          b.pages = MAX(atoi(argv[++first]), 1);
+        else if ((!strcmp(argv[first], "-o")) && (first < argc - 1))
+          out = argv[++first];
+        else if (argv[first][0] == '-')
+          {
+             _bench_usage(argv[0]);
+             return 1;
+          }
+        else break;
+     }
+
+   /* must be set before elm_init() reads the config */
+   setenv("ELM_ENGINE", "buffer", 0);
+
+   elm_init(argc, argv);
+   elm_app_info_set(main, "elementary", "images/logo.png");
+   elm_app_compile_data_dir_set(PACKAGE_DATA_DIR);
+
+   for (c = _bench_cases; c->name; c++)
+     {
+        if (!_bench_selected(c, argc, argv, first)) continue;
+
+        fprintf(stderr, "elm_bench: %s\n", c->name);
+        for (i = 0; i < warmup + repeat; i++)
+          {
+             b.win = _bench_win_add();
+             if (!b.win) break;
+             b.record = (i >= warmup);
+             _bench_settle(&b);
+             c->run(&b);
+             evas_object_del(b.win);
+             b.win = NULL;
+          }
+     }
+
+   if (out)
+     {
+        f = fopen(out, "w");
+        if (!f)
+          {
+             fprintf(stderr, "elm_bench: cannot write %s\n", out);
+             f = stdout;
+          }
+     }
+   _bench_json_print(f, &b, repeat);
+   if (f != stdout) fclose(f);
+
+   EINA_LIST_FREE(b.metrics, m)
+     {
+        free(m->samples);
+        free(m);
+     }
+
+   elm_shutdown();
+   return 0;
+}
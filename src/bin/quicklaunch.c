@@ -16,6 +16,7 @@
 #include <fcntl.h>
 #include <signal.h>
 #include <sys/wait.h>
+#include <sys/select.h>
 
 #include <Elementary.h>
 
@@ -25,6 +26,24 @@ extern char **environ;
 
 static double restart_time = 0.0;
 
+typedef struct _Zygote Zygote;
+
+/* A zygote is a child forked from here once elementary is initialized
+ * and seeded. It gets the connected client sockets passed over its
+ * control socket and forks the applications from there, so the cost of
+ * sub_init and of warming up is never paid on the launch path. */
+struct _Zygote
+{
+   pid_t  pid;
+   int    ctl; /* our end of the control socket, -1 when not running */
+   double spawned;
+   Eina_Bool busy : 1;
+};
+
+static Zygote *zygotes = NULL;
+static int zygotes_num = 0;
+static int zygote_ctl = -1; /* in a zygote, its end of the control socket */
+
 #define LENGTH_OF_SOCKADDR_UN(s) (strlen((s)->sun_path) + (size_t)(((struct sockaddr_un *)NULL)->sun_path))
 
 static struct sigaction old_sigint;
@@ -51,6 +70,8 @@ static int _log_dom = -1;
 static void
 post_fork(void *data EINA_UNUSED)
 {
+   int i;
+
    sigaction(SIGINT, &old_sigint, NULL);
    sigaction(SIGTERM, &old_sigterm, NULL);
    sigaction(SIGQUIT, &old_sigquit, NULL);
@@ -64,6 +85,11 @@ post_fork(void *data EINA_UNUSED)
    sigaction(SIGFPE, &old_sigfpe, NULL);
    sigaction(SIGBUS, &old_sigbus, NULL);
    sigaction(SIGABRT, &old_sigabrt, NULL);
+   for (i = 0; i < zygotes_num; i++)
+     {
+        if (zygotes[i].ctl >= 0) close(zygotes[i].ctl);
+     }
+   if (zygote_ctl >= 0) close(zygote_ctl);
    if ((_log_dom > -1) && (_log_dom != EINA_LOG_DOMAIN_GLOBAL))
      {
         eina_log_domain_unregister(_log_dom);
@@ -103,6 +129,7 @@ handle_run(int fd, unsigned long bytes)
    char *cwd;
    int argc, envnum;
    unsigned long off;
+   char fdbuf[32];
 
    _elm_startup_time = ecore_time_unix_get();
 
@@ -113,7 +140,6 @@ handle_run(int fd, unsigned long bytes)
         close(fd);
         return;
      }
-   close(fd);
 
    argc = ((unsigned long *)(buf))[0];
    envnum = ((unsigned long *)(buf))[1];
@@ -121,6 +147,7 @@ handle_run(int fd, unsigned long bytes)
    if (argc <= 0)
      {
         CRI("no executable specified");
+        close(fd);
         return;
      }
 
@@ -151,9 +178,189 @@ handle_run(int fd, unsigned long bytes)
           }
      }
 #endif
+   /* elementary_run waits on the connection for the first frame time */
+   if (getenv("ELM_QUICKLAUNCH_REPORT"))
+     {
+        snprintf(fdbuf, sizeof(fdbuf), "%i", fd);
+        setenv("ELM_QUICKLAUNCH_REPORT_FD", fdbuf, 1);
+     }
+   else
+     {
+        close(fd);
+        fd = -1;
+     }
    elm_quicklaunch_prepare(argc, argv, cwd);
    elm_quicklaunch_fork(argc, argv, cwd, post_fork, NULL);
    elm_quicklaunch_cleanup();
+   if (fd >= 0)
+     {
+        unsetenv("ELM_QUICKLAUNCH_REPORT_FD");
+        close(fd);
+     }
+}
+
+static Eina_Bool
+fd_send(int sock, int fd)
+{
+   union
+     {
+        struct cmsghdr hdr;
+        char buf[CMSG_SPACE(sizeof(int))];
+     } cmsg;
+   struct cmsghdr *ch;
+   struct msghdr msg;
+   struct iovec iov;
+   char c = 0;
+
+   memset(&msg, 0, sizeof(msg));
+   memset(&cmsg, 0, sizeof(cmsg));
+   iov.iov_base = &c;
+   iov.iov_len = 1;
+   msg.msg_iov = &iov;
+   msg.msg_iovlen = 1;
+   msg.msg_control = cmsg.buf;
+   msg.msg_controllen = sizeof(cmsg.buf);
+   ch = CMSG_FIRSTHDR(&msg);
+   ch->cmsg_level = SOL_SOCKET;
+   ch->cmsg_type = SCM_RIGHTS;
+   ch->cmsg_len = CMSG_LEN(sizeof(int));
+   memcpy(CMSG_DATA(ch), &fd, sizeof(int));
+
+   return sendmsg(sock, &msg, MSG_NOSIGNAL) == 1;
+}
+
+static int
+fd_recv(int sock)
+{
+   union
+     {
+        struct cmsghdr hdr;
+        char buf[CMSG_SPACE(sizeof(int))];
+     } cmsg;
+   struct cmsghdr *ch;
+   struct msghdr msg;
+   struct iovec iov;
+   ssize_t num;
+   char c;
+   int fd = -1;
+
+   memset(&msg, 0, sizeof(msg));
+   iov.iov_base = &c;
+   iov.iov_len = 1;
+   msg.msg_iov = &iov;
+   msg.msg_iovlen = 1;
+   msg.msg_control = cmsg.buf;
+   msg.msg_controllen = sizeof(cmsg.buf);
+
+   do num = recvmsg(sock, &msg, 0);
+   while ((num < 0) && (errno == EINTR));
+   if (num != 1) return -1;
+
+   ch = CMSG_FIRSTHDR(&msg);
+   if ((ch) && (ch->cmsg_level == SOL_SOCKET) &&
+       (ch->cmsg_type == SCM_RIGHTS))
+     memcpy(&fd, CMSG_DATA(ch), sizeof(int));
+   return fd;
+}
+
+static void
+zygote_run(int argc, char **argv)
+{
+   char idle = 1;
+
+   /* a crashing zygote is respawned by the master, it must not restart
+    * the whole quicklaunch */
+   sigaction(SIGSEGV, &old_sigsegv, NULL);
+   sigaction(SIGILL, &old_sigill, NULL);
+   sigaction(SIGFPE, &old_sigfpe, NULL);
+   sigaction(SIGBUS, &old_sigbus, NULL);
+   sigaction(SIGABRT, &old_sigabrt, NULL);
+
+   ecore_fork_reset();
+   elm_quicklaunch_sub_init(argc, argv);
+   elm_quicklaunch_seed();
+
+   for (;;)
+     {
+        unsigned long bytes;
+        int fd;
+
+        fd = fd_recv(zygote_ctl);
+        if (fd < 0) break;
+        if (read(fd, &bytes, sizeof(unsigned long)) == sizeof(unsigned long))
+          handle_run(fd, bytes);
+        else
+          close(fd);
+        if (write(zygote_ctl, &idle, 1) != 1) break;
+     }
+   exit(0);
+}
+
+static Eina_Bool
+zygote_spawn(Zygote *z, int sock, int argc, char **argv)
+{
+   int sv[2], i;
+   pid_t pid;
+
+   if (socketpair(AF_UNIX, SOCK_STREAM, 0, sv) < 0)
+     {
+        ERR("cannot create zygote control socket: %s", strerror(errno));
+        return EINA_FALSE;
+     }
+   pid = fork();
+   if (pid < 0)
+     {
+        ERR("cannot fork zygote: %s", strerror(errno));
+        close(sv[0]);
+        close(sv[1]);
+        return EINA_FALSE;
+     }
+   if (pid == 0)
+     {
+        close(sv[0]);
+        close(sock);
+        for (i = 0; i < zygotes_num; i++)
+          {
+             if (zygotes[i].ctl >= 0) close(zygotes[i].ctl);
+             zygotes[i].ctl = -1;
+          }
+        zygote_ctl = sv[1];
+        zygote_run(argc, argv);
+     }
+   close(sv[1]);
+   z->pid = pid;
+   z->ctl = sv[0];
+   z->spawned = ecore_time_get();
+   z->busy = EINA_FALSE;
+   DBG("zygote %i spawned", pid);
+   return EINA_TRUE;
+}
+
+static void
+zygote_died(Zygote *z, int sock, int argc, char **argv)
+{
+   close(z->ctl);
+   z->ctl = -1;
+   if ((ecore_time_get() - z->spawned) < 1.0)
+     {
+        ERR("zygote %i died too fast - not respawning it", z->pid);
+        return;
+     }
+   WRN("zygote %i died, respawning", z->pid);
+   zygote_spawn(z, sock, argc, argv);
+}
+
+static Zygote *
+zygote_idle_get(void)
+{
+   int i;
+
+   for (i = 0; i < zygotes_num; i++)
+     {
+        if ((zygotes[i].ctl >= 0) && (!zygotes[i].busy))
+          return &(zygotes[i]);
+     }
+   return NULL;
 }
 
 int
@@ -165,8 +372,8 @@ main(int argc, char **argv)
    struct linger lin;
    char buf[PATH_MAX];
    struct sigaction action;
-   const char *disp;
-   int ret = 0;
+   const char *disp, *s;
+   int ret = 0, i;
 
    if (!eina_init())
      {
@@ -312,18 +519,68 @@ main(int argc, char **argv)
    sigemptyset(&action.sa_mask);
    sigaction(SIGABRT, &action, &old_sigabrt);
 
+   zygotes_num = 2;
+   if ((s = getenv("ELM_QUICKLAUNCH_ZYGOTES"))) zygotes_num = atoi(s);
+   if (zygotes_num < 0) zygotes_num = 0;
+   if (zygotes_num > 0) zygotes = calloc(zygotes_num, sizeof(Zygote));
+   if (!zygotes) zygotes_num = 0;
+   for (i = 0; i < zygotes_num; i++)
+     {
+        zygotes[i].ctl = -1;
+        zygote_spawn(&(zygotes[i]), sock, argc, argv);
+     }
+
    for (;;)
      {
-        int fd;
+        int fd, maxfd = sock;
         struct sockaddr_un client;
         socklen_t len;
+        fd_set rfds;
+        Zygote *z;
+
+        FD_ZERO(&rfds);
+        FD_SET(sock, &rfds);
+        for (i = 0; i < zygotes_num; i++)
+          {
+             if (zygotes[i].ctl < 0) continue;
+             FD_SET(zygotes[i].ctl, &rfds);
+             if (zygotes[i].ctl > maxfd) maxfd = zygotes[i].ctl;
+          }
+        if (select(maxfd + 1, &rfds, NULL, NULL, NULL) < 0)
+          {
+             if (errno == EINTR) continue;
+             CRI("select(): %s", strerror(errno));
+             break;
+          }
+        for (i = 0; i < zygotes_num; i++)
+          {
+             char c;
+
+             if ((zygotes[i].ctl < 0) || (!FD_ISSET(zygotes[i].ctl, &rfds)))
+               continue;
+             if (read(zygotes[i].ctl, &c, 1) == 1)
+               zygotes[i].busy = EINA_FALSE;
+             else
+               zygote_died(&(zygotes[i]), sock, argc, argv);
+          }
+        if (!FD_ISSET(sock, &rfds)) continue;
 
         len = sizeof(struct sockaddr_un);
         fd = accept(sock, (struct sockaddr *)&client, &len);
+        if (fd < 0) continue;
+
+        z = zygote_idle_get();
+        if ((z) && (fd_send(z->ctl, fd)))
+          {
+             z->busy = EINA_TRUE;
+             close(fd);
+             continue;
+          }
+
+        /* no zygote available, launch from here the old way */
         elm_quicklaunch_sub_init(argc, argv);
         // don't seed since we are doing this AFTER launch request
         // elm_quicklaunch_seed();
-        if (fd >= 0)
           {
              unsigned long bytes;
              int num;
@@ -331,9 +588,16 @@ main(int argc, char **argv)
              num = read(fd, &bytes, sizeof(unsigned long));
              if (num == sizeof(unsigned long))
                handle_run(fd, bytes);
+             else
+               close(fd);
           }
         while (elm_quicklaunch_sub_shutdown() > 0);
      }
+   for (i = 0; i < zygotes_num; i++)
+     {
+        if (zygotes[i].ctl >= 0) close(zygotes[i].ctl);
+     }
+   free(zygotes);
    elm_quicklaunch_shutdown();
 
    if ((_log_dom > -1) && (_log_dom != EINA_LOG_DOMAIN_GLOBAL))
@@ -13,6 +13,7 @@
 #include <unistd.h>
 #include <sys/stat.h>
 #include <fcntl.h>
+#include <poll.h>
 #ifdef HAVE_ALLOCA_H
 # include <alloca.h>
 #endif
@@ -206,6 +207,24 @@ main(int argc, char **argv)
 
    if (write(sock, sbuf, slen) < 0)
      printf("elementary_quicklaunch: cannot write to socket '%s'\n", buf);
+   else if (getenv("ELM_QUICKLAUNCH_REPORT"))
+     {
+        struct pollfd pfd;
+        char tbuf[64];
+
+        /* the launched app writes how long its first frame took */
+        shutdown(sock, SHUT_WR);
+        pfd.fd = sock;
+        pfd.events = POLLIN;
+        if ((poll(&pfd, 1, 30000) > 0) &&
+            ((n = read(sock, tbuf, sizeof(tbuf) - 1)) > 0))
+          {
+             tbuf[n] = 0;
+             printf("first frame after: %s", tbuf);
+          }
+        else
+          printf("elementary_quicklaunch: no first frame reported\n");
+     }
    close(sock);
 
    free(cwd);
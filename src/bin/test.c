@@ -26,6 +26,7 @@ void test_box_horiz(void *data, Evas_Object *obj, void *event_info);
 void test_box_homo(void *data, Evas_Object *obj, void *event_info);
 void test_box_transition(void *data, Evas_Object *obj, void *event_info);
 void test_box_align(void *data, Evas_Object *obj, void *event_info);
+void test_box_bench(void *data, Evas_Object *obj, void *event_info);
 void test_button(void *data, Evas_Object *obj, void *event_info);
 void test_cnp(void *data, Evas_Object *obj, void *event_info);
 void test_transit(void *data, Evas_Object *obj, void *event_info);
@@ -39,6 +40,7 @@ void test_transit_resizing(void *data, Evas_Object *obj, void *event_info);
 void test_transit_zoom(void *data, Evas_Object *obj, void *event_info);
 void test_transit_tween(void *data, Evas_Object *obj, void *event_info);
 void test_transit_bezier(void *data, Evas_Object *obj, void *event_info);
+void test_transit_bench(void *data, Evas_Object *obj, void *event_info);
 void test_fileselector_button(void *data, Evas_Object *obj, void *event_info);
 void test_fileselector_entry(void *data, Evas_Object *obj, void *event_info);
 void test_clock(void *data, Evas_Object *obj, void *event_info);
@@ -130,6 +132,7 @@ void test_genlist_show_bring(void *data, Evas_Object *obj, void *event_info);
 void test_gesture_layer(void *data, Evas_Object *obj, void *event_info);
 void test_gesture_layer2(void *data, Evas_Object *obj, void *event_info);
 void test_gesture_layer3(void *data, Evas_Object *obj, void *event_info);
+void test_gesture_layer_replay(void *data, Evas_Object *obj, void *event_info);
 void test_table(void *data, Evas_Object *obj, void *event_info);
 void test_table2(void *data, Evas_Object *obj, void *event_info);
 void test_table3(void *data, Evas_Object *obj, void *event_info);
@@ -578,6 +581,7 @@ add_tests:
    ADD_TEST(NULL, "Containers", "Box Homogeneous", test_box_homo);
    ADD_TEST(NULL, "Containers", "Box Transition", test_box_transition);
    ADD_TEST(NULL, "Containers", "Box Align", test_box_align);
+   ADD_TEST(NULL, "Containers", "Box Benchmark", test_box_bench);
    ADD_TEST(NULL, "Containers", "Table", test_table);
    ADD_TEST(NULL, "Containers", "Table Homogeneous", test_table2);
    ADD_TEST(NULL, "Containers", "Table 3", test_table3);
@@ -627,6 +631,7 @@ add_tests:
    ADD_TEST(NULL, "Effects", "Transit Chain", test_transit_chain);
    ADD_TEST(NULL, "Effects", "Transit Tween", test_transit_tween);
    ADD_TEST(NULL, "Effects", "Transit Bezier", test_transit_bezier);
+   ADD_TEST(NULL, "Effects", "Transit Benchmark", test_transit_bench);
    ADD_TEST(NULL, "Effects", "Flip", test_flip);
    ADD_TEST(NULL, "Effects", "Flip 2", test_flip2);
    ADD_TEST(NULL, "Effects", "Flip 3", test_flip3);
@@ -732,6 +737,7 @@ add_tests:
    ADD_TEST(NULL, "Input", "Gesture Layer", test_gesture_layer);
    ADD_TEST(NULL, "Input", "Gesture Layer 2", test_gesture_layer2);
    ADD_TEST(NULL, "Input", "Gesture Layer 3", test_gesture_layer3);
+   ADD_TEST(NULL, "Input", "Gesture Layer Replay", test_gesture_layer_replay);
    ADD_TEST(NULL, "Input", "Multi Touch", test_multi);
 
    //------------------------------//
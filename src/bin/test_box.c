@@ -880,3 +880,117 @@ test_box_align(void *data EINA_UNUSED, Evas_Object *obj EINA_UNUSED,
    evas_object_resize(win, 300, 400);
    evas_object_show(win);
 }
+
+#define BENCH_BOX_ROWS 20
+#define BENCH_BOX_COLS 10
+#define BENCH_BOX_TICKS 600
+
+typedef struct _Box_Bench Box_Bench;
+struct _Box_Bench
+{
+   Evas_Object *win, *result;
+   Evas_Object *labels[BENCH_BOX_ROWS * BENCH_BOX_COLS];
+   Ecore_Animator *anim;
+   double spent;
+   int ticks;
+};
+
+/* change one label deep in the box tree, then time how long the
+ * resulting relayout of all the boxes takes */
+static Eina_Bool
+_box_bench_anim_cb(void *data)
+{
+   Box_Bench *bb = data;
+   Evas_Object *label;
+   char buf[256];
+   double t0, per_relayout;
+
+   label = bb->labels[(bb->ticks * 7) % (BENCH_BOX_ROWS * BENCH_BOX_COLS)];
+   elm_object_text_set(label, (bb->ticks & 0x1) ? "Changed label" : "Label");
+
+   t0 = ecore_time_get();
+   evas_smart_objects_calculate(evas_object_evas_get(bb->win));
+   bb->spent += ecore_time_get() - t0;
+   bb->ticks++;
+
+   if ((bb->ticks % 60) && (bb->ticks < BENCH_BOX_TICKS))
+     return ECORE_CALLBACK_RENEW;
+
+   per_relayout = (bb->spent * 1000.0) / bb->ticks;
+   snprintf(buf, sizeof(buf), "%d boxed labels, %d relayouts<br>"
+            "%.3f ms per relayout", BENCH_BOX_ROWS * BENCH_BOX_COLS,
+            bb->ticks, per_relayout);
+   elm_object_text_set(bb->result, buf);
+
+   if (bb->ticks < BENCH_BOX_TICKS) return ECORE_CALLBACK_RENEW;
+
+   printf("box bench: %d boxed labels, %d relayouts, %.3f ms per relayout\n",
+          BENCH_BOX_ROWS * BENCH_BOX_COLS, bb->ticks, per_relayout);
+   bb->anim = NULL;
+   return ECORE_CALLBACK_CANCEL;
+}
+
+static void
+_box_bench_win_del_cb(void *data, Evas *e EINA_UNUSED, Evas_Object *obj EINA_UNUSED, void *event_info EINA_UNUSED)
+{
+   Box_Bench *bb = data;
+
+   ecore_animator_del(bb->anim);
+   free(bb);
+}
+
+void
+test_box_bench(void *data EINA_UNUSED, Evas_Object *obj EINA_UNUSED,
+               void *event_info EINA_UNUSED)
+{
+   Evas_Object *win, *bx, *row, *col, *lb;
+   Box_Bench *bb;
+   int i, j;
+
+   bb = calloc(1, sizeof(Box_Bench));
+   if (!bb) return;
+
+   bb->win = win = elm_win_util_standard_add("box-bench", "Box Benchmark");
+   elm_win_autodel_set(win, EINA_TRUE);
+   evas_object_event_callback_add(win, EVAS_CALLBACK_DEL,
+                                  _box_bench_win_del_cb, bb);
+
+   bx = elm_box_add(win);
+   evas_object_size_hint_weight_set(bx, EVAS_HINT_EXPAND, EVAS_HINT_EXPAND);
+   elm_win_resize_object_add(win, bx);
+   evas_object_show(bx);
+
+   bb->result = elm_label_add(bx);
+   elm_object_text_set(bb->result, "Measuring...");
+   elm_box_pack_end(bx, bb->result);
+   evas_object_show(bb->result);
+
+   for (i = 0; i < BENCH_BOX_ROWS; i++)
+     {
+        row = elm_box_add(bx);
+        elm_box_horizontal_set(row, EINA_TRUE);
+        evas_object_size_hint_weight_set(row, EVAS_HINT_EXPAND, 0.0);
+        evas_object_size_hint_align_set(row, EVAS_HINT_FILL, EVAS_HINT_FILL);
+        elm_box_pack_end(bx, row);
+        evas_object_show(row);
+
+        for (j = 0; j < BENCH_BOX_COLS; j++)
+          {
+             col = elm_box_add(row);
+             evas_object_size_hint_weight_set(col, EVAS_HINT_EXPAND, 0.0);
+             elm_box_pack_end(row, col);
+             evas_object_show(col);
+
+             lb = elm_label_add(col);
+             elm_object_text_set(lb, "Label");
+             elm_box_pack_end(col, lb);
+             evas_object_show(lb);
+             bb->labels[(i * BENCH_BOX_COLS) + j] = lb;
+          }
+     }
+
+   bb->anim = ecore_animator_add(_box_bench_anim_cb, bb);
+
+   evas_object_resize(win, 800, 600);
+   evas_object_show(win);
+}
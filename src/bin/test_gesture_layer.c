@@ -398,3 +398,182 @@ test_gesture_layer(void *data EINA_UNUSED, Evas_Object *obj EINA_UNUSED,
          photo_array);
    evas_object_show(win);
 }
+
+/* Gesture Layer Replay: feeds a touch trace sampled like a 240 Hz
+ * panel through a layer testing all the gestures, and reports the
+ * time spent per event. */
+#define REPLAY_RATE_MS 4
+#define REPLAY_STEPS 240
+#define REPLAY_RUNS 20
+
+typedef struct _Replay_Data Replay_Data;
+
+struct _Replay_Data
+{
+   Evas_Object *win, *rect, *gl, *label;
+   unsigned int timestamp;
+   unsigned int events;
+   unsigned int gestures;
+};
+
+static Evas_Event_Flags
+_replay_gesture_cb(void *data, void *event_info EINA_UNUSED)
+{
+   Replay_Data *rd = data;
+
+   rd->gestures++;
+   return EVAS_EVENT_FLAG_ON_HOLD;
+}
+
+/* two fingers pinching and rotating around the rect's center */
+static void
+_replay_pinch(Replay_Data *rd, Evas *e, Evas_Coord cx, Evas_Coord cy)
+{
+   double a, r;
+   int i, x0, y0, x1, y1;
+
+   for (i = 0; i <= REPLAY_STEPS; i++)
+     {
+        a = (M_PI / 2.0) * i / REPLAY_STEPS;
+        r = 40.0 + (120.0 * i / REPLAY_STEPS);
+        x0 = cx - (r * cos(a));
+        y0 = cy - (r * sin(a));
+        x1 = cx + (r * cos(a));
+        y1 = cy + (r * sin(a));
+        rd->timestamp += REPLAY_RATE_MS;
+
+        if (!i)
+          {
+             evas_event_feed_mouse_move(e, x0, y0, rd->timestamp, NULL);
+             evas_event_feed_mouse_down(e, 1, EVAS_BUTTON_NONE,
+                                        rd->timestamp, NULL);
+             evas_event_feed_multi_down(e, 1, x1, y1, 0, 0, 0, 0, 0,
+                                        x1, y1, EVAS_BUTTON_NONE,
+                                        rd->timestamp, NULL);
+          }
+        else
+          {
+             evas_event_feed_mouse_move(e, x0, y0, rd->timestamp, NULL);
+             evas_event_feed_multi_move(e, 1, x1, y1, 0, 0, 0, 0, 0,
+                                        x1, y1, rd->timestamp, NULL);
+          }
+        rd->events += 2;
+     }
+
+   rd->timestamp += REPLAY_RATE_MS;
+   evas_event_feed_multi_up(e, 1, x1, y1, 0, 0, 0, 0, 0, x1, y1,
+                            EVAS_BUTTON_NONE, rd->timestamp, NULL);
+   evas_event_feed_mouse_up(e, 1, EVAS_BUTTON_NONE, rd->timestamp, NULL);
+   rd->events += 2;
+}
+
+/* one finger flick across the rect */
+static void
+_replay_flick(Replay_Data *rd, Evas *e, Evas_Coord x, Evas_Coord y,
+              Evas_Coord w)
+{
+   int i;
+
+   rd->timestamp += REPLAY_RATE_MS;
+   evas_event_feed_mouse_move(e, x, y, rd->timestamp, NULL);
+   evas_event_feed_mouse_down(e, 1, EVAS_BUTTON_NONE, rd->timestamp, NULL);
+   for (i = 1; i <= REPLAY_STEPS / 4; i++)
+     {
+        rd->timestamp += REPLAY_RATE_MS;
+        evas_event_feed_mouse_move(e, x + ((w * i) / (REPLAY_STEPS / 4)),
+                                   y, rd->timestamp, NULL);
+     }
+   evas_event_feed_mouse_up(e, 1, EVAS_BUTTON_NONE, rd->timestamp, NULL);
+   rd->events += (REPLAY_STEPS / 4) + 3;
+}
+
+static void
+_replay_run_cb(void *data, Evas_Object *obj EINA_UNUSED,
+               void *event_info EINA_UNUSED)
+{
+   Replay_Data *rd = data;
+   Evas *e = evas_object_evas_get(rd->win);
+   Evas_Coord x, y, w, h;
+   double t;
+   char buf[256];
+   int i;
+
+   evas_object_geometry_get(rd->rect, &x, &y, &w, &h);
+   rd->events = rd->gestures = 0;
+
+   t = ecore_time_get();
+   for (i = 0; i < REPLAY_RUNS; i++)
+     {
+        _replay_pinch(rd, e, x + (w / 2), y + (h / 2));
+        _replay_flick(rd, e, x + 10, y + (h / 2), w - 20);
+     }
+   t = ecore_time_get() - t;
+
+   snprintf(buf, sizeof(buf),
+            "%u events, %u gesture callbacks<br>"
+            "%.3f ms total, %.3f us per event",
+            rd->events, rd->gestures, t * 1000.0,
+            (t * 1000000.0) / rd->events);
+   elm_object_text_set(rd->label, buf);
+   printf("gesture layer replay: %u events, %.3f us per event\n",
+          rd->events, (t * 1000000.0) / rd->events);
+}
+
+static void
+_replay_win_del_cb(void *data, Evas *e EINA_UNUSED,
+                   Evas_Object *obj EINA_UNUSED, void *event_info EINA_UNUSED)
+{
+   free(data);
+}
+
+void
+test_gesture_layer_replay(void *data EINA_UNUSED, Evas_Object *obj EINA_UNUSED,
+      void *event_info EINA_UNUSED)
+{
+   Evas_Object *win, *bx, *bt;
+   Replay_Data *rd;
+   int i;
+
+   rd = calloc(1, sizeof(Replay_Data));
+   if (!rd) return;
+
+   win = elm_win_util_standard_add("gesture-layer-replay",
+                                   "Gesture Layer Replay");
+   elm_win_autodel_set(win, EINA_TRUE);
+   evas_object_event_callback_add(win, EVAS_CALLBACK_DEL,
+                                  _replay_win_del_cb, rd);
+   rd->win = win;
+
+   bx = elm_box_add(win);
+   evas_object_size_hint_weight_set(bx, EVAS_HINT_EXPAND, EVAS_HINT_EXPAND);
+   elm_win_resize_object_add(win, bx);
+   evas_object_show(bx);
+
+   rd->label = elm_label_add(win);
+   elm_object_text_set(rd->label, "Press Replay");
+   elm_box_pack_end(bx, rd->label);
+   evas_object_show(rd->label);
+
+   rd->rect = evas_object_rectangle_add(evas_object_evas_get(win));
+   evas_object_color_set(rd->rect, 64, 96, 160, 255);
+   evas_object_size_hint_min_set(rd->rect, 400, 400);
+   evas_object_size_hint_weight_set(rd->rect, EVAS_HINT_EXPAND,
+                                    EVAS_HINT_EXPAND);
+   elm_box_pack_end(bx, rd->rect);
+   evas_object_show(rd->rect);
+
+   bt = elm_button_add(win);
+   elm_object_text_set(bt, "Replay");
+   elm_box_pack_end(bx, bt);
+   evas_object_show(bt);
+   evas_object_smart_callback_add(bt, "clicked", _replay_run_cb, rd);
+
+   rd->gl = elm_gesture_layer_add(win);
+   elm_gesture_layer_hold_events_set(rd->gl, EINA_TRUE);
+   elm_gesture_layer_attach(rd->gl, rd->rect);
+   for (i = ELM_GESTURE_FIRST + 1; i < ELM_GESTURE_LAST; i++)
+     elm_gesture_layer_cb_set(rd->gl, i, ELM_GESTURE_STATE_MOVE,
+                              _replay_gesture_cb, rd);
+
+   evas_object_show(win);
+}
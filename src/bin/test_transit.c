@@ -768,3 +768,124 @@ test_transit_tween(void *data EINA_UNUSED, Evas_Object *obj EINA_UNUSED, void *e
    evas_object_resize(win, WIN_W, WIN_H);
    evas_object_show(win);
 }
+
+/* Transit Benchmark */
+#define BENCH_TRANSIT_NUM 300
+#define BENCH_TRANSIT_TICKS 600
+#define BENCH_RECT_SIZE 20
+
+typedef struct _Transit_Bench Transit_Bench;
+
+struct _Transit_Bench
+{
+   Evas_Object *label;
+   Ecore_Animator *begin_anim, *end_anim;
+   double begin, spent;
+   int ticks;
+};
+
+/* Animators run in the order they were added, so the time spent
+ * between these two is the time elm_transit took for that tick. */
+static Eina_Bool
+_transit_bench_begin_cb(void *data)
+{
+   Transit_Bench *tb = data;
+
+   tb->begin = ecore_time_get();
+   return ECORE_CALLBACK_RENEW;
+}
+
+static Eina_Bool
+_transit_bench_end_cb(void *data)
+{
+   Transit_Bench *tb = data;
+   char buf[256];
+   double per_tick, per_transit;
+
+   tb->spent += ecore_time_get() - tb->begin;
+   tb->ticks++;
+   if ((tb->ticks % 60) && (tb->ticks < BENCH_TRANSIT_TICKS))
+     return ECORE_CALLBACK_RENEW;
+
+   per_tick = (tb->spent * 1000.0) / tb->ticks;
+   per_transit = (tb->spent * 1000000.0) / (tb->ticks * BENCH_TRANSIT_NUM);
+   snprintf(buf, sizeof(buf),
+            "%d transits, %d ticks<br>"
+            "%.3f ms per tick, %.3f us per transit",
+            BENCH_TRANSIT_NUM, tb->ticks, per_tick, per_transit);
+   elm_object_text_set(tb->label, buf);
+
+   if (tb->ticks < BENCH_TRANSIT_TICKS) return ECORE_CALLBACK_RENEW;
+
+   printf("transit bench: %d transits, %d ticks, %.3f ms per tick, "
+          "%.3f us per transit\n", BENCH_TRANSIT_NUM, tb->ticks,
+          per_tick, per_transit);
+   ecore_animator_del(tb->begin_anim);
+   tb->begin_anim = NULL;
+   tb->end_anim = NULL;
+   return ECORE_CALLBACK_CANCEL;
+}
+
+static void
+_transit_bench_win_del_cb(void *data, Evas *e EINA_UNUSED, Evas_Object *obj EINA_UNUSED, void *event_info EINA_UNUSED)
+{
+   Transit_Bench *tb = data;
+
+   ecore_animator_del(tb->begin_anim);
+   ecore_animator_del(tb->end_anim);
+   free(tb);
+}
+
+void
+test_transit_bench(void *data EINA_UNUSED, Evas_Object *obj EINA_UNUSED, void *event_info EINA_UNUSED)
+{
+   Evas_Object *win, *rect;
+   Elm_Transit *trans;
+   Transit_Bench *tb;
+   int i, cols;
+
+   tb = calloc(1, sizeof(Transit_Bench));
+   if (!tb) return;
+
+   win = elm_win_util_standard_add("transit-bench", "Transit Benchmark");
+   elm_win_autodel_set(win, EINA_TRUE);
+   evas_object_event_callback_add(win, EVAS_CALLBACK_DEL,
+                                  _transit_bench_win_del_cb, tb);
+
+   tb->label = elm_label_add(win);
+   elm_object_text_set(tb->label, "Measuring...");
+   evas_object_move(tb->label, 0, 0);
+   evas_object_resize(tb->label, 400, 40);
+   evas_object_show(tb->label);
+
+   /* must be registered before the transits start so that it runs
+    * before them on each tick */
+   tb->begin_anim = ecore_animator_add(_transit_bench_begin_cb, tb);
+
+   cols = 400 / BENCH_RECT_SIZE;
+   for (i = 0; i < BENCH_TRANSIT_NUM; i++)
+     {
+        rect = evas_object_rectangle_add(evas_object_evas_get(win));
+        evas_object_color_set(rect, (i * 7) % 255, (i * 13) % 255,
+                              (i * 29) % 255, 255);
+        evas_object_move(rect, (i % cols) * BENCH_RECT_SIZE,
+                         40 + ((i / cols) * BENCH_RECT_SIZE));
+        evas_object_resize(rect, BENCH_RECT_SIZE - 2, BENCH_RECT_SIZE - 2);
+        evas_object_show(rect);
+
+        trans = elm_transit_add();
+        elm_transit_object_add(trans, rect);
+        elm_transit_effect_zoom_add(trans, 1.0, 0.5);
+        elm_transit_effect_rotation_add(trans, 0.0, 360.0);
+        elm_transit_tween_mode_set(trans, ELM_TRANSIT_TWEEN_MODE_SINUSOIDAL);
+        elm_transit_auto_reverse_set(trans, EINA_TRUE);
+        elm_transit_repeat_times_set(trans, -1);
+        elm_transit_duration_set(trans, 1.0 + ((i % 10) * 0.1));
+        elm_transit_go(trans);
+     }
+
+   tb->end_anim = ecore_animator_add(_transit_bench_end_cb, tb);
+
+   evas_object_resize(win, 400, 400);
+   evas_object_show(win);
+}
@@ -27,11 +27,13 @@ static const char TITLE_ACCESS_PART[] = "access.title";
 static const char SIG_TRANSITION_FINISHED[] = "transition,finished";
 static const char SIG_TITLE_TRANSITION_FINISHED[] = "title,transition,finished";
 static const char SIG_TITLE_CLICKED[] = "title,clicked";
+static const char SIG_CONTENT_BUILT[] = "content,built";
 
 static const Evas_Smart_Cb_Description _smart_callbacks[] = {
    {SIG_TRANSITION_FINISHED, ""},
    {SIG_TITLE_TRANSITION_FINISHED, ""},
    {SIG_TITLE_CLICKED, ""},
+   {SIG_CONTENT_BUILT, ""},
    {SIG_WIDGET_LANG_CHANGED, ""}, /**< handled by elm_widget */
    {SIG_WIDGET_ACCESS_CHANGED, ""}, /**< handled by elm_widget */
    {SIG_LAYOUT_FOCUSED, ""}, /**< handled by elm_layout */
@@ -537,6 +539,102 @@ _elm_naviframe_item_elm_widget_item_part_text_get(Eo *nit EINA_UNUSED,
    return elm_object_part_text_get(VIEW(it), buf);
 }
 
+static void
+_content_build_render_post(void *data,
+                           Evas *e EINA_UNUSED,
+                           void *event_info EINA_UNUSED)
+{
+   Elm_Naviframe_Data *sd = data;
+   Elm_Naviframe_Item_Data *it;
+   Eina_List *l;
+   double now = ecore_time_get();
+
+   EINA_LIST_FOREACH(sd->builds, l, it)
+     {
+        if (it->build_first_frame < 0.0)
+          it->build_first_frame = now - it->build_start;
+     }
+}
+
+static Eina_Bool _content_build_tick(void *data, const Eo_Event *event);
+static void _item_content_set(Elm_Naviframe_Item_Data *it, Evas_Object *content);
+
+static void
+_item_content_build_cancel(Elm_Naviframe_Item_Data *it)
+{
+   ELM_NAVIFRAME_DATA_GET(WIDGET(it), sd);
+
+   if (!it->build_cb) return;
+
+   it->build_cb = NULL;
+   it->build_data = NULL;
+   ELM_SAFE_FREE(it->build_content, evas_object_del);
+
+   sd->builds = eina_list_remove(sd->builds, it);
+   if (!sd->builds)
+     {
+        eo_event_callback_del
+          (sd->obj, EFL_ANIMATOR_EVENT_ANIMATOR_TICK, _content_build_tick, sd);
+        evas_event_callback_del_full
+          (evas_object_evas_get(sd->obj), EVAS_CALLBACK_RENDER_POST,
+           _content_build_render_post, sd);
+     }
+}
+
+static void
+_item_content_build_finish(Elm_Naviframe_Item_Data *it)
+{
+   Evas_Object *content = it->build_content;
+
+   it->build_content = NULL;
+   _item_content_build_cancel(it);
+   it->build_complete = ecore_time_get() - it->build_start;
+
+   if (content) _item_content_set(it, content);
+
+   eo_event_callback_call
+     (WIDGET(it), ELM_NAVIFRAME_EVENT_CONTENT_BUILT, EO_OBJ(it));
+}
+
+static void
+_item_content_build_step(Elm_Naviframe_Item_Data *it)
+{
+   Elm_Object_Item *eo_item = EO_OBJ(it);
+   Eina_Bool done;
+
+   eo_ref(eo_item);
+   done = it->build_cb(it->build_data, eo_item, &it->build_content);
+   if (it->base->on_deletion)
+     _item_content_build_cancel(it);
+   else if (done)
+     _item_content_build_finish(it);
+   eo_unref(eo_item);
+}
+
+/* builds the pending contents, oldest push first, until the frame budget
+ * is spent. nothing is built before the first frame of a push transition
+ * went out with the placeholder. */
+static Eina_Bool
+_content_build_tick(void *data, const Eo_Event *event EINA_UNUSED)
+{
+   Elm_Naviframe_Data *sd = data;
+   Elm_Naviframe_Item_Data *it;
+   double start, budget;
+
+   budget = sd->build_budget;
+   if (budget <= 0.0) budget = ecore_animator_frametime_get() / 2.0;
+   start = ecore_time_get();
+
+   while ((it = eina_list_data_get(sd->builds)))
+     {
+        if (it->build_first_frame < 0.0) break;
+        _item_content_build_step(it);
+        if ((ecore_time_get() - start) >= budget) break;
+     }
+
+   return EO_CALLBACK_CONTINUE;
+}
+
 EOLIAN static void
 _elm_naviframe_item_eo_base_destructor(Eo *eo_item, Elm_Naviframe_Item_Data *it)
 {
@@ -588,6 +686,7 @@ end:
         if (nfo->self == nit) nfo->self = NULL;
      }
 
+   _item_content_build_cancel(nit);
    _item_free(nit);
 
    eo_destructor(eo_super(eo_item, ELM_NAVIFRAME_ITEM_CLASS));
@@ -1192,6 +1291,8 @@ _elm_naviframe_item_eo_base_constructor(Eo *eo_item, Elm_Naviframe_Item_Data *it
 {
    eo_item = eo_constructor(eo_super(eo_item, ELM_NAVIFRAME_ITEM_CLASS));
    it->base = eo_data_scope_get(eo_item, ELM_WIDGET_ITEM_CLASS);
+   it->build_first_frame = -1.0;
+   it->build_complete = -1.0;
 
    return eo_item;
 }
@@ -1613,6 +1714,37 @@ _elm_naviframe_item_push(Eo *obj, Elm_Naviframe_Data *sd EINA_UNUSED, const char
    return eo_item;
 }
 
+EOLIAN static Elm_Object_Item*
+_elm_naviframe_item_deferred_push(Eo *obj, Elm_Naviframe_Data *sd, const char *title_label, Evas_Object *prev_btn, Evas_Object *next_btn, Evas_Object *placeholder, Elm_Naviframe_Item_Content_Build_Cb func, const void *data, const char *item_style)
+{
+   Elm_Object_Item *top_item, *eo_item;
+
+   EINA_SAFETY_ON_NULL_RETURN_VAL(func, NULL);
+
+   top_item = elm_naviframe_top_item_get(obj);
+   eo_item = _item_new(obj, top_item,
+                  title_label, prev_btn, next_btn, placeholder, item_style);
+   ELM_NAVIFRAME_ITEM_DATA_GET(eo_item, item);
+   if (!item) return NULL;
+
+   item->build_cb = func;
+   item->build_data = (void *)data;
+   item->build_start = ecore_time_get();
+
+   if (!sd->builds)
+     {
+        eo_event_callback_add
+          (obj, EFL_ANIMATOR_EVENT_ANIMATOR_TICK, _content_build_tick, sd);
+        evas_event_callback_add
+          (evas_object_evas_get(obj), EVAS_CALLBACK_RENDER_POST,
+           _content_build_render_post, sd);
+     }
+   sd->builds = eina_list_append(sd->builds, item);
+
+   _item_push_helper(item);
+   return eo_item;
+}
+
 EOLIAN static Elm_Object_Item*
 _elm_naviframe_item_insert_before(Eo *obj, Elm_Naviframe_Data *sd, Elm_Object_Item *eo_before, const char *title_label, Evas_Object *prev_btn, Evas_Object *next_btn, Evas_Object *content, const char *item_style)
 {
@@ -1943,6 +2075,28 @@ _elm_naviframe_item_pop_cb_set(Eo *eo_item EINA_UNUSED,
    nit->pop_data = data;
 }
 
+EOLIAN static void
+_elm_naviframe_item_build_times_get(Eo *eo_item EINA_UNUSED,
+                                    Elm_Naviframe_Item_Data *nit,
+                                    double *first_frame,
+                                    double *complete)
+{
+   if (first_frame) *first_frame = nit->build_first_frame;
+   if (complete) *complete = nit->build_complete;
+}
+
+EOLIAN static void
+_elm_naviframe_content_build_budget_set(Eo *obj EINA_UNUSED, Elm_Naviframe_Data *sd, double budget)
+{
+   sd->build_budget = budget;
+}
+
+EOLIAN static double
+_elm_naviframe_content_build_budget_get(Eo *obj EINA_UNUSED, Elm_Naviframe_Data *sd)
+{
+   return sd->build_budget;
+}
+
 EOLIAN static void
 _elm_naviframe_prev_btn_auto_pushed_set(Eo *obj EINA_UNUSED, Elm_Naviframe_Data *sd, Eina_Bool auto_pushed)
 {
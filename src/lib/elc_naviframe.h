@@ -62,6 +62,9 @@
  *                                      is finished in changing the state
  *                                      of the title
  * @li @c "title,clicked" - User clicked title area
+ * @li @c "content,built" - The content of an item pushed with
+ *                          elm_naviframe_item_deferred_push() replaced its
+ *                          placeholder (since 1.18)
  * @li @c "focused" - When the naviframe has received focus. (since 1.8)
  * @li @c "unfocused" - When the naviframe has lost focus. (since 1.8)
  * @li @c "language,changed" - the program's language changed (since 1.9)
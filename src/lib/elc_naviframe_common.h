@@ -11,6 +11,20 @@
  */
 typedef Eina_Bool (*Elm_Naviframe_Item_Pop_Cb)(void *data, Elm_Object_Item *it);
 
+/**
+ * @typedef Elm_Naviframe_Item_Content_Build_Cb
+ *
+ * Build callback of an item pushed with elm_naviframe_item_deferred_push().
+ * It is called repeatedly and should do a small slice of the work on each
+ * call. @c content is @c NULL on the first call: the callback creates the
+ * content there, without showing it, and keeps filling it on later calls.
+ * @c data is user specific data. Return @c EINA_TRUE once the content is
+ * complete. If @c content is still @c NULL then, the placeholder stays.
+ *
+ * @since 1.18
+ */
+typedef Eina_Bool (*Elm_Naviframe_Item_Content_Build_Cb)(void *data, Elm_Object_Item *it, Evas_Object **content);
+
 /**
  * @brief Add a new Naviframe object to the parent.
  *
@@ -62,6 +62,21 @@ typedef struct Key_Event_Info {
      Eo *bridge;
 } Key_Event_Info;
 
+typedef struct _Elm_Atspi_Bridge_Pending_Event
+{
+   EINA_INLIST;
+   Eo *obj;
+   const char *infc;
+   const Eldbus_Signal *signal;
+   const char *minor;
+   unsigned int det1;
+   unsigned int det2;
+   const char *variant_sig;
+   int ival;
+   Eina_Stringshare *sval;
+   Eo *oval;
+} Elm_Atspi_Bridge_Pending_Event;
+
 typedef struct _Elm_Atspi_Bridge_Data
 {
    Eldbus_Connection *session_bus;
@@ -95,6 +110,21 @@ typedef struct _Elm_Atspi_Bridge_Data
    } interfaces;
    Elm_Atspi_Event_Handler *event_hdlr;
    Eina_Hash *event_hash;
+   struct {
+        Eina_List *added;
+        Eina_Hash *added_nodes; /* object -> its node in added */
+        Eina_List *removed;
+   } cache_updates;
+   struct {
+        Eina_Inlist *queue;
+        Eina_Hash *by_obj; /* source object -> its queued events */
+        Eina_Hash *by_child; /* child -> queued children-changed events about it */
+        unsigned int queued;
+        unsigned int sent;
+        unsigned int coalesced;
+        unsigned int dropped;
+   } events;
+   Ecore_Idle_Enterer *flush_idler;
    Eina_Bool connected : 1;
 } Elm_Atspi_Bridge_Data;
 
@@ -132,6 +162,10 @@ static void _bridge_object_register(Eo *bridge, Eo *obj);
 static void _bridge_object_unregister(Eo *bridge, Eo *obj);
 static const char * _path_from_object(const Eo *eo);
 static void _bridge_signal_send(Eo *bridge, Eo *obj, const char *ifc, const Eldbus_Signal *signal, const char *minor, unsigned int det1, unsigned int det2, const char *variant_sig, ...);
+static void _bridge_events_flush(Eo *bridge);
+static void _bridge_updates_schedule(Eo *bridge);
+static void _bridge_events_object_del(Eo *bridge, Eo *obj, Eina_Bool unannounced);
+static void _bridge_events_clear(Eo *bridge);
 static Eo * _bridge_object_from_path(Eo *bridge, const char *path);
 static void _bridge_iter_object_reference_append(Eo *bridge, Eldbus_Message_Iter *iter, const Eo *obj);
 
@@ -557,7 +591,6 @@ _accessible_get_children(const Eldbus_Service_Interface *iface, const Eldbus_Mes
    EINA_LIST_FOREACH(children_list, l, children)
      {
         _bridge_iter_object_reference_append(bridge, iter_array, children);
-        _bridge_object_register(bridge, children);
      }
 
    eldbus_message_iter_container_close(iter, iter_array);
@@ -779,7 +812,6 @@ _accessible_child_at_index(const Eldbus_Service_Interface *iface EINA_UNUSED, co
 
    child = eina_list_nth(children, idx);
    _bridge_iter_object_reference_append(bridge, iter, child);
-   _bridge_object_register(bridge, child);
    eina_list_free(children);
 
    return ret;
@@ -817,7 +849,6 @@ _accessible_get_relation_set(const Eldbus_Service_Interface *iface EINA_UNUSED,
         EINA_LIST_FOREACH(rel->objects, l2, rel_obj)
           {
              _bridge_iter_object_reference_append(bridge, iter_array2, rel_obj);
-             _bridge_object_register(bridge, rel_obj);
           }
         eldbus_message_iter_container_close(iter_struct, iter_array2);
         eldbus_message_iter_container_close(iter_array, iter_struct);
@@ -870,7 +901,6 @@ _selection_selected_child_get(const Eldbus_Service_Interface *iface EINA_UNUSED,
    child = elm_interface_atspi_selection_selected_child_get(obj, idx);
 
    _bridge_iter_object_reference_append(bridge, iter, child);
-   _bridge_object_register(bridge, child);
 
    return ret;
 }
@@ -2864,10 +2894,7 @@ _collection_return_msg_from_list(Elm_Atspi_Bridge *bridge, const Eldbus_Message
    array_iter = eldbus_message_iter_container_new(iter, 'a', "(so)");
 
    EINA_LIST_FOREACH(objs, l, obj)
-     {
-        _bridge_object_register(bridge, obj);
-        _bridge_iter_object_reference_append(bridge, array_iter, obj);
-     }
+     _bridge_iter_object_reference_append(bridge, array_iter, obj);
 
    eldbus_message_iter_container_close(iter, array_iter);
    return ret;
@@ -3074,17 +3101,25 @@ static const Eldbus_Service_Interface_Desc collection_iface_desc = {
 };
 
 static void
-_bridge_iter_object_reference_append(Eo *bridge, Eldbus_Message_Iter *iter, const Eo *obj)
+_bridge_iter_path_reference_append(Eo *bridge, Eldbus_Message_Iter *iter, const char *path)
 {
    ELM_ATSPI_BRIDGE_DATA_GET_OR_RETURN(bridge, pd);
    Eldbus_Message_Iter *iter_struct = eldbus_message_iter_container_new(iter, 'r', NULL);
    EINA_SAFETY_ON_NULL_RETURN(iter);
-   const char *path = _path_from_object(obj);
    eldbus_message_iter_basic_append(iter_struct, 's', eldbus_connection_unique_name_get(pd->a11y_bus));
    eldbus_message_iter_basic_append(iter_struct, 'o', path);
    eldbus_message_iter_container_close(iter, iter_struct);
 }
 
+static void
+_bridge_iter_object_reference_append(Eo *bridge, Eldbus_Message_Iter *iter, const Eo *obj)
+{
+   /* Objects are registered lazily, the first time a reference to them
+    * is handed out, so that paths received later can be resolved. */
+   if (obj) _bridge_object_register(bridge, (Eo *)obj);
+   _bridge_iter_path_reference_append(bridge, iter, _path_from_object(obj));
+}
+
 static void
 _object_desktop_reference_append(Eldbus_Message_Iter *iter)
 {
@@ -3141,6 +3176,7 @@ _cache_item_reference_append_cb(Eo *bridge, Eo *data, Eldbus_Message_Iter *iter_
   root = elm_interface_atspi_accessible_root_get(ELM_INTERFACE_ATSPI_ACCESSIBLE_MIXIN);
 
   role = elm_interface_atspi_accessible_role_get(data);
+  states = elm_interface_atspi_accessible_state_set_get(data);
 
   iter_struct = eldbus_message_iter_container_new(iter_array, 'r', NULL);
   EINA_SAFETY_ON_NULL_RETURN_VAL(iter_struct, EINA_TRUE);
@@ -3159,11 +3195,14 @@ _cache_item_reference_append_cb(Eo *bridge, Eo *data, Eldbus_Message_Iter *iter_
   else
     _bridge_iter_object_reference_append(bridge, iter_struct, parent);
 
-  /* Marshall children  */
+  /* Marshall children. Containers managing their descendants (genlist,
+   * gengrid...) may hold huge amount of items, so their children are
+   * never cached and clients have to query them on demand. */
   Eina_List *children_list = NULL, *l;
   Eo *child;
 
-  children_list = elm_interface_atspi_accessible_children_get(data);
+  if (!STATE_TYPE_GET(states, ELM_ATSPI_STATE_MANAGES_DESCENDANTS))
+    children_list = elm_interface_atspi_accessible_children_get(data);
   iter_sub_array = eldbus_message_iter_container_new(iter_struct, 'a', "(so)");
   EINA_SAFETY_ON_NULL_GOTO(iter_sub_array, fail);
 
@@ -3199,8 +3238,6 @@ _cache_item_reference_append_cb(Eo *bridge, Eo *data, Eldbus_Message_Iter *iter_
   iter_sub_array = eldbus_message_iter_container_new(iter_struct, 'a', "u");
   EINA_SAFETY_ON_NULL_GOTO(iter_sub_array, fail);
 
-  states = elm_interface_atspi_accessible_state_set_get(data);
-
   unsigned int s1 = states & 0xFFFFFFFF;
   unsigned int s2 = (states >> 32) & 0xFFFFFFFF;
   eldbus_message_iter_basic_append(iter_sub_array, 'u', s1);
@@ -3244,7 +3281,10 @@ _cache_get_items(const Eldbus_Service_Interface *iface, const Eldbus_Message *ms
         Eo *obj = eina_list_data_get(to_process);
         to_process = eina_list_remove_list(to_process, to_process);
         _cache_item_reference_append_cb(bridge, obj, iter_array);
-        _bridge_object_register(bridge, obj);
+
+        if (STATE_TYPE_GET(elm_interface_atspi_accessible_state_set_get(obj),
+                           ELM_ATSPI_STATE_MANAGES_DESCENDANTS))
+          continue;
 
         Eina_List *children;
         children = elm_interface_atspi_accessible_children_get(obj);
@@ -3326,7 +3366,6 @@ _component_get_accessible_at_point(const Eldbus_Service_Interface *iface EINA_UN
    Eina_Bool type = coord_type == ATSPI_COORD_TYPE_SCREEN ? EINA_TRUE : EINA_FALSE;
    accessible = elm_interface_atspi_component_accessible_at_point_get(obj, type, x, y);
    _bridge_iter_object_reference_append(bridge, iter, accessible);
-   _bridge_object_register(bridge, accessible);
 
    return ret;
 }
@@ -3990,7 +4029,7 @@ _selection_signal_send(void *data, const Eo_Event *event)
    return EINA_TRUE;
 }
 
-static void _bridge_signal_send(Eo *bridge, Eo *obj, const char *infc, const Eldbus_Signal *signal, const char *minor, unsigned int det1, unsigned int det2, const char *variant_sig, ...)
+static void _bridge_signal_emit(Eo *bridge, Eo *obj, const char *infc, const Eldbus_Signal *signal, const char *minor, unsigned int det1, unsigned int det2, const char *variant_sig, ...)
 {
    Eldbus_Message *msg;
    Eldbus_Message_Iter *iter , *iter_stack[64], *iter_struct;
@@ -4073,6 +4112,250 @@ static void _bridge_signal_send(Eo *bridge, Eo *obj, const char *infc, const Eld
    DBG("Send %s.%s[%s,%d,%d]", infc, signal->name, minor, det1, det2);
 }
 
+/* Signals only telling that some state of the object should be re-read:
+ * when several of them are raised for the same object and detail during
+ * one main loop iteration, only the last one is sent. */
+static Eina_Bool
+_bridge_signal_coalescable(const Eldbus_Signal *signal)
+{
+   return (signal == &_event_obj_signals[ATSPI_OBJECT_EVENT_PROPERTY_CHANGED]) ||
+          (signal == &_event_obj_signals[ATSPI_OBJECT_EVENT_STATE_CHANGED]) ||
+          (signal == &_event_obj_signals[ATSPI_OBJECT_EVENT_VISIBLE_DATA_CHANGED]) ||
+          (signal == &_event_obj_signals[ATSPI_OBJECT_EVENT_SELECTION_CHANGED]) ||
+          (signal == &_event_obj_signals[ATSPI_OBJECT_EVENT_ACTIVE_DESCENDANT_CHANGED]) ||
+          (signal == &_event_obj_signals[ATSPI_OBJECT_EVENT_TEXT_SELECTION_CHANGED]) ||
+          (signal == &_event_obj_signals[ATSPI_OBJECT_EVENT_TEXT_CARET_MOVED]);
+}
+
+static void
+_bridge_pending_event_free(Elm_Atspi_Bridge_Pending_Event *ev)
+{
+   eina_stringshare_del(ev->sval);
+   free(ev);
+}
+
+static Eina_Bool
+_bridge_events_list_free_cb(const Eina_Hash *hash EINA_UNUSED, const void *key EINA_UNUSED,
+                            void *data, void *fdata EINA_UNUSED)
+{
+   eina_list_free(data);
+   return EINA_TRUE;
+}
+
+static void
+_bridge_events_index_add(Eina_Hash *index, const Eo *key, Elm_Atspi_Bridge_Pending_Event *ev)
+{
+   Eina_List *events;
+
+   events = eina_list_append(eina_hash_find(index, &key), ev);
+   if (!eina_hash_modify(index, &key, events))
+     eina_hash_add(index, &key, events);
+}
+
+static void
+_bridge_events_index_del(Eina_Hash *index, const Eo *key, Elm_Atspi_Bridge_Pending_Event *ev)
+{
+   Eina_List *events;
+
+   events = eina_list_remove(eina_hash_find(index, &key), ev);
+   if (events)
+     eina_hash_modify(index, &key, events);
+   else
+     eina_hash_del_by_key(index, &key);
+}
+
+static Eina_Bool
+_bridge_event_is_child_change(const Elm_Atspi_Bridge_Pending_Event *ev)
+{
+   return ev->oval &&
+      (ev->signal == &_event_obj_signals[ATSPI_OBJECT_EVENT_CHILDREN_CHANGED]);
+}
+
+static void
+_bridge_pending_event_remove(Eo *bridge, Elm_Atspi_Bridge_Pending_Event *ev)
+{
+   ELM_ATSPI_BRIDGE_DATA_GET_OR_RETURN(bridge, pd);
+
+   pd->events.queue = eina_inlist_remove(pd->events.queue, EINA_INLIST_GET(ev));
+   _bridge_events_index_del(pd->events.by_obj, ev->obj, ev);
+   if (_bridge_event_is_child_change(ev))
+     _bridge_events_index_del(pd->events.by_child, ev->oval, ev);
+   _bridge_pending_event_free(ev);
+}
+
+static void
+_bridge_signal_send(Eo *bridge, Eo *obj, const char *infc, const Eldbus_Signal *signal, const char *minor, unsigned int det1, unsigned int det2, const char *variant_sig, ...)
+{
+   Elm_Atspi_Bridge_Pending_Event *ev, *old;
+   Eina_List *obj_events, *l;
+   va_list va;
+
+   EINA_SAFETY_ON_NULL_RETURN(infc);
+   EINA_SAFETY_ON_NULL_RETURN(signal);
+   EINA_SAFETY_ON_NULL_RETURN(minor);
+   EINA_SAFETY_ON_NULL_RETURN(obj);
+   ELM_ATSPI_BRIDGE_DATA_GET_OR_RETURN(bridge, pd);
+
+   ev = calloc(1, sizeof(Elm_Atspi_Bridge_Pending_Event));
+   if (!ev) return;
+
+   ev->obj = obj;
+   ev->infc = infc;
+   ev->signal = signal;
+   ev->minor = minor;
+   ev->det1 = det1;
+   ev->det2 = det2;
+   ev->variant_sig = variant_sig;
+
+   va_start(va, variant_sig);
+   if (!variant_sig)
+     ;
+   else if (!strcmp(variant_sig, "i"))
+     ev->ival = va_arg(va, int);
+   else if (!strcmp(variant_sig, "s"))
+     ev->sval = eina_stringshare_add(va_arg(va, char *));
+   else if (!strcmp(variant_sig, "(so)"))
+     {
+        /* bus name is resolved again when the signal is emitted */
+        va_arg(va, char *);
+        ev->oval = va_arg(va, Eo *);
+     }
+   else
+     ERR("Not supported signal variant: %s.", variant_sig);
+   va_end(va);
+
+   pd->events.queued++;
+
+   if (!pd->events.by_obj)
+     pd->events.by_obj = eina_hash_pointer_new(NULL);
+   if (!pd->events.by_child)
+     pd->events.by_child = eina_hash_pointer_new(NULL);
+
+   obj_events = eina_hash_find(pd->events.by_obj, &obj);
+   if (_bridge_signal_coalescable(signal))
+     {
+        EINA_LIST_FOREACH(obj_events, l, old)
+          {
+             if ((old->signal != signal) || strcmp(old->minor, minor))
+               continue;
+             /* the newest event replaces the queued one and takes its
+              * place at the end of the queue */
+             pd->events.queue = eina_inlist_remove(pd->events.queue, EINA_INLIST_GET(old));
+             _bridge_pending_event_free(old);
+             eina_list_data_set(l, ev);
+             pd->events.queue = eina_inlist_append(pd->events.queue, EINA_INLIST_GET(ev));
+             pd->events.coalesced++;
+             return;
+          }
+     }
+
+   _bridge_events_index_add(pd->events.by_obj, obj, ev);
+   if (_bridge_event_is_child_change(ev))
+     _bridge_events_index_add(pd->events.by_child, ev->oval, ev);
+   pd->events.queue = eina_inlist_append(pd->events.queue, EINA_INLIST_GET(ev));
+
+   _bridge_updates_schedule(bridge);
+}
+
+static void
+_bridge_events_flush(Eo *bridge)
+{
+   Elm_Atspi_Bridge_Pending_Event *ev;
+   unsigned int sent = 0;
+
+   ELM_ATSPI_BRIDGE_DATA_GET_OR_RETURN(bridge, pd);
+
+   if (pd->events.by_obj)
+     {
+        eina_hash_foreach(pd->events.by_obj, _bridge_events_list_free_cb, NULL);
+        eina_hash_free_buckets(pd->events.by_obj);
+     }
+   if (pd->events.by_child)
+     {
+        eina_hash_foreach(pd->events.by_child, _bridge_events_list_free_cb, NULL);
+        eina_hash_free_buckets(pd->events.by_child);
+     }
+
+   while (pd->events.queue)
+     {
+        ev = EINA_INLIST_CONTAINER_GET(pd->events.queue, Elm_Atspi_Bridge_Pending_Event);
+        pd->events.queue = eina_inlist_remove(pd->events.queue, pd->events.queue);
+
+        if (!ev->variant_sig)
+          _bridge_signal_emit(bridge, ev->obj, ev->infc, ev->signal, ev->minor,
+                              ev->det1, ev->det2, NULL, NULL);
+        else if (!strcmp(ev->variant_sig, "i"))
+          _bridge_signal_emit(bridge, ev->obj, ev->infc, ev->signal, ev->minor,
+                              ev->det1, ev->det2, "i", ev->ival);
+        else if (!strcmp(ev->variant_sig, "s"))
+          _bridge_signal_emit(bridge, ev->obj, ev->infc, ev->signal, ev->minor,
+                              ev->det1, ev->det2, "s", ev->sval ? ev->sval : "");
+        else if (!strcmp(ev->variant_sig, "(so)"))
+          _bridge_signal_emit(bridge, ev->obj, ev->infc, ev->signal, ev->minor,
+                              ev->det1, ev->det2, "(so)",
+                              eldbus_connection_unique_name_get(pd->a11y_bus), ev->oval);
+        sent++;
+        _bridge_pending_event_free(ev);
+     }
+
+   pd->events.sent += sent;
+   if (sent)
+     DBG("Flushed %u events (queued: %u, sent: %u, coalesced: %u, dropped: %u).",
+         sent, pd->events.queued, pd->events.sent, pd->events.coalesced, pd->events.dropped);
+}
+
+static void
+_bridge_events_object_del(Eo *bridge, Eo *obj, Eina_Bool unannounced)
+{
+   Elm_Atspi_Bridge_Pending_Event *ev;
+   Eina_List *obj_events, *ll, *ll_next;
+
+   ELM_ATSPI_BRIDGE_DATA_GET_OR_RETURN(bridge, pd);
+
+   if (!pd->events.by_obj) return;
+
+   /* Pending "re-read me" events are pointless for a dead object. When
+    * clients never heard of it, everything about it is dropped. */
+   obj_events = eina_hash_find(pd->events.by_obj, &obj);
+   EINA_LIST_FOREACH_SAFE(obj_events, ll, ll_next, ev)
+     {
+        if (!unannounced && !_bridge_signal_coalescable(ev->signal))
+          continue;
+        _bridge_pending_event_remove(bridge, ev);
+        pd->events.dropped++;
+     }
+
+   if (!unannounced) return;
+
+   obj_events = eina_hash_find(pd->events.by_child, &obj);
+   EINA_LIST_FOREACH_SAFE(obj_events, ll, ll_next, ev)
+     {
+        _bridge_pending_event_remove(bridge, ev);
+        pd->events.dropped++;
+     }
+}
+
+static void
+_bridge_events_clear(Eo *bridge)
+{
+   Elm_Atspi_Bridge_Pending_Event *ev;
+
+   ELM_ATSPI_BRIDGE_DATA_GET_OR_RETURN(bridge, pd);
+
+   while (pd->events.queue)
+     {
+        ev = EINA_INLIST_CONTAINER_GET(pd->events.queue, Elm_Atspi_Bridge_Pending_Event);
+        pd->events.queue = eina_inlist_remove(pd->events.queue, pd->events.queue);
+        _bridge_pending_event_free(ev);
+     }
+   if (pd->events.by_obj)
+     eina_hash_foreach(pd->events.by_obj, _bridge_events_list_free_cb, NULL);
+   ELM_SAFE_FREE(pd->events.by_obj, eina_hash_free);
+   if (pd->events.by_child)
+     eina_hash_foreach(pd->events.by_child, _bridge_events_list_free_cb, NULL);
+   ELM_SAFE_FREE(pd->events.by_child, eina_hash_free);
+}
+
 static Eina_Bool
 _text_caret_moved_send(void *data, const Eo_Event *event)
 {
@@ -4159,19 +4442,87 @@ _bridge_object_unregister(Eo *bridge, Eo *obj)
    eina_hash_del(pd->cache, &obj, obj);
 }
 
-static Eina_Bool
-_on_object_add(void *data, const Eo_Event *event)
+static void
+_cache_updates_flush(Eo *bridge)
 {
    Eldbus_Message *sig;
    Eldbus_Message_Iter *iter;
+   const void *removed;
+   Eo *added;
 
+   ELM_ATSPI_BRIDGE_DATA_GET_OR_RETURN(bridge, pd);
+
+   /* Removals go first, so a new object allocated at the address of a
+    * deleted one is announced after the stale path was dropped. */
+   EINA_LIST_FREE(pd->cache_updates.removed, removed)
+     {
+        sig = eldbus_service_signal_new(pd->cache_interface, ATSPI_OBJECT_CHILD_REMOVED);
+        iter = eldbus_message_iter_get(sig);
+        _bridge_iter_path_reference_append(bridge, iter, _path_from_object(removed));
+        eldbus_service_signal_send(pd->cache_interface, sig);
+     }
+
+   if (pd->cache_updates.added_nodes)
+     eina_hash_free_buckets(pd->cache_updates.added_nodes);
+   EINA_LIST_FREE(pd->cache_updates.added, added)
+     {
+        sig = eldbus_service_signal_new(pd->cache_interface, ATSPI_OBJECT_CHILD_ADDED);
+        iter = eldbus_message_iter_get(sig);
+        _cache_item_reference_append_cb(bridge, added, iter);
+        eldbus_service_signal_send(pd->cache_interface, sig);
+     }
+}
+
+static Eina_Bool
+_bridge_updates_flush_cb(void *data)
+{
+   ELM_ATSPI_BRIDGE_DATA_GET_OR_RETURN_VAL(data, pd, ECORE_CALLBACK_CANCEL);
+
+   pd->flush_idler = NULL;
+
+   /* Cache updates go first, so clients know about new objects before
+    * receiving events about them. */
+   _cache_updates_flush(data);
+   _bridge_events_flush(data);
+
+   return ECORE_CALLBACK_CANCEL;
+}
+
+static void
+_bridge_updates_schedule(Eo *bridge)
+{
+   ELM_ATSPI_BRIDGE_DATA_GET_OR_RETURN(bridge, pd);
+
+   if (!pd->flush_idler)
+     pd->flush_idler = ecore_idle_enterer_add(_bridge_updates_flush_cb, bridge);
+}
+
+static void
+_cache_updates_clear(Eo *bridge)
+{
+   ELM_ATSPI_BRIDGE_DATA_GET_OR_RETURN(bridge, pd);
+
+   ELM_SAFE_FREE(pd->flush_idler, ecore_idle_enterer_del);
+   _bridge_events_clear(bridge);
+   pd->cache_updates.added = eina_list_free(pd->cache_updates.added);
+   ELM_SAFE_FREE(pd->cache_updates.added_nodes, eina_hash_free);
+   pd->cache_updates.removed = eina_list_free(pd->cache_updates.removed);
+}
+
+static Eina_Bool
+_on_object_add(void *data, const Eo_Event *event)
+{
    ELM_ATSPI_BRIDGE_DATA_GET_OR_RETURN_VAL(data, pd, EINA_TRUE);
 
-   sig = eldbus_service_signal_new(pd->cache_interface, ATSPI_OBJECT_CHILD_ADDED);
-   iter = eldbus_message_iter_get(sig);
-   _cache_item_reference_append_cb(data, event->obj, iter);
+   if (!pd->cache_updates.added_nodes)
+     pd->cache_updates.added_nodes = eina_hash_pointer_new(NULL);
+   if (eina_hash_find(pd->cache_updates.added_nodes, &event->obj))
+     return EINA_TRUE;
 
-   eldbus_service_signal_send(pd->cache_interface, sig);
+   pd->cache_updates.added = eina_list_append(pd->cache_updates.added, event->obj);
+   eina_hash_add(pd->cache_updates.added_nodes, &event->obj,
+                 eina_list_last(pd->cache_updates.added));
+   _bridge_updates_schedule(data);
 
    return EINA_TRUE;
 }
@@ -4179,16 +4530,27 @@ _on_object_add(void *data, const Eo_Event *event)
 static Eina_Bool
 _on_object_del(void *data, const Eo_Event *event)
 {
-   Eldbus_Message *sig;
+   Eina_List *l;
 
    ELM_ATSPI_BRIDGE_DATA_GET_OR_RETURN_VAL(data, pd, EINA_TRUE);
 
    _bridge_object_unregister(data, event->obj);
 
-   sig = eldbus_service_signal_new(pd->cache_interface, ATSPI_OBJECT_CHILD_REMOVED);
-   Eldbus_Message_Iter *iter = eldbus_message_iter_get(sig);
-   _bridge_iter_object_reference_append(data, iter, event->obj);
-   eldbus_service_signal_send(pd->cache_interface, sig);
+   /* Object created and deleted within the same main loop iteration:
+    * clients never heard of it, so neither signal is needed. */
+   l = pd->cache_updates.added_nodes ?
+     eina_hash_find(pd->cache_updates.added_nodes, &event->obj) : NULL;
+   if (l)
+     {
+        eina_hash_del_by_key(pd->cache_updates.added_nodes, &event->obj);
+        pd->cache_updates.added = eina_list_remove_list(pd->cache_updates.added, l);
+        _bridge_events_object_del(data, event->obj, EINA_TRUE);
+        return EINA_TRUE;
+     }
+
+   _bridge_events_object_del(data, event->obj, EINA_FALSE);
+   pd->cache_updates.removed = eina_list_append(pd->cache_updates.removed, event->obj);
+   _bridge_updates_schedule(data);
 
    return EINA_TRUE;
 }
@@ -4224,6 +4586,8 @@ _a11y_connection_shutdown(Eo *bridge)
    if (pd->connected)
       _elm_atspi_bridge_app_unregister(bridge);
 
+   _cache_updates_clear(bridge);
+
    if (pd->cache)
      eina_hash_free(pd->cache);
    pd->cache = NULL;
@@ -4426,6 +4790,8 @@ static void _bridge_object_register(Eo *bridge, Eo *obj)
 {
    ELM_ATSPI_BRIDGE_DATA_GET_OR_RETURN(bridge, pd);
 
+   if (!pd->cache) return;
+
    if (!eo_isa(obj, ELM_INTERFACE_ATSPI_ACCESSIBLE_MIXIN))
      {
         WRN("Unable to register class w/o Elm_Interface_Atspi_Accessible!");
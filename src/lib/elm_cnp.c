@@ -52,6 +52,7 @@ typedef struct _Saved_Type    Saved_Type;
 typedef struct _Cnp_Escape    Cnp_Escape;
 typedef struct _Dropable      Dropable;
 typedef struct _Dropable_Cbs  Dropable_Cbs;
+typedef struct _Drop_Index    Drop_Index;
 static Eina_Bool doaccept = EINA_FALSE;
 
 struct _Tmp_Info
@@ -96,6 +97,9 @@ struct _Dropable
    Evas_Object    *obj;
    /* FIXME: Cache window */
    Eina_Inlist    *cbs_list; /* List of Dropable_Cbs * */
+   Drop_Index     *index; /* Index of the canvas obj is in */
+   Eina_Rectangle  geom; /* Geometry of obj, kept up to date by the index */
+   Eina_Bool       visible : 1;
    struct {
       Evas_Coord      x, y;
       Eina_Bool       in : 1;
@@ -104,12 +108,30 @@ struct _Dropable
    } last;
 };
 
+struct _Drop_Index
+{  /* Drop targets of one canvas, to hit test them on DnD motion */
+   Evas          *evas;
+   Eina_List     *dropables; /* List of Dropable * */
+   Dropable     **sorted; /* Visible targets, by top edge */
+   unsigned int   count; /* Number of sorted targets */
+   Evas_Coord     max_h; /* Height of the tallest sorted target */
+   Eina_Bool      dirty : 1; /* Targets changed since sorted */
+};
+
 struct _Item_Container_Drop_Info
 {  /* Info kept for containers to support drop */
    Evas_Object *obj;
    Elm_Xy_Item_Get_Cb itemgetcb;
    Elm_Drop_Item_Container_Cb dropcb;
    Elm_Drag_Item_Container_Pos poscb;
+   void *posdata;
+   struct {
+      Elm_Object_Item *it; /* Weak reference */
+      Evas_Coord x, y;
+      int xposret, yposret;
+      Eina_Bool valid : 1;
+      Eina_Bool found : 1; /* it was set, tells a deleted item from none */
+   } hit; /* Item under the pointer, kept until the canvas renders again */
 };
 typedef struct _Item_Container_Drop_Info Item_Container_Drop_Info;
 
@@ -161,6 +183,8 @@ static Saved_Type savedtypes =  { NULL, NULL, 0, 0, 0, EINA_FALSE };
 /* Drag & Drop functions */
 /* FIXME: Way too many globals */
 static Eina_List *drops = NULL;
+static Eina_List *drop_indexes = NULL; /* List of Drop_Index * */
+static Dropable *drop_in = NULL; /* Target the drag is over */
 static Evas_Object *dragwin = NULL;
 static int dragwin_x_start, dragwin_y_start;
 static int dragwin_x_end, dragwin_y_end;
@@ -264,6 +288,201 @@ struct _Cnp_Atom
    void                    *_term;
 };
 
+static void
+_dropable_in_set(Dropable *dropable, Eina_Bool in)
+{
+   dropable->last.in = !!in;
+   if (in) drop_in = dropable;
+   else if (drop_in == dropable) drop_in = NULL;
+}
+
+static void
+_dropable_geom_cb(void *data, Evas *e EINA_UNUSED, Evas_Object *obj, void *info EINA_UNUSED)
+{
+   Dropable *dropable = data;
+
+   evas_object_geometry_get(obj, &dropable->geom.x, &dropable->geom.y,
+                            &dropable->geom.w, &dropable->geom.h);
+   dropable->visible = evas_object_visible_get(obj);
+   dropable->index->dirty = EINA_TRUE;
+}
+
+static Drop_Index *
+_drop_index_find(const Evas *evas)
+{
+   Eina_List *l;
+   Drop_Index *idx;
+
+   EINA_LIST_FOREACH(drop_indexes, l, idx)
+     if (idx->evas == evas) return idx;
+   return NULL;
+}
+
+static Eina_Bool
+_drop_index_add(Dropable *dropable)
+{
+   Evas *evas = evas_object_evas_get(dropable->obj);
+   Drop_Index *idx = _drop_index_find(evas);
+
+   if (!idx)
+     {
+        idx = calloc(1, sizeof(Drop_Index));
+        if (!idx) return EINA_FALSE;
+        idx->evas = evas;
+        drop_indexes = eina_list_append(drop_indexes, idx);
+     }
+   idx->dropables = eina_list_append(idx->dropables, dropable);
+   dropable->index = idx;
+
+   evas_object_event_callback_add(dropable->obj, EVAS_CALLBACK_MOVE,
+                                  _dropable_geom_cb, dropable);
+   evas_object_event_callback_add(dropable->obj, EVAS_CALLBACK_RESIZE,
+                                  _dropable_geom_cb, dropable);
+   evas_object_event_callback_add(dropable->obj, EVAS_CALLBACK_SHOW,
+                                  _dropable_geom_cb, dropable);
+   evas_object_event_callback_add(dropable->obj, EVAS_CALLBACK_HIDE,
+                                  _dropable_geom_cb, dropable);
+   _dropable_geom_cb(dropable, evas, dropable->obj, NULL);
+   return EINA_TRUE;
+}
+
+static void
+_drop_index_del(Dropable *dropable)
+{
+   Drop_Index *idx = dropable->index;
+
+   if (drop_in == dropable) drop_in = NULL;
+   if (!idx) return;
+
+   evas_object_event_callback_del_full(dropable->obj, EVAS_CALLBACK_MOVE,
+                                       _dropable_geom_cb, dropable);
+   evas_object_event_callback_del_full(dropable->obj, EVAS_CALLBACK_RESIZE,
+                                       _dropable_geom_cb, dropable);
+   evas_object_event_callback_del_full(dropable->obj, EVAS_CALLBACK_SHOW,
+                                       _dropable_geom_cb, dropable);
+   evas_object_event_callback_del_full(dropable->obj, EVAS_CALLBACK_HIDE,
+                                       _dropable_geom_cb, dropable);
+   dropable->index = NULL;
+   idx->dropables = eina_list_remove(idx->dropables, dropable);
+   idx->dirty = EINA_TRUE;
+   if (idx->dropables) return;
+
+   drop_indexes = eina_list_remove(drop_indexes, idx);
+   free(idx->sorted);
+   free(idx);
+}
+
+static int
+_dropable_top_cmp(const void *d1, const void *d2)
+{
+   const Dropable *a = *(Dropable * const *)d1;
+   const Dropable *b = *(Dropable * const *)d2;
+
+   return a->geom.y - b->geom.y;
+}
+
+static Eina_Bool
+_drop_index_sort(Drop_Index *idx)
+{
+   Dropable **sorted, *dropable;
+   Eina_List *l;
+   unsigned int n = 0;
+
+   if (!idx->dirty) return EINA_TRUE;
+
+   sorted = realloc(idx->sorted,
+                    eina_list_count(idx->dropables) * sizeof(Dropable *));
+   if (!sorted) return EINA_FALSE;
+   idx->sorted = sorted;
+   idx->max_h = 0;
+   EINA_LIST_FOREACH(idx->dropables, l, dropable)
+     {
+        if ((!dropable->visible) ||
+            (dropable->geom.w <= 0) || (dropable->geom.h <= 0))
+          continue;
+        sorted[n++] = dropable;
+        if (dropable->geom.h > idx->max_h) idx->max_h = dropable->geom.h;
+     }
+   qsort(sorted, n, sizeof(Dropable *), _dropable_top_cmp);
+   idx->count = n;
+   idx->dirty = EINA_FALSE;
+   return EINA_TRUE;
+}
+
+/* Whether some target of the canvas covers (px, py). Targets are sorted by
+ * their top edge, so only those starting less than the tallest height above
+ * the point are looked at. */
+static Eina_Bool
+_drop_index_hit(Drop_Index *idx, Evas_Coord px, Evas_Coord py)
+{
+   unsigned int lo = 0, hi, mid;
+
+   /* Can't tell without the index, let the canvas decide */
+   if (!_drop_index_sort(idx)) return EINA_TRUE;
+
+   hi = idx->count;
+   while (lo < hi)
+     {
+        mid = (lo + hi) / 2;
+        if (idx->sorted[mid]->geom.y <= py) lo = mid + 1;
+        else hi = mid;
+     }
+   while (lo > 0)
+     {
+        Dropable *d = idx->sorted[--lo];
+
+        if (d->geom.y + idx->max_h <= py) break;
+        if ((py < d->geom.y + d->geom.h) &&
+            (px >= d->geom.x) && (px < d->geom.x + d->geom.w))
+          return EINA_TRUE;
+     }
+   return EINA_FALSE;
+}
+
+Eina_Bool
+_elm_drop_target_hit(Evas *evas, Evas_Coord x, Evas_Coord y)
+{
+   Drop_Index *idx = _drop_index_find(evas);
+
+   return ((idx) && (_drop_index_hit(idx, x, y)));
+}
+
+static void
+_drop_target_index_obj_del_cb(void *data EINA_UNUSED, Evas *e EINA_UNUSED, Evas_Object *obj, void *info EINA_UNUSED)
+{
+   Dropable *dropable = eo_key_data_get(obj, "__elm_dropable");
+
+   if (!dropable || dropable->cbs_list) return;
+
+   _drop_index_del(dropable);
+   eo_key_data_del(obj, "__elm_dropable");
+   free(dropable);
+}
+
+/* Test only: puts obj in its canvas' index of drop targets, as the X11
+ * and Wayland backends do, but with no callbacks. The local backend has
+ * no drag and drop, so it does not index anything itself. */
+Eina_Bool
+_elm_drop_target_index_add(Evas_Object *obj)
+{
+   Dropable *dropable = eo_key_data_get(obj, "__elm_dropable");
+
+   if (dropable) return EINA_TRUE;
+
+   dropable = calloc(1, sizeof(Dropable));
+   if (!dropable) return EINA_FALSE;
+   dropable->obj = obj;
+   if (!_drop_index_add(dropable))
+     {
+        free(dropable);
+        return EINA_FALSE;
+     }
+   eo_key_data_set(obj, "__elm_dropable", dropable);
+   evas_object_event_callback_add(obj, EVAS_CALLBACK_DEL,
+                                  _drop_target_index_obj_del_cb, NULL);
+   return EINA_TRUE;
+}
+
 static Eina_List *
 _dropable_list_geom_find(Evas *evas, Evas_Coord px, Evas_Coord py)
 {
@@ -273,6 +492,10 @@ _dropable_list_geom_find(Evas *evas, Evas_Coord px, Evas_Coord py)
 
    if (!drops) return NULL;
 
+   /* No target under the pointer, spare the walk of the canvas. The walk
+    * is still what decides otherwise, as it knows about stacking. */
+   if (!_elm_drop_target_hit(evas, px, py)) return NULL;
+
    /* We retrieve the (non-smart) objects pointed by (px, py) */
    top_objects_list = evas_tree_objects_at_xy_get(evas, NULL, px, py);
    /* We walk on this list from the last because if the list contains more than one
@@ -1265,10 +1488,12 @@ _x11_dropable_find(Ecore_X_Window win)
 {
    Eina_List *l;
    Dropable *dropable;
+   Drop_Index *idx;
 
-   if (!drops) return NULL;
-   EINA_LIST_FOREACH(drops, l, dropable)
+   /* A canvas has one window, any of its targets tells which */
+   EINA_LIST_FOREACH(drop_indexes, l, idx)
      {
+        dropable = eina_list_data_get(idx->dropables);
         if (_x11_elm_widget_xwin_get(dropable->obj) == win) return dropable;
      }
    return NULL;
@@ -1327,19 +1552,10 @@ _x11_dnd_enter(void *data EINA_UNUSED, int etype EINA_UNUSED, void *ev)
 static void
 _x11_dnd_dropable_handle(Dropable *dropable, Evas_Coord x, Evas_Coord y, Elm_Xdnd_Action action)
 {
-   Dropable *d, *last_dropable = NULL;
-   Eina_List *l;
+   Dropable *last_dropable = drop_in;
    Dropable_Cbs *cbs;
    Eina_Inlist *itr;
 
-   EINA_LIST_FOREACH(drops, l, d)
-     {
-        if (d->last.in)
-          {
-             last_dropable = d;
-             break;
-          }
-     }
    if (last_dropable)
      {
         if (last_dropable == dropable) // same
@@ -1358,9 +1574,9 @@ _x11_dnd_dropable_handle(Dropable *dropable, Evas_Coord x, Evas_Coord y, Elm_Xdn
                {
                   cnp_debug("leave %p\n", last_dropable->obj);
                   cnp_debug("enter %p\n", dropable->obj);
-                  last_dropable->last.in = EINA_FALSE;
+                  _dropable_in_set(last_dropable, EINA_FALSE);
                   last_dropable->last.type = NULL;
-                  dropable->last.in = EINA_TRUE;
+                  _dropable_in_set(dropable, EINA_TRUE);
                   EINA_INLIST_FOREACH_SAFE(dropable->cbs_list, itr, cbs)
                      if ((cbs->types & dropable->last.format) && cbs->entercb)
                        cbs->entercb(cbs->enterdata, dropable->obj);
@@ -1371,7 +1587,7 @@ _x11_dnd_dropable_handle(Dropable *dropable, Evas_Coord x, Evas_Coord y, Elm_Xdn
              else // leave last obj
                {
                   cnp_debug("leave %p\n", last_dropable->obj);
-                  last_dropable->last.in = EINA_FALSE;
+                  _dropable_in_set(last_dropable, EINA_FALSE);
                   last_dropable->last.type = NULL;
                   EINA_INLIST_FOREACH_SAFE(last_dropable->cbs_list, itr, cbs)
                      if ((cbs->types & last_dropable->last.format) && cbs->leavecb)
@@ -1387,7 +1603,7 @@ _x11_dnd_dropable_handle(Dropable *dropable, Evas_Coord x, Evas_Coord y, Elm_Xdn
 
              cnp_debug("enter %p\n", dropable->obj);
              evas_object_geometry_get(dropable->obj, &ox, &oy, NULL, NULL);
-             dropable->last.in = EINA_TRUE;
+             _dropable_in_set(dropable, EINA_TRUE);
              EINA_INLIST_FOREACH_SAFE(dropable->cbs_list, itr, cbs)
                {
                   if (cbs->types & dropable->last.format)
@@ -1522,15 +1738,10 @@ _x11_dnd_position(void *data EINA_UNUSED, int etype EINA_UNUSED, void *ev)
                   EINA_LIST_FOREACH(dropable_list, l, d)
                     {
                        if (idx == 0)
-                         {
-                            evas_object_geometry_get(d->obj, &inter_rect.x, &inter_rect.y,
-                                                     &inter_rect.w, &inter_rect.h);
-                         }
+                         inter_rect = d->geom;
                        else
                          {
-                            Eina_Rectangle cur_rect;
-                            evas_object_geometry_get(d->obj, &cur_rect.x, &cur_rect.y,
-                                                     &cur_rect.w, &cur_rect.h);
+                            Eina_Rectangle cur_rect = d->geom;
                             if (!eina_rectangle_intersection(&inter_rect, &cur_rect)) continue;
                          }
                        idx++;
@@ -1591,7 +1802,6 @@ _x11_dnd_drop(void *data EINA_UNUSED, int etype EINA_UNUSED, void *ev)
    Elm_Selection_Data ddata;
    Evas_Coord x = 0, y = 0;
    Elm_Xdnd_Action act = ELM_XDND_ACTION_UNKNOWN;
-   Eina_List *l;
    Dropable_Cbs *cbs;
    Eina_Inlist *itr;
 
@@ -1609,15 +1819,13 @@ _x11_dnd_drop(void *data EINA_UNUSED, int etype EINA_UNUSED, void *ev)
 
    cnp_debug("Drop position is %d,%d\n", savedtypes.x, savedtypes.y);
 
-   EINA_LIST_FOREACH(drops, l, dropable)
+   dropable = drop_in;
+   if (dropable)
      {
-        if (dropable->last.in)
-          {
-             evas_object_geometry_get(dropable->obj, &x, &y, NULL, NULL);
-             savedtypes.x -= x;
-             savedtypes.y -= y;
-             goto found;
-          }
+        evas_object_geometry_get(dropable->obj, &x, &y, NULL, NULL);
+        savedtypes.x -= x;
+        savedtypes.y -= y;
+        goto found;
      }
 
    cnp_debug("Didn't find a target\n");
@@ -1628,7 +1836,7 @@ found:
 
    act = _x11_dnd_action_map(drop->action);
 
-   dropable->last.in = EINA_FALSE;
+   _dropable_in_set(dropable, EINA_FALSE);
    cnp_debug("Last type: %s - Last format: %X\n", dropable->last.type, dropable->last.format);
    if ((!strcmp(dropable->last.type, text_uri)))
      {
@@ -2033,6 +2241,11 @@ _x11_elm_drop_target_add(Evas_Object *obj, Elm_Sel_Format format,
         drops = eina_list_append(drops, dropable);
         if (!drops) goto error;
         dropable->obj = obj;
+        if (!_drop_index_add(dropable))
+          {
+             drops = eina_list_remove(drops, dropable);
+             goto error;
+          }
         eo_key_data_set(obj, "__elm_dropable", dropable);
      }
    dropable->cbs_list = eina_inlist_append(dropable->cbs_list, EINA_INLIST_GET(cbs));
@@ -2673,6 +2886,7 @@ _wl_selection_receive(void *udata, int type EINA_UNUSED, void *event)
           }
         else
           {
+             _elm_cnp_selection_pieces_end(sel->requestwidget);
              evas_object_event_callback_del_full(sel->requestwidget,
                                                  EVAS_CALLBACK_DEL,
                                                  _wl_sel_obj_del2, sel);
@@ -2756,6 +2970,11 @@ _wl_elm_drop_target_add(Evas_Object *obj, Elm_Sel_Format format, Elm_Drag_State
         drops = eina_list_append(drops, dropable);
         if (!drops) goto error;
         dropable->obj = obj;
+        if (!_drop_index_add(dropable))
+          {
+             drops = eina_list_remove(drops, dropable);
+             goto error;
+          }
         eo_key_data_set(obj, "__elm_dropable", dropable);
      }
    dropable->cbs_list = eina_inlist_append(dropable->cbs_list, EINA_INLIST_GET(cbs));
@@ -3114,29 +3333,26 @@ _wl_dnd_drop(void *data EINA_UNUSED, int type EINA_UNUSED, void *event)
    Ecore_Wl2_Event_Dnd_Drop *ev;
    Ecore_Wl2_Window *win;
    Dropable *drop;
-   Eina_List *l;
 
    cnp_debug("In\n");
    ev = event;
    savedtypes.x = ev->x;
    savedtypes.y = ev->y;
 
-   EINA_LIST_FOREACH(drops, l, drop)
+   drop = drop_in;
+   if (drop)
      {
-        if (drop->last.in)
-          {
-             cnp_debug("Request data of type %s\n", drop->last.type);
-             wl_cnp_selection.requestwidget = drop->obj;
-             evas_object_event_callback_add(wl_cnp_selection.requestwidget,
-                   EVAS_CALLBACK_DEL,
-                   _wl_sel_obj_del2,
-                   &wl_cnp_selection);
-
-             win = _wl_elm_widget_window_get(drop->obj);
-             ecore_wl2_dnd_drag_get(ecore_wl2_window_input_get(win),
-                                    drop->last.type);
-             return ECORE_CALLBACK_PASS_ON;
-          }
+        cnp_debug("Request data of type %s\n", drop->last.type);
+        wl_cnp_selection.requestwidget = drop->obj;
+        evas_object_event_callback_add(wl_cnp_selection.requestwidget,
+              EVAS_CALLBACK_DEL,
+              _wl_sel_obj_del2,
+              &wl_cnp_selection);
+
+        win = _wl_elm_widget_window_get(drop->obj);
+        ecore_wl2_dnd_drag_get(ecore_wl2_window_input_get(win),
+                               drop->last.type);
+        return ECORE_CALLBACK_PASS_ON;
      }
 
    win = ecore_wl2_display_window_find(_elm_wl_display, ev->win);
@@ -3189,6 +3405,7 @@ _wl_dnd_receive(void *data, int type EINA_UNUSED, void *event)
           _wl_dropable_data_handle(sel, ev->data, ev->len);
         else
           {
+             _elm_cnp_selection_pieces_end(sel->requestwidget);
              evas_object_event_callback_del_full(sel->requestwidget,
                                                  EVAS_CALLBACK_DEL,
                                                  _wl_sel_obj_del2, sel);
@@ -3308,15 +3525,20 @@ _wl_dropable_find(unsigned int win)
    Eina_List *l;
    Dropable *dropable;
    Ecore_Wl2_Window *window;
+   Drop_Index *idx;
 
    if (!drops) return NULL;
 
    window = ecore_wl2_display_window_find(_elm_wl_display, win);
    if (!window) return NULL;
 
-   EINA_LIST_FOREACH(drops, l, dropable)
-     if (_wl_elm_widget_window_get(dropable->obj) == window)
-       return dropable;
+   /* A canvas has one window, any of its targets tells which */
+   EINA_LIST_FOREACH(drop_indexes, l, idx)
+     {
+        dropable = eina_list_data_get(idx->dropables);
+        if (_wl_elm_widget_window_get(dropable->obj) == window)
+          return dropable;
+     }
 
    return NULL;
 }
@@ -3331,19 +3553,9 @@ _wl_evas_get_from_win(unsigned int win)
 static void
 _wl_dropable_handle(Dropable *drop, Evas_Coord x, Evas_Coord y)
 {
-   Dropable *d, *last_dropable = NULL;
+   Dropable *last_dropable = drop_in;
    Dropable_Cbs *cbs;
    Eina_Inlist *itr;
-   Eina_List *l;
-
-   EINA_LIST_FOREACH(drops, l, d)
-     {
-        if (d->last.in)
-          {
-             last_dropable = d;
-             break;
-          }
-     }
 
    /* If we are on the same object, just update the position */
    if ((drop) && (last_dropable == drop))
@@ -3359,7 +3571,7 @@ _wl_dropable_handle(Dropable *drop, Evas_Coord x, Evas_Coord y)
         EINA_INLIST_FOREACH_SAFE(last_dropable->cbs_list, itr, cbs)
            if (cbs->leavecb)
               cbs->leavecb(cbs->leavedata, last_dropable->obj);
-        last_dropable->last.in = EINA_FALSE;
+        _dropable_in_set(last_dropable, EINA_FALSE);
      }
    /* We enter the new dropable */
    if (drop)
@@ -3370,7 +3582,7 @@ _wl_dropable_handle(Dropable *drop, Evas_Coord x, Evas_Coord y)
         EINA_INLIST_FOREACH_SAFE(drop->cbs_list, itr, cbs)
            if (cbs->poscb)
               cbs->poscb(cbs->posdata, drop->obj, x, y, dragaction);
-        drop->last.in = EINA_TRUE;
+        _dropable_in_set(drop, EINA_TRUE);
      }
 }
 
@@ -3390,7 +3602,7 @@ _wl_dropable_all_clean(unsigned int win)
           {
              dropable->last.x = 0;
              dropable->last.y = 0;
-             dropable->last.in = EINA_FALSE;
+             _dropable_in_set(dropable, EINA_FALSE);
           }
      }
 }
@@ -3727,6 +3939,449 @@ _cocoa_elm_cnp_selection_get(const Evas_Object  *obj,
 
 #endif
 
+////////////////////////////////////////////////////////////////////////////
+// streamed transfers: the data is cut in chunks and converted if asked on a
+// worker thread, the main loop gets a few chunks at a time
+////////////////////////////////////////////////////////////////////////////
+#define CNP_STREAM_CHUNK    (64 * 1024)
+#define CNP_STREAM_INFLIGHT 4
+
+typedef struct _Cnp_Buf          Cnp_Buf;
+typedef struct _Cnp_Stream       Cnp_Stream;
+typedef struct _Cnp_Stream_Chunk Cnp_Stream_Chunk;
+
+// selection data shared by the local selection and the streams reading it,
+// only referenced and released from the main loop
+struct _Cnp_Buf
+{
+   int     ref;
+   size_t  size;
+   char   *data;
+};
+
+struct _Cnp_Stream
+{
+   Evas_Object            *obj;
+   Elm_Selection_Stream_Cb func;
+   void                   *data;
+   Eina_List              *pieces; // Cnp_Buf * to stream, under lock
+   Eina_List              *used; // Cnp_Buf * streamed, under lock
+   Elm_Sel_Format          format; // of the pieces
+   Elm_Sel_Format          convert;
+   Evas_Coord              x, y;
+   Elm_Xdnd_Action         action;
+   Eina_Lock               lock;
+   Eina_Condition          cond;
+   int                     inflight; // chunks not consumed yet, under lock
+   Eina_Bool               stop : 1; // set from the main loop, under lock
+   Eina_Bool               complete : 1; // no more pieces, under lock
+   Eina_Bool               open : 1; // fed piece by piece until complete
+   Eina_Bool               started : 1;
+};
+
+struct _Cnp_Stream_Chunk
+{
+   Elm_Sel_Format  format;
+   size_t          len;
+   char           *data;
+};
+
+// streams waiting for their data or running
+static Eina_List *_cnp_streams = NULL;
+
+static Cnp_Buf *
+_cnp_buf_new(const void *data, size_t size)
+{
+   Cnp_Buf *buf;
+
+   buf = calloc(1, sizeof(Cnp_Buf));
+   if (!buf) return NULL;
+   buf->data = malloc(size + 1);
+   if (!buf->data)
+     {
+        free(buf);
+        return NULL;
+     }
+   memcpy(buf->data, data, size);
+   buf->data[size] = 0;
+   buf->size = size;
+   buf->ref = 1;
+   return buf;
+}
+
+static Cnp_Buf *
+_cnp_buf_ref(Cnp_Buf *buf)
+{
+   if (buf) buf->ref++;
+   return buf;
+}
+
+static void
+_cnp_buf_unref(Cnp_Buf *buf)
+{
+   if ((!buf) || (--buf->ref > 0)) return;
+   free(buf->data);
+   free(buf);
+}
+
+// end of the chunk starting at pos, not cutting a character, a tag or an
+// escape in two
+static size_t
+_cnp_stream_cut(const char *s, size_t pos, size_t size, Eina_Bool markup)
+{
+   size_t end = pos + CNP_STREAM_CHUNK, i;
+
+   if (end >= size) return size;
+   while ((end > pos) && (((unsigned char)s[end] & 0xc0) == 0x80)) end--;
+   if (markup)
+     {
+        for (i = end; i > pos + 1; i--)
+          {
+             if ((s[i - 1] == '>') || (s[i - 1] == ';')) break;
+             if ((s[i - 1] == '<') || (s[i - 1] == '&'))
+               {
+                  end = i - 1;
+                  break;
+               }
+          }
+     }
+   else if ((end > pos) && (s[end - 1] == '\r') && (s[end] == '\n'))
+     end++;
+   if (end == pos) end = pos + CNP_STREAM_CHUNK;
+   return end;
+}
+
+// format of the chunks given to the stream callback
+static Elm_Sel_Format
+_cnp_stream_format(const Cnp_Stream *st)
+{
+   if ((st->format == ELM_SEL_FORMAT_TEXT) &&
+       (st->convert == ELM_SEL_FORMAT_MARKUP))
+     return ELM_SEL_FORMAT_MARKUP;
+   if ((st->format == ELM_SEL_FORMAT_MARKUP) &&
+       (st->convert == ELM_SEL_FORMAT_TEXT))
+     return ELM_SEL_FORMAT_TEXT;
+   return st->format;
+}
+
+static void
+_cnp_stream_stop(Cnp_Stream *st)
+{
+   eina_lock_take(&st->lock);
+   st->stop = EINA_TRUE;
+   eina_condition_signal(&st->cond);
+   eina_lock_release(&st->lock);
+}
+
+// cuts s from *pos in chunks and hands them over; unless final, the tail
+// shorter than a chunk is left for the data still to come. False once
+// stopped
+static Eina_Bool
+_cnp_stream_emit(Cnp_Stream *st, Ecore_Thread *thread, const char *s,
+                 size_t size, size_t *pos, Eina_Bool final)
+{
+   Eina_Bool markup, text, stop;
+   size_t end;
+
+   markup = !!(st->format & (ELM_SEL_FORMAT_MARKUP | ELM_SEL_FORMAT_HTML));
+   text = markup || (st->format & ELM_SEL_FORMAT_TEXT);
+   while ((final) ? (*pos < size) : (size - *pos > CNP_STREAM_CHUNK))
+     {
+        Cnp_Stream_Chunk *chunk;
+        char *c;
+
+        if (text)
+          end = _cnp_stream_cut(s, *pos, size, markup);
+        else
+          end = MIN(*pos + CNP_STREAM_CHUNK, size);
+
+        chunk = calloc(1, sizeof(Cnp_Stream_Chunk));
+        c = malloc(end - *pos + 1);
+        if ((!chunk) || (!c))
+          {
+             free(chunk);
+             free(c);
+             return EINA_FALSE;
+          }
+        memcpy(c, s + *pos, end - *pos);
+        c[end - *pos] = 0;
+        chunk->format = _cnp_stream_format(st);
+        if (chunk->format == st->format)
+          {
+             chunk->data = c;
+             chunk->len = end - *pos;
+          }
+        else
+          {
+             // both are plain string functions, fine off the main loop
+             if (chunk->format == ELM_SEL_FORMAT_MARKUP)
+               chunk->data = evas_textblock_text_utf8_to_markup(NULL, c);
+             else
+               chunk->data = evas_textblock_text_markup_to_utf8(NULL, c);
+             chunk->len = chunk->data ? strlen(chunk->data) : 0;
+             free(c);
+          }
+        *pos = end;
+
+        eina_lock_take(&st->lock);
+        while ((st->inflight >= CNP_STREAM_INFLIGHT) && (!st->stop))
+          eina_condition_wait(&st->cond);
+        stop = st->stop;
+        if (!stop) st->inflight++;
+        eina_lock_release(&st->lock);
+        if (stop)
+          {
+             free(chunk->data);
+             free(chunk);
+             return EINA_FALSE;
+          }
+        ecore_thread_feedback(thread, chunk);
+     }
+   return EINA_TRUE;
+}
+
+// a piece is streamed where it is, only what is left of it past the
+// last cut is copied, to go on with the next piece
+static void
+_cnp_stream_run(void *data, Ecore_Thread *thread)
+{
+   Cnp_Stream *st = data;
+   Eina_Binbuf *tail = eina_binbuf_new();
+   Cnp_Buf *piece = NULL;
+   Eina_Bool final, ok = EINA_TRUE;
+   size_t pos;
+
+   if (!tail) return;
+   while (ok)
+     {
+        eina_lock_take(&st->lock);
+        while ((!st->pieces) && (!st->complete) && (!st->stop))
+          eina_condition_wait(&st->cond);
+        piece = eina_list_data_get(st->pieces);
+        st->pieces = eina_list_remove_list(st->pieces, st->pieces);
+        final = ((st->complete) && (!st->pieces));
+        ok = !st->stop;
+        eina_lock_release(&st->lock);
+        if ((!ok) || (!piece)) break;
+
+        pos = 0;
+        if (!eina_binbuf_length_get(tail))
+          {
+             ok = _cnp_stream_emit(st, thread, piece->data, piece->size,
+                                   &pos, final);
+             if ((ok) && (pos < piece->size))
+               eina_binbuf_append_length(tail,
+                                         (unsigned char *)piece->data + pos,
+                                         piece->size - pos);
+          }
+        else
+          {
+             eina_binbuf_append_length(tail, (unsigned char *)piece->data,
+                                       piece->size);
+             ok = _cnp_stream_emit(st, thread,
+                                   (const char *)eina_binbuf_string_get(tail),
+                                   eina_binbuf_length_get(tail), &pos, final);
+             eina_binbuf_remove(tail, 0, pos);
+          }
+
+        eina_lock_take(&st->lock);
+        st->used = eina_list_append(st->used, piece);
+        eina_lock_release(&st->lock);
+        if (final) break;
+     }
+   // completed with the tail waiting for a piece that never came
+   if ((ok) && (!piece) && (eina_binbuf_length_get(tail)))
+     {
+        pos = 0;
+        _cnp_stream_emit(st, thread,
+                         (const char *)eina_binbuf_string_get(tail),
+                         eina_binbuf_length_get(tail), &pos, EINA_TRUE);
+     }
+   eina_binbuf_free(tail);
+}
+
+// pieces go back to the main loop once streamed, where they are released
+static void
+_cnp_stream_used_free(Cnp_Stream *st)
+{
+   Eina_List *used;
+   Cnp_Buf *piece;
+
+   eina_lock_take(&st->lock);
+   used = st->used;
+   st->used = NULL;
+   eina_lock_release(&st->lock);
+   EINA_LIST_FREE(used, piece)
+     _cnp_buf_unref(piece);
+}
+
+static void
+_cnp_stream_notify(void *data, Ecore_Thread *thread EINA_UNUSED, void *msg)
+{
+   Cnp_Stream *st = data;
+   Cnp_Stream_Chunk *chunk = msg;
+   Elm_Selection_Data ev;
+
+   if ((!st->stop) && (st->obj))
+     {
+        ev.x = st->x;
+        ev.y = st->y;
+        ev.format = chunk->format;
+        ev.data = chunk->data;
+        ev.len = chunk->len;
+        ev.action = st->action;
+        if (!st->func(st->data, st->obj, &ev, EINA_FALSE))
+          _cnp_stream_stop(st);
+     }
+   free(chunk->data);
+   free(chunk);
+   _cnp_stream_used_free(st);
+
+   eina_lock_take(&st->lock);
+   st->inflight--;
+   eina_condition_signal(&st->cond);
+   eina_lock_release(&st->lock);
+}
+
+static void _cnp_stream_obj_del(void *data, Evas *e, Evas_Object *obj, void *info);
+
+static void
+_cnp_stream_free(Cnp_Stream *st)
+{
+   Cnp_Buf *piece;
+
+   _cnp_streams = eina_list_remove(_cnp_streams, st);
+   if (st->obj)
+     evas_object_event_callback_del_full
+       (st->obj, EVAS_CALLBACK_DEL, _cnp_stream_obj_del, st);
+   _cnp_stream_used_free(st);
+   EINA_LIST_FREE(st->pieces, piece)
+     _cnp_buf_unref(piece);
+   eina_condition_free(&st->cond);
+   eina_lock_free(&st->lock);
+   free(st);
+}
+
+static void
+_cnp_stream_end(void *data, Ecore_Thread *thread EINA_UNUSED)
+{
+   Cnp_Stream *st = data;
+   Elm_Selection_Data ev;
+
+   if ((!st->stop) && (st->obj))
+     {
+        ev.x = st->x;
+        ev.y = st->y;
+        ev.format = _cnp_stream_format(st);
+        ev.data = NULL;
+        ev.len = 0;
+        ev.action = st->action;
+        st->func(st->data, st->obj, &ev, EINA_TRUE);
+     }
+   _cnp_stream_free(st);
+}
+
+static void
+_cnp_stream_obj_del(void *data, Evas *e EINA_UNUSED,
+                    Evas_Object *obj EINA_UNUSED, void *info EINA_UNUSED)
+{
+   Cnp_Stream *st = data;
+
+   st->obj = NULL;
+   if (st->started) _cnp_stream_stop(st);
+   else _cnp_stream_free(st);
+}
+
+static Cnp_Stream *
+_cnp_stream_new(const Evas_Object *obj, Elm_Sel_Format convert,
+                Elm_Selection_Stream_Cb func, void *data)
+{
+   Cnp_Stream *st;
+
+   st = calloc(1, sizeof(Cnp_Stream));
+   if (!st) return NULL;
+   st->obj = (Evas_Object *)obj;
+   st->func = func;
+   st->data = data;
+   st->convert = convert;
+   st->action = ELM_XDND_ACTION_UNKNOWN;
+   eina_lock_new(&st->lock);
+   eina_condition_new(&st->cond, &st->lock);
+   evas_object_event_callback_add
+     (st->obj, EVAS_CALLBACK_DEL, _cnp_stream_obj_del, st);
+   _cnp_streams = eina_list_append(_cnp_streams, st);
+   return st;
+}
+
+// takes over the reference on buf, pieces are streamed in order
+static void
+_cnp_stream_feed(Cnp_Stream *st, Cnp_Buf *buf)
+{
+   if (!buf) return;
+   eina_lock_take(&st->lock);
+   st->pieces = eina_list_append(st->pieces, buf);
+   eina_condition_signal(&st->cond);
+   eina_lock_release(&st->lock);
+}
+
+static void
+_cnp_stream_start(Cnp_Stream *st, Elm_Sel_Format format)
+{
+   st->format = format;
+   st->started = EINA_TRUE;
+   // on failure the end callback is called right away, freeing st
+   ecore_thread_feedback_run(_cnp_stream_run, _cnp_stream_notify,
+                             _cnp_stream_end, _cnp_stream_end,
+                             st, EINA_FALSE);
+}
+
+static void
+_cnp_stream_complete(Cnp_Stream *st)
+{
+   eina_lock_take(&st->lock);
+   st->complete = EINA_TRUE;
+   eina_condition_signal(&st->cond);
+   eina_lock_release(&st->lock);
+}
+
+// the data is given whole at once, stream it from there
+static Eina_Bool
+_cnp_stream_whole_cb(void *data, Evas_Object *obj EINA_UNUSED,
+                     Elm_Selection_Data *ev)
+{
+   Cnp_Stream *st = data;
+
+   if (!eina_list_data_find(_cnp_streams, st)) return EINA_FALSE;
+   if (st->started) return EINA_FALSE;
+   st->x = ev->x;
+   st->y = ev->y;
+   st->action = ev->action;
+   if (ev->data) _cnp_stream_feed(st, _cnp_buf_new(ev->data, ev->len));
+   _cnp_stream_complete(st);
+   _cnp_stream_start(st, ev->format);
+   return EINA_TRUE;
+}
+
+// the data comes in pieces as it is read, each one is streamed on as it
+// comes, until _cnp_stream_pieces_end()
+static Eina_Bool
+_cnp_stream_piece_cb(void *data, Evas_Object *obj EINA_UNUSED,
+                     Elm_Selection_Data *ev)
+{
+   Cnp_Stream *st = data;
+
+   if (!eina_list_data_find(_cnp_streams, st)) return EINA_FALSE;
+   if (st->complete) return EINA_FALSE;
+   if ((ev->data) && (ev->len > 0))
+     _cnp_stream_feed(st, _cnp_buf_new(ev->data, ev->len));
+   if (st->started) return EINA_TRUE;
+   st->x = ev->x;
+   st->y = ev->y;
+   st->action = ev->action;
+   _cnp_stream_start(st, ev->format);
+   return EINA_TRUE;
+}
+
 ////////////////////////////////////////////////////////////////////////////
 // for local (Within 1 app/process) cnp (used by fb as fallback
 ////////////////////////////////////////////////////////////////////////////
@@ -3736,10 +4391,7 @@ typedef struct _Local_Selinfo Local_Selinfo;
 struct _Local_Selinfo
 {
    Elm_Sel_Format format;
-   struct {
-      char *buf;
-      size_t size;
-   } sel;
+   Cnp_Buf *sel;
    struct {
       Evas_Object *obj;
       Elm_Drop_Cb func;
@@ -3788,8 +4440,8 @@ _local_get_job(void *data)
    ev.x = 0;
    ev.y = 0;
    ev.format = info->format;
-   ev.data = info->sel.buf;
-   ev.len = info->sel.size;
+   ev.data = info->sel ? info->sel->data : NULL;
+   ev.len = info->sel ? info->sel->size : 0;
    ev.action = ELM_XDND_ACTION_UNKNOWN;
    if (info->get.func)
      info->get.func(info->get.data, info->get.obj, &ev);
@@ -3812,17 +4464,10 @@ _local_elm_cnp_selection_set(Evas_Object *obj EINA_UNUSED,
                              const void *selbuf, size_t buflen)
 {
    _local_elm_cnp_init();
-   free(_local_selinfo[selection].sel.buf);
+   // streams still reading the previous data keep their reference
+   _cnp_buf_unref(_local_selinfo[selection].sel);
    _local_selinfo[selection].format = format;
-   _local_selinfo[selection].sel.buf = malloc(buflen + 1);
-   if (_local_selinfo[selection].sel.buf)
-     {
-        memcpy(_local_selinfo[selection].sel.buf, selbuf, buflen);
-        _local_selinfo[selection].sel.buf[buflen] = 0;
-        _local_selinfo[selection].sel.size = buflen;
-     }
-   else
-     _local_selinfo[selection].sel.size = 0;
+   _local_selinfo[selection].sel = _cnp_buf_new(selbuf, buflen);
    return EINA_TRUE;
 }
 
@@ -3842,11 +4487,19 @@ _local_elm_object_cnp_selection_clear(Evas_Object *obj EINA_UNUSED,
                                       Elm_Sel_Type selection)
 {
    _local_elm_cnp_init();
-   ELM_SAFE_FREE(_local_selinfo[selection].sel.buf, free);
-   _local_selinfo[selection].sel.size = 0;
+   ELM_SAFE_FREE(_local_selinfo[selection].sel, _cnp_buf_unref);
    return EINA_TRUE;
 }
 
+static void
+_local_elm_cnp_selection_stream_get(Cnp_Stream *st, Elm_Sel_Type selection)
+{
+   _local_elm_cnp_init();
+   _cnp_stream_feed(st, _cnp_buf_ref(_local_selinfo[selection].sel));
+   _cnp_stream_complete(st);
+   _cnp_stream_start(st, _local_selinfo[selection].format);
+}
+
 static Eina_Bool
 _local_elm_cnp_selection_get(const Evas_Object *obj,
                              Elm_Sel_Type selection,
@@ -3913,6 +4566,7 @@ _local_elm_drop_target_del(Evas_Object *obj, Elm_Sel_Format format,
         if (!dropable->cbs_list)
           {
              drops = eina_list_remove(drops, dropable);
+             _drop_index_del(dropable);
              eo_key_data_del(obj, "__elm_dropable");
              free(dropable);
              dropable = NULL;
@@ -3961,7 +4615,7 @@ static Eina_Bool
 _local_elm_selection_selection_has_owner(Evas_Object *obj EINA_UNUSED)
 {
    _local_elm_cnp_init();
-   if (_local_selinfo[ELM_SEL_TYPE_CLIPBOARD].sel.buf) return EINA_TRUE;
+   if (_local_selinfo[ELM_SEL_TYPE_CLIPBOARD].sel) return EINA_TRUE;
    return EINA_FALSE;
 }
 #endif
@@ -4518,6 +5172,111 @@ elm_cnp_selection_get(const Evas_Object *obj, Elm_Sel_Type selection,
    return _local_elm_cnp_selection_get(obj, selection, format, datacb, udata);
 }
 
+EAPI Eina_Bool
+elm_cnp_selection_stream_get(const Evas_Object *obj, Elm_Sel_Type selection,
+                             Elm_Sel_Format format, Elm_Sel_Format convert,
+                             Elm_Selection_Stream_Cb chunkcb, void *udata)
+{
+   Elm_Drop_Cb datacb = _cnp_stream_whole_cb;
+   Cnp_Stream *st;
+   Eina_Bool local = EINA_TRUE;
+
+   if (selection > ELM_SEL_TYPE_CLIPBOARD) return EINA_FALSE;
+   EINA_SAFETY_ON_NULL_RETURN_VAL(obj, EINA_FALSE);
+   EINA_SAFETY_ON_NULL_RETURN_VAL(chunkcb, EINA_FALSE);
+   if (!_elm_cnp_init_count) _elm_cnp_init();
+#ifdef HAVE_ELEMENTARY_X
+   if (_x11_elm_widget_xwin_get(obj)) local = EINA_FALSE;
+#endif
+#ifdef HAVE_ELEMENTARY_WL2
+   if (_wl_elm_widget_window_get(obj)) local = EINA_FALSE;
+#endif
+#ifdef HAVE_ELEMENTARY_COCOA
+   if (_cocoa_elm_widget_cocoa_window_get(obj)) local = EINA_FALSE;
+#endif
+#ifdef HAVE_ELEMENTARY_WIN32
+   if (_win32_elm_widget_window_get(obj)) local = EINA_FALSE;
+#endif
+
+   st = _cnp_stream_new(obj, convert, chunkcb, udata);
+   if (!st) return EINA_FALSE;
+   if (local)
+     {
+        _local_elm_cnp_selection_stream_get(st, selection);
+        return EINA_TRUE;
+     }
+#ifdef HAVE_ELEMENTARY_WL2
+   /* Wayland gives the data in pieces, as it reads them */
+   if (_wl_elm_widget_window_get(obj))
+     {
+        st->open = EINA_TRUE;
+        datacb = _cnp_stream_piece_cb;
+     }
+#endif
+   if (!elm_cnp_selection_get(obj, selection, format, datacb, st))
+     {
+        _cnp_stream_free(st);
+        return EINA_FALSE;
+     }
+   return EINA_TRUE;
+}
+
+Eina_Bool
+_elm_cnp_selection_data_stream(Evas_Object *obj, Elm_Selection_Data *ev,
+                               Elm_Sel_Format convert,
+                               Elm_Selection_Stream_Cb chunkcb, void *udata)
+{
+   Cnp_Stream *st;
+
+   EINA_SAFETY_ON_NULL_RETURN_VAL(obj, EINA_FALSE);
+   EINA_SAFETY_ON_NULL_RETURN_VAL(ev, EINA_FALSE);
+#ifdef HAVE_ELEMENTARY_WL2
+   /* Wayland gives drops in pieces too */
+   if (_wl_elm_widget_window_get(obj))
+     return _elm_cnp_selection_piece_stream(obj, ev, convert, chunkcb, udata);
+#endif
+   st = _cnp_stream_new(obj, convert, chunkcb, udata);
+   if (!st) return EINA_FALSE;
+   return _cnp_stream_whole_cb(st, obj, ev);
+}
+
+Eina_Bool
+_elm_cnp_selection_piece_stream(Evas_Object *obj, Elm_Selection_Data *ev,
+                                Elm_Sel_Format convert,
+                                Elm_Selection_Stream_Cb chunkcb, void *udata)
+{
+   Eina_List *l;
+   Cnp_Stream *st;
+
+   EINA_SAFETY_ON_NULL_RETURN_VAL(obj, EINA_FALSE);
+   EINA_SAFETY_ON_NULL_RETURN_VAL(ev, EINA_FALSE);
+   EINA_LIST_FOREACH(_cnp_streams, l, st)
+     {
+        if ((st->obj == obj) && (st->open) && (!st->complete) &&
+            (st->func == chunkcb) && (st->data == udata))
+          return _cnp_stream_piece_cb(st, obj, ev);
+     }
+   st = _cnp_stream_new(obj, convert, chunkcb, udata);
+   if (!st) return EINA_FALSE;
+   st->open = EINA_TRUE;
+   return _cnp_stream_piece_cb(st, obj, ev);
+}
+
+void
+_elm_cnp_selection_pieces_end(const Evas_Object *obj)
+{
+   Eina_List *l, *ll;
+   Cnp_Stream *st;
+
+   EINA_LIST_FOREACH_SAFE(_cnp_streams, l, ll, st)
+     {
+        if ((st->obj != obj) || (!st->open) || (st->complete)) continue;
+        _cnp_stream_complete(st);
+        /* no piece came at all, only the end is told */
+        if (!st->started) _cnp_stream_start(st, ELM_SEL_FORMAT_TEXT);
+     }
+}
+
 ////////////////////////////////////////////////////////////////////////////
 
 /**
@@ -4652,6 +5411,20 @@ _drop_item_container_cmp(const void *d1,
    return (((uintptr_t) (st->obj)) - ((uintptr_t) d2));
 }
 
+static void
+_drop_item_container_hit_reset(Item_Container_Drop_Info *st)
+{
+   if (st->hit.it) eo_wref_del(st->hit.it, &st->hit.it);
+   st->hit.it = NULL;
+   st->hit.valid = EINA_FALSE;
+}
+
+static void
+_drop_item_container_render_post_cb(void *data, Evas *e EINA_UNUSED, void *info EINA_UNUSED)
+{  /* Items may have moved, look them up again */
+   _drop_item_container_hit_reset(data);
+}
+
 static void
 _elm_item_container_pos_cb(void *data, Evas_Object *obj, Evas_Coord x, Evas_Coord y, Elm_Xdnd_Action action)
 {  /* obj is the container pointer */
@@ -4667,14 +5440,47 @@ _elm_item_container_pos_cb(void *data, Evas_Object *obj, Evas_Coord x, Evas_Coor
         int xo = 0;
         int yo = 0;
 
-        evas_object_geometry_get(obj, &xo, &yo, NULL, NULL);
-        if (st->itemgetcb)
-          it = st->itemgetcb(obj, x+xo, y+yo, &xposret, &yposret);
+        if ((st->hit.valid) && (st->hit.x == x) && (st->hit.y == y) &&
+            ((st->hit.it) || (!st->hit.found)))
+          {  /* Same motion frame, same spot */
+             it = st->hit.it;
+             xposret = st->hit.xposret;
+             yposret = st->hit.yposret;
+          }
+        else if (st->itemgetcb)
+          {
+             evas_object_geometry_get(obj, &xo, &yo, NULL, NULL);
+             it = st->itemgetcb(obj, x+xo, y+yo, &xposret, &yposret);
+
+             _drop_item_container_hit_reset(st);
+             st->hit.x = x;
+             st->hit.y = y;
+             st->hit.xposret = xposret;
+             st->hit.yposret = yposret;
+             st->hit.found = !!it;
+             st->hit.valid = EINA_TRUE;
+             if (it) eo_wref_add(it, &st->hit.it);
+          }
 
         st->poscb(data, obj, it, x, y, xposret, yposret, action);
      }
 }
 
+/* Test only: a drag position over an item container, in canvas
+ * coordinates, as its drop target would get it from the backends */
+void
+_elm_drop_item_container_pos(Evas_Object *obj, Evas_Coord x, Evas_Coord y,
+                             Elm_Xdnd_Action action)
+{
+   Item_Container_Drop_Info *st =
+      eina_list_search_unsorted(cont_drop_tg, _drop_item_container_cmp, obj);
+   Evas_Coord ox, oy;
+
+   if (!st) return;
+   evas_object_geometry_get(obj, &ox, &oy, NULL, NULL);
+   _elm_item_container_pos_cb(st->posdata, obj, x - ox, y - oy, action);
+}
+
 static Eina_Bool
 _elm_item_container_drop_cb(void *data, Evas_Object *obj , Elm_Selection_Data *ev)
 {  /* obj is the container pointer */
@@ -4713,9 +5519,14 @@ elm_drop_item_container_del_internal(Evas_Object *obj, Eina_Bool full)
         st->itemgetcb= NULL;
         st->poscb = NULL;
         st->dropcb = NULL;
+        _drop_item_container_hit_reset(st);
 
         if (full)
           {
+             evas_event_callback_del_full(evas_object_evas_get(obj),
+                                          EVAS_CALLBACK_RENDER_POST,
+                                          _drop_item_container_render_post_cb,
+                                          st);
              cont_drop_tg = eina_list_remove(cont_drop_tg, st);
              free(st);
           }
@@ -4755,10 +5566,14 @@ elm_drop_item_container_add(Evas_Object *obj,
 
         st->obj = obj;
         cont_drop_tg = eina_list_append(cont_drop_tg, st);
+        evas_event_callback_add(evas_object_evas_get(obj),
+                                EVAS_CALLBACK_RENDER_POST,
+                                _drop_item_container_render_post_cb, st);
      }
 
    st->itemgetcb = itemgetcb;
    st->poscb = poscb;
+   st->posdata = posdata;
    st->dropcb = dropcb;
    elm_drop_target_add(obj, format,
                        entercb, enterdata,
@@ -116,6 +116,21 @@ typedef struct _Elm_Selection_Data Elm_Selection_Data;
  */
 typedef Eina_Bool (*Elm_Drop_Cb)(void *data, Evas_Object *obj, Elm_Selection_Data *ev);
 
+/**
+ * Callback invoked for each chunk of a streamed selection.
+ *
+ * @param data Application specific data
+ * @param obj The object the selection was asked for
+ * @param ev The chunk. Its data is nul terminated and only valid during
+ *        the call.
+ * @param last @c EINA_TRUE for the final call, which carries no data
+ * @return @c EINA_FALSE to stop the transfer, the callback is then not
+ *         called again.
+ * @see elm_cnp_selection_stream_get()
+ * @since 1.18
+ */
+typedef Eina_Bool (*Elm_Selection_Stream_Cb)(void *data, Evas_Object *obj, Elm_Selection_Data *ev, Eina_Bool last);
+
 /**
  * Callback invoked to find out what object is under (x,y) coords
  *
@@ -241,6 +256,39 @@ EAPI Eina_Bool elm_cnp_selection_get(const Evas_Object *obj, Elm_Sel_Type select
                                      Elm_Sel_Format format,
                                      Elm_Drop_Cb datacb, void *udata);
 
+/**
+ * @brief Get data from a selection in chunks.
+ *
+ * Like elm_cnp_selection_get(), but the data is given to @p chunkcb a
+ * piece at a time from the main loop, so converting a large paste does
+ * not hold the loop. Chunks are cut and converted on a worker thread, a
+ * few of them ahead of the callback. Text is never cut inside a
+ * character, and markup never inside a tag or an escape, so each chunk
+ * can be used on its own.
+ *
+ * Within the process the selection is read where it is stored, without
+ * a copy. The windowing systems give their data whole, or on Wayland in
+ * pieces as it is read, each streamed on as it comes: it is copied once
+ * more before being streamed, and on X11 it is still received and
+ * prepared on the main loop. The transfer stops if @p obj is deleted.
+ *
+ * @param obj The target widget
+ * @param selection Selection type for copying and pasting
+ * @param format Selection format
+ * @param convert @c ELM_SEL_FORMAT_MARKUP to get text as markup,
+ *        @c ELM_SEL_FORMAT_TEXT to get markup as plain text, or
+ *        @c ELM_SEL_FORMAT_NONE to get the data as it is
+ * @param chunkcb The callback getting the chunks
+ * @param udata The user data pointer for @p chunkcb
+ * @return If @c EINA_TRUE, the transfer was started.
+ *
+ * @ingroup CopyPaste
+ * @since 1.18
+ */
+EAPI Eina_Bool elm_cnp_selection_stream_get(const Evas_Object *obj, Elm_Sel_Type selection,
+                                            Elm_Sel_Format format, Elm_Sel_Format convert,
+                                            Elm_Selection_Stream_Cb chunkcb, void *udata);
+
 /**
  * @brief Clear the selection data of a widget.
  *
@@ -404,6 +404,7 @@ _desc_init(void)
    ELM_CONFIG_VAL(D, T, scroll_smooth_start_enable, T_UCHAR);
    ELM_CONFIG_VAL(D, T, scroll_animation_disable, T_UCHAR);
    ELM_CONFIG_VAL(D, T, scroll_accel_factor, T_DOUBLE);
+   ELM_CONFIG_VAL(D, T, scroll_momentum_predict, T_UCHAR);
 //   ELM_CONFIG_VAL(D, T, scroll_smooth_time_interval, T_DOUBLE); // not used anymore
    ELM_CONFIG_VAL(D, T, scroll_smooth_amount, T_DOUBLE);
 //   ELM_CONFIG_VAL(D, T, scroll_smooth_history_weight, T_DOUBLE); // not used anymore
@@ -433,6 +434,7 @@ _desc_init(void)
    ELM_CONFIG_VAL(D, T, focus_move_policy, T_UCHAR);
    ELM_CONFIG_VAL(D, T, focus_autoscroll_mode, T_UCHAR);
    ELM_CONFIG_VAL(D, T, context_menu_disabled, T_UCHAR);
+   ELM_CONFIG_VAL(D, T, frame_stats, T_UCHAR);
    ELM_CONFIG_VAL(D, T, slider_indicator_visible_mode, T_INT);
    ELM_CONFIG_VAL(D, T, item_select_on_focus_disable, T_UCHAR);
    ELM_CONFIG_VAL(D, T, first_item_focus_on_first_focus_in, T_UCHAR);
@@ -1729,6 +1731,7 @@ _config_load(void)
    _elm_config->scroll_smooth_start_enable = EINA_TRUE;
    _elm_config->scroll_animation_disable = EINA_FALSE;
    _elm_config->scroll_accel_factor = 7.0;
+   _elm_config->scroll_momentum_predict = EINA_FALSE;
 //   _elm_config->scroll_smooth_time_interval = 0.008; // not used anymore
    _elm_config->scroll_smooth_amount = 1.0;
 //   _elm_config->scroll_smooth_history_weight = 0.3; // not used anymore
@@ -1766,6 +1769,7 @@ _config_load(void)
    _elm_config->effect_enable = EINA_TRUE;
    _elm_config->desktop_entry = EINA_FALSE;
    _elm_config->context_menu_disabled = EINA_FALSE;
+   _elm_config->frame_stats = EINA_FALSE;
    _elm_config->is_mirrored = EINA_FALSE; /* Read sys value in env_get() */
    _elm_config->password_show_last = EINA_FALSE;
    _elm_config->password_show_last_timeout = 2.0;
@@ -2314,6 +2318,8 @@ _env_get(void)
    if (s) _elm_config->scroll_animation_disable = !!atoi(s);
    s = getenv("ELM_SCROLL_ACCEL_FACTOR");
    if (s) _elm_config->scroll_accel_factor = atof(s);
+   s = getenv("ELM_SCROLL_MOMENTUM_PREDICT");
+   if (s) _elm_config->scroll_momentum_predict = !!atoi(s);
 //   s = getenv("ELM_SCROLL_SMOOTH_TIME_INTERVAL"); // not used anymore
 //   if (s) _elm_config->scroll_smooth_time_interval = atof(s); // not used anymore
    s = getenv("ELM_SCROLL_SMOOTH_AMOUNT");
@@ -2474,6 +2480,9 @@ _env_get(void)
    s = getenv("ELM_CONTEXT_MENU_DISABLED");
    if (s) _elm_config->context_menu_disabled = !!atoi(s);
 
+   s = getenv("ELM_FRAME_STATS");
+   if (s) _elm_config->frame_stats = !!atoi(s);
+
    s = getenv("ELM_LONGPRESS_TIMEOUT");
    if (s) _elm_config->longpress_timeout = _elm_atof(s);
    if (_elm_config->longpress_timeout < 0.0)
@@ -3364,6 +3373,18 @@ elm_config_scroll_accel_factor_get(void)
    return _elm_config->scroll_accel_factor;
 }
 
+EAPI void
+elm_config_scroll_momentum_predict_set(Eina_Bool enable)
+{
+   _elm_config->scroll_momentum_predict = !!enable;
+}
+
+EAPI Eina_Bool
+elm_config_scroll_momentum_predict_get(void)
+{
+   return _elm_config->scroll_momentum_predict;
+}
+
 EAPI void
 elm_config_scroll_thumbscroll_smooth_amount_set(double amount)
 {
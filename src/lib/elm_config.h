@@ -675,6 +675,39 @@ EAPI double       elm_config_scroll_accel_factor_get(void);
  */
 EAPI void         elm_config_scroll_accel_factor_set(double factor);
 
+/**
+ * Get whether flick momentum uses the predictive scroll engine
+ *
+ * @return EINA_TRUE if the predictive engine is in use
+ *
+ * @see elm_config_scroll_momentum_predict_set()
+ *
+ * @since 1.18
+ * @ingroup Elm_Scrolling
+ */
+EAPI Eina_Bool    elm_config_scroll_momentum_predict_get(void);
+
+/**
+ * Set whether flick momentum uses the predictive scroll engine
+ *
+ * The predictive engine keeps a timestamped ring of the input samples of a
+ * drag and fits the flick velocity to them by least squares, instead of
+ * averaging the last few samples. While the flick runs, the content
+ * position is computed for the time the frame will be presented rather
+ * than the time of the animator tick, and the position expected for the
+ * frame after that is published, so scrollable widgets can prepare the
+ * content that is about to become visible. This gives evenly spaced
+ * steps on high refresh rate displays.
+ *
+ * @param enable The enabled state of the predictive engine
+ *
+ * @see elm_config_scroll_momentum_predict_get()
+ *
+ * @since 1.18
+ * @ingroup Elm_Scrolling
+ */
+EAPI void         elm_config_scroll_momentum_predict_set(Eina_Bool enable);
+
 /**
  * Get the amount of smoothing to apply to scrolling
  *
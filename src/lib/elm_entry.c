@@ -22,6 +22,9 @@
  * and to a big value for better computers. */
 #define ELM_ENTRY_CHUNK_SIZE 10000
 #define ELM_ENTRY_DELAY_WRITE_TIME 2.0
+/* paragraphs per height sum in windowed mode */
+#define ELM_ENTRY_DOC_BLOCK 256
+#define ELM_ENTRY_FILTER_RUN_MAX 8
 
 #define ELM_PRIV_ENTRY_SIGNALS(cmd) \
    cmd(SIG_ABORTED, "aborted", "") \
@@ -59,6 +62,13 @@
 
 ELM_PRIV_ENTRY_SIGNALS(ELM_PRIV_STATIC_VARIABLE_DECLARE);
 
+static void _entry_doc_update(Evas_Object *obj, Elm_Entry_Data *sd, Eina_Bool force);
+static void _entry_doc_invalidate(Elm_Entry_Doc *doc);
+static void _sizing_eval_queue(Evas_Object *obj, Elm_Entry_Data *sd, Eina_Bool chrome);
+static void _sizing_eval_now(Evas_Object *obj, Elm_Entry_Data *sd);
+static void _entry_new_line_filter_cb(void *data, Evas_Object *entry, char **text);
+static void _entry_len_user_change(Elm_Entry_Data *sd, const Edje_Entry_Change_Info *info);
+
 #define ENTRY_PASSWORD_MASK_CHARACTER 0x002A
 
 static const Evas_Smart_Cb_Description _smart_callbacks[] = {
@@ -304,6 +314,32 @@ _validate(Evas_Object *obj)
    eina_strbuf_free(buf);
 }
 
+static void
+_filter_set_compile(Elm_Entry_Markup_Filter *tf,
+                    const char *set)
+{
+   int idx, c;
+
+   idx = evas_string_char_next_get(set, 0, &c);
+   while (c)
+     {
+        if (c < 128)
+          tf->ascii[c >> 3] |= 1 << (c & 7);
+        else
+          {
+             Eina_Unicode *tmp;
+
+             tmp = realloc(tf->set, (tf->set_len + 1) * sizeof(Eina_Unicode));
+             if (tmp)
+               {
+                  tf->set = tmp;
+                  tf->set[tf->set_len++] = c;
+               }
+          }
+        idx = evas_string_char_next_get(set, idx, &c);
+     }
+}
+
 static Elm_Entry_Markup_Filter *
 _filter_new(Elm_Entry_Filter_Cb func,
             void *data)
@@ -334,6 +370,7 @@ _filter_new(Elm_Entry_Filter_Cb func,
           }
         memcpy(lim2, lim, sizeof(Elm_Entry_Filter_Limit_Size));
         tf->data = lim2;
+        tf->kind = ELM_ENTRY_FILTER_LIMIT_SIZE;
      }
    else if (func == elm_entry_filter_accept_set)
      {
@@ -361,9 +398,19 @@ _filter_new(Elm_Entry_Filter_Cb func,
         else
           as2->rejected = NULL;
         tf->data = as2;
+        tf->kind = ELM_ENTRY_FILTER_ACCEPT_SET;
+        tf->goes_in = !!as2->accepted;
+        if (as2->accepted)
+          _filter_set_compile(tf, as2->accepted);
+        else if (as2->rejected)
+          _filter_set_compile(tf, as2->rejected);
      }
    else
-     tf->data = data;
+     {
+        tf->data = data;
+        if (func == _entry_new_line_filter_cb)
+          tf->kind = ELM_ENTRY_FILTER_NEW_LINE;
+     }
    return tf;
 }
 
@@ -388,6 +435,7 @@ _filter_free(Elm_Entry_Markup_Filter *tf)
              free(as);
           }
      }
+   free(tf->set);
    free(tf);
 }
 
@@ -640,59 +688,176 @@ _edje_entry_user_insert(Evas_Object *obj, const char *data)
 
    sd->changed = EINA_TRUE;
    edje_object_part_text_user_insert(sd->entry_edje, "elm.text", data);
-   elm_layout_sizing_eval(obj);
+   _sizing_eval_queue(obj, sd, EINA_FALSE);
 }
 
-static Eina_Bool
-_selection_data_cb(void *data EINA_UNUSED,
-                   Evas_Object *obj,
-                   Elm_Selection_Data *sel_data)
+/* Edje tells the chunk like any user insert, from its message queue */
+static void
+_paste_chunk_user_insert(Evas_Object *obj,
+                         Elm_Entry_Data *sd,
+                         const char *markup)
 {
-   char *buf;
+   sd->paste.queued = eina_list_append(sd->paste.queued,
+                                       eina_stringshare_add(markup));
+   _edje_entry_user_insert(obj, markup);
+}
 
-   if (!sel_data->data) return EINA_FALSE;
-   ELM_ENTRY_DATA_GET(obj, sd);
+/* Pasted and dropped data comes in chunks, text already converted to
+ * markup off the main loop. Each chunk is a user insert: the first goes
+ * in at the cursor, replacing the selection, and the later ones right
+ * after it, wherever the user moved the cursor or typed meanwhile. Their
+ * "changed,user" are told as one, once the last chunk is in. */
+static void
+_paste_chunk_insert(Evas_Object *obj,
+                    Elm_Entry_Data *sd,
+                    const char *markup)
+{
+   int pos, at, after;
 
-   buf = malloc(sel_data->len + 1);
-   if (!buf)
+   if (!sd->paste.cur)
      {
-        ERR("Failed to allocate memory, obj: %p", obj);
-        return EINA_FALSE;
+        sd->paste.cur = evas_object_textblock_cursor_new
+            (edje_object_part_object_get(sd->entry_edje, "elm.text"));
+        if (!sd->paste.content) sd->paste.content = eina_strbuf_new();
+        _paste_chunk_user_insert(obj, sd, markup);
+        evas_textblock_cursor_pos_set
+          (sd->paste.cur, edje_object_part_text_cursor_pos_get
+            (sd->entry_edje, "elm.text", EDJE_CURSOR_MAIN));
+        return;
+     }
+
+   /* the textblock keeps paste.cur in place through the user's edits */
+   pos = edje_object_part_text_cursor_pos_get
+       (sd->entry_edje, "elm.text", EDJE_CURSOR_MAIN);
+   at = evas_textblock_cursor_pos_get(sd->paste.cur);
+   edje_object_part_text_select_none(sd->entry_edje, "elm.text");
+   if (pos != at)
+     edje_object_part_text_cursor_pos_set
+       (sd->entry_edje, "elm.text", EDJE_CURSOR_MAIN, at);
+   _paste_chunk_user_insert(obj, sd, markup);
+   after = edje_object_part_text_cursor_pos_get
+       (sd->entry_edje, "elm.text", EDJE_CURSOR_MAIN);
+   evas_textblock_cursor_pos_set(sd->paste.cur, after);
+   if (pos != at)
+     {
+        if (pos > at) pos += after - at;
+        edje_object_part_text_cursor_pos_set
+          (sd->entry_edje, "elm.text", EDJE_CURSOR_MAIN, pos);
      }
-   memcpy(buf, sel_data->data, sel_data->len);
-   buf[sel_data->len] = '\0';
+}
+
+/* The whole paste as one insert, once the user signals of all its
+ * chunks came */
+static void
+_paste_changed_user_emit(Evas_Object *obj,
+                         Elm_Entry_Data *sd)
+{
+   Elm_Entry_Change_Info info;
+
+   if ((!sd->paste.ended) || (sd->paste.queued)) return;
+   sd->paste.ended = EINA_FALSE;
+   if ((!sd->paste.content) || (!eina_strbuf_length_get(sd->paste.content)))
+     return;
+
+   memset(&info, 0, sizeof(info));
+   info.insert = EINA_TRUE;
+   info.change.insert.pos = sd->paste.pos;
+   info.change.insert.plain_length = sd->paste.plain_length;
+   info.change.insert.content =
+     eina_stringshare_add(eina_strbuf_string_get(sd->paste.content));
+   eina_strbuf_reset(sd->paste.content);
+   sd->paste.plain_length = 0;
+   eo_event_callback_call(obj, ELM_ENTRY_EVENT_CHANGED_USER, &info);
+   eina_stringshare_del(info.change.insert.content);
+}
+
+/* Takes the user signal of a chunk into the paste, false when the signal
+ * is not for one */
+static Eina_Bool
+_paste_chunk_signal(Elm_Entry_Data *sd,
+                    const Edje_Entry_Change_Info *info)
+{
+   const char *content = eina_list_data_get(sd->paste.queued);
+
+   if ((!info) || (!info->insert) || (!content) ||
+       (content != info->change.insert.content))
+     return EINA_FALSE;
+
+   sd->paste.queued = eina_list_remove_list(sd->paste.queued,
+                                            sd->paste.queued);
+   eina_stringshare_del(content);
+   if (!eina_strbuf_length_get(sd->paste.content))
+     sd->paste.pos = info->change.insert.pos;
+   eina_strbuf_append(sd->paste.content, info->change.insert.content);
+   sd->paste.plain_length += info->change.insert.plain_length;
+   return EINA_TRUE;
+}
+
+static void
+_paste_end(Evas_Object *obj,
+           Elm_Entry_Data *sd)
+{
+   if (!sd->paste.cur) return;
+
+   ELM_SAFE_FREE(sd->paste.cur, evas_textblock_cursor_free);
+   sd->paste.ended = EINA_TRUE;
+   _paste_changed_user_emit(obj, sd);
+}
+
+static Eina_Bool
+_selection_stream_cb(void *data EINA_UNUSED,
+                     Evas_Object *obj,
+                     Elm_Selection_Data *sel_data,
+                     Eina_Bool last)
+{
+   ELM_ENTRY_DATA_GET(obj, sd);
 
    if ((sel_data->format & ELM_SEL_FORMAT_IMAGE) &&
        (sd->cnp_mode != ELM_CNP_MODE_NO_IMAGE))
      {
-        char *entry_tag;
-        int len;
         static const char *tag_string =
            "<item absize=240x180 href=file://%s></item>";
+        char *entry_tag;
+        int len;
 
-        len = strlen(tag_string) + strlen(buf);
-        entry_tag = alloca(len + 1);
-        snprintf(entry_tag, len + 1, tag_string, buf);
-        _edje_entry_user_insert(obj, entry_tag);
-     }
-   else if (sel_data->format & ELM_SEL_FORMAT_MARKUP)
-     {
-        _edje_entry_user_insert(obj, buf);
-     }
-   else
-     {
-        char *txt = _elm_util_text_to_mkup(buf);
-        if (txt)
+        /* a file path, only usable once complete */
+        if (!sd->paste_image) sd->paste_image = eina_strbuf_new();
+        if (sel_data->data)
+          eina_strbuf_append_length
+            (sd->paste_image, sel_data->data, sel_data->len);
+        if (!last) return EINA_TRUE;
+
+        len = strlen(tag_string) + eina_strbuf_length_get(sd->paste_image);
+        entry_tag = malloc(len + 1);
+        if (entry_tag)
           {
-             _edje_entry_user_insert(obj, txt);
-             free(txt);
+             snprintf(entry_tag, len + 1, tag_string,
+                      eina_strbuf_string_get(sd->paste_image));
+             _edje_entry_user_insert(obj, entry_tag);
+             free(entry_tag);
           }
+        ELM_SAFE_FREE(sd->paste_image, eina_strbuf_free);
+     }
+   else if ((sel_data->data) && (sel_data->len > 0))
+     {
+        if (sel_data->format & ELM_SEL_FORMAT_MARKUP)
+          _paste_chunk_insert(obj, sd, sel_data->data);
         else
           {
-             ERR("Failed to convert text to markup text!");
+             char *txt = _elm_util_text_to_mkup(sel_data->data);
+             if (txt)
+               {
+                  _paste_chunk_insert(obj, sd, txt);
+                  free(txt);
+               }
+             else
+               {
+                  ERR("Failed to convert text to markup text!");
+               }
           }
      }
-   free(buf);
+
+   if (last) _paste_end(obj, sd);
 
    return EINA_TRUE;
 }
@@ -711,9 +876,8 @@ _drag_drop_cb(void *data EINA_UNUSED,
 
    if (!rv) WRN("Warning: Failed to position cursor: paste anyway");
 
-   rv = _selection_data_cb(NULL, obj, drop);
-
-   return rv;
+   return _elm_cnp_selection_data_stream
+     (obj, drop, ELM_SEL_FORMAT_MARKUP, _selection_stream_cb, NULL);
 }
 
 static Elm_Sel_Format
@@ -816,7 +980,9 @@ _elm_entry_elm_widget_theme_apply(Eo *obj, Elm_Entry_Data *sd)
 
    _mirrored_set(obj, elm_widget_mirrored_get(obj));
 
-   t = eina_stringshare_add(elm_object_text_get(obj));
+   /* the windowed text is kept aside, only the layout has to be redone */
+   if (!sd->doc) t = eina_stringshare_add(elm_object_text_get(obj));
+   else t = NULL;
 
    elm_widget_theme_object_set
      (obj, sd->entry_edje, "entry", _elm_entry_theme_group_get(obj), style);
@@ -824,8 +990,16 @@ _elm_entry_elm_widget_theme_apply(Eo *obj, Elm_Entry_Data *sd)
    edje_object_part_text_select_allow_set
        (sd->entry_edje, "elm.text", _elm_config->desktop_entry);
 
-   elm_object_text_set(obj, t);
-   eina_stringshare_del(t);
+   if (sd->doc)
+     {
+        _entry_doc_invalidate(sd->doc);
+        _entry_doc_update(obj, sd, EINA_TRUE);
+     }
+   else
+     {
+        elm_object_text_set(obj, t);
+        eina_stringshare_del(t);
+     }
 
    if (elm_widget_disabled_get(obj))
      edje_object_signal_emit(sd->entry_edje, "elm,state,disabled", "elm");
@@ -921,6 +1095,18 @@ _elm_entry_elm_widget_theme_apply(Eo *obj, Elm_Entry_Data *sd)
    return EINA_TRUE;
 }
 
+static void
+_cursor_show(Evas_Object *obj, Elm_Entry_Data *sd)
+{
+   Evas_Coord cx, cy, cw, ch;
+
+   if (!sd->cur_changed) return;
+   sd->cur_changed = EINA_FALSE;
+   edje_object_part_text_cursor_geometry_get
+     (sd->entry_edje, "elm.text", &cx, &cy, &cw, &ch);
+   elm_widget_show_region_set(obj, cx, cy, cw, ch, EINA_FALSE);
+}
+
 static void
 _cursor_geometry_recalc(Evas_Object *obj)
 {
@@ -928,33 +1114,52 @@ _cursor_geometry_recalc(Evas_Object *obj)
 
    eo_event_callback_call(obj, ELM_ENTRY_EVENT_CURSOR_CHANGED, NULL);
 
-   if (!sd->deferred_recalc_job)
+   /* with a size calc pending the cursor geometry is stale, the
+    * region is shown once the calc is done */
+   if (!sd->needs_size_calc) _cursor_show(obj, sd);
+}
+
+static void
+_recalc_count(Elm_Entry_Data *sd)
+{
+   double now = ecore_time_get();
+
+   sd->recalc.count++;
+   sd->recalc.win_count++;
+   if (sd->recalc.win_start <= 0.0)
+     sd->recalc.win_start = now;
+   else if (now - sd->recalc.win_start >= 1.0)
      {
-        Evas_Coord cx, cy, cw, ch;
+        sd->recalc.rate =
+          sd->recalc.win_count / (now - sd->recalc.win_start);
+        sd->recalc.win_start = now;
+        sd->recalc.win_count = 0;
+     }
+}
 
-        edje_object_part_text_cursor_geometry_get
-          (sd->entry_edje, "elm.text", &cx, &cy, &cw, &ch);
-        if (sd->cur_changed)
-          {
-             sd->cur_changed = EINA_FALSE;
-             elm_widget_show_region_set(obj, cx, cy, cw, ch, EINA_FALSE);
-          }
+static void
+_scr_min_get(Elm_Entry_Data *sd, Evas_Coord *vmw, Evas_Coord *vmh)
+{
+   /* the scroller chrome does not depend on the text, so its min size
+    * is only computed again once something else asked for a sizing */
+   if (!sd->scr_min_valid)
+     {
+        sd->scr_mw = sd->scr_mh = 0;
+        edje_object_size_min_calc(sd->scr_edje, &sd->scr_mw, &sd->scr_mh);
+        sd->scr_min_valid = EINA_TRUE;
      }
-   else
-     sd->deferred_cur = EINA_TRUE;
+   *vmw = sd->scr_mw;
+   *vmh = sd->scr_mh;
 }
 
 static void
-_deferred_recalc_job(void *data)
+_wrap_recalc(Evas_Object *obj, Elm_Entry_Data *sd)
 {
    Evas_Coord minh = -1, resw = -1, minw = -1, fw = 0, fh = 0;
 
-   ELM_ENTRY_DATA_GET(data, sd);
-
-   sd->deferred_recalc_job = NULL;
-
    evas_object_geometry_get(sd->entry_edje, NULL, NULL, &resw, NULL);
    edje_object_size_min_restricted_calc(sd->entry_edje, &minw, &minh, resw, 0);
+   _recalc_count(sd);
    elm_coords_finger_size_adjust(1, &minw, 1, &minh);
 
    /* This is a hack to workaround the way min size hints are treated.
@@ -964,7 +1169,7 @@ _deferred_recalc_job(void *data)
      {
         Evas_Coord ominw = -1;
 
-        evas_object_size_hint_min_get(data, &ominw, NULL);
+        evas_object_size_hint_min_get(obj, &ominw, NULL);
         minw = ominw;
      }
 
@@ -972,52 +1177,20 @@ _deferred_recalc_job(void *data)
    sd->ent_mh = minh;
 
    elm_coords_finger_size_adjust(1, &fw, 1, &fh);
-   if (sd->scroll)
+   if (sd->single_line)
      {
-        Evas_Coord vmw = 0, vmh = 0;
-
-        edje_object_size_min_calc(sd->scr_edje, &vmw, &vmh);
-        if (sd->single_line)
-          {
-             evas_object_size_hint_min_set(data, vmw, minh + vmh);
-             evas_object_size_hint_max_set(data, -1, minh + vmh);
-          }
-        else
-          {
-             evas_object_size_hint_min_set(data, vmw, vmh);
-             evas_object_size_hint_max_set(data, -1, -1);
-          }
+        evas_object_size_hint_min_set(obj, minw, minh);
+        evas_object_size_hint_max_set(obj, -1, minh);
      }
    else
      {
-        if (sd->single_line)
-          {
-             evas_object_size_hint_min_set(data, minw, minh);
-             evas_object_size_hint_max_set(data, -1, minh);
-          }
-        else
-          {
-             evas_object_size_hint_min_set(data, fw, minh);
-             evas_object_size_hint_max_set(data, -1, -1);
-          }
-     }
-
-   if (sd->deferred_cur)
-     {
-        Evas_Coord cx, cy, cw, ch;
-
-        edje_object_part_text_cursor_geometry_get
-          (sd->entry_edje, "elm.text", &cx, &cy, &cw, &ch);
-        if (sd->cur_changed)
-          {
-             sd->cur_changed = EINA_FALSE;
-             elm_widget_show_region_set(data, cx, cy, cw, ch, EINA_FALSE);
-          }
+        evas_object_size_hint_min_set(obj, fw, minh);
+        evas_object_size_hint_max_set(obj, -1, -1);
      }
 }
 
-EOLIAN static void
-_elm_entry_elm_layout_sizing_eval(Eo *obj, Elm_Entry_Data *sd)
+static void
+_sizing_eval_do(Evas_Object *obj, Elm_Entry_Data *sd)
 {
    Evas_Coord minw = -1, minh = -1;
    Evas_Coord resw, resh;
@@ -1026,6 +1199,7 @@ _elm_entry_elm_layout_sizing_eval(Eo *obj, Elm_Entry_Data *sd)
 
    if (sd->line_wrap)
      {
+        /* only the height changed: the wrapped text keeps its size */
         if ((resw == sd->last_w) && (!sd->changed))
           {
              if (sd->scroll)
@@ -1040,10 +1214,9 @@ _elm_entry_elm_layout_sizing_eval(Eo *obj, Elm_Entry_Data *sd)
                   if (vw > sd->ent_mw) w = vw;
                   if (vh > sd->ent_mh) h = vh;
                   evas_object_resize(sd->entry_edje, w, h);
-
-                  return;
                }
 
+             _cursor_show(obj, sd);
              return;
           }
 
@@ -1055,11 +1228,12 @@ _elm_entry_elm_layout_sizing_eval(Eo *obj, Elm_Entry_Data *sd)
              Evas_Coord vw = 0, vh = 0, vmw = 0, vmh = 0, w = -1, h = -1;
 
              evas_object_resize(sd->scr_edje, resw, resh);
-             edje_object_size_min_calc(sd->scr_edje, &vmw, &vmh);
+             _scr_min_get(sd, &vmw, &vmh);
              elm_interface_scrollable_content_viewport_geometry_get
                    (obj, NULL, NULL, &vw, &vh);
              edje_object_size_min_restricted_calc
                (sd->entry_edje, &minw, &minh, vw, 0);
+             _recalc_count(sd);
              elm_coords_finger_size_adjust(1, &minw, 1, &minh);
 
              /* This is a hack to workaround the way min size hints
@@ -1091,18 +1265,18 @@ _elm_entry_elm_layout_sizing_eval(Eo *obj, Elm_Entry_Data *sd)
                evas_object_size_hint_max_set(obj, -1, -1);
           }
         else
-          {
-             ecore_job_del(sd->deferred_recalc_job);
-             sd->deferred_recalc_job =
-               ecore_job_add(_deferred_recalc_job, obj);
-          }
+          _wrap_recalc(obj, sd);
 
         evas_event_thaw(evas_object_evas_get(obj));
         evas_event_thaw_eval(evas_object_evas_get(obj));
      }
    else
      {
-        if (!sd->changed) return;
+        if (!sd->changed)
+          {
+             _cursor_show(obj, sd);
+             return;
+          }
         evas_event_freeze(evas_object_evas_get(obj));
         sd->changed = EINA_FALSE;
         sd->last_w = resw;
@@ -1111,6 +1285,7 @@ _elm_entry_elm_layout_sizing_eval(Eo *obj, Elm_Entry_Data *sd)
              Evas_Coord vw = 0, vh = 0, vmw = 0, vmh = 0, w = -1, h = -1;
 
              edje_object_size_min_calc(sd->entry_edje, &minw, &minh);
+             _recalc_count(sd);
              sd->ent_mw = minw;
              sd->ent_mh = minh;
              elm_coords_finger_size_adjust(1, &minw, 1, &minh);
@@ -1122,7 +1297,7 @@ _elm_entry_elm_layout_sizing_eval(Eo *obj, Elm_Entry_Data *sd)
              if (minh > vh) vh = minh;
 
              evas_object_resize(sd->entry_edje, vw, vh);
-             edje_object_size_min_calc(sd->scr_edje, &vmw, &vmh);
+             _scr_min_get(sd, &vmw, &vmh);
              if (sd->single_line) h = vmh + minh;
              else h = vmh;
 
@@ -1135,6 +1310,7 @@ _elm_entry_elm_layout_sizing_eval(Eo *obj, Elm_Entry_Data *sd)
         else
           {
              edje_object_size_min_calc(sd->entry_edje, &minw, &minh);
+             _recalc_count(sd);
              sd->ent_mw = minw;
              sd->ent_mh = minh;
              elm_coords_finger_size_adjust(1, &minw, 1, &minh);
@@ -1152,6 +1328,42 @@ _elm_entry_elm_layout_sizing_eval(Eo *obj, Elm_Entry_Data *sd)
    _cursor_geometry_recalc(obj);
 }
 
+/* Text edits, resizes and cursor moves only mark the entry dirty; the
+ * sizing itself runs once per frame from the smart calculate.  Callers
+ * that did not change the text pass @p chrome, since they may have
+ * changed the size of the scroller around it. */
+static void
+_sizing_eval_queue(Evas_Object *obj, Elm_Entry_Data *sd, Eina_Bool chrome)
+{
+   if (chrome) sd->scr_min_valid = EINA_FALSE;
+   if (sd->needs_size_calc) return;
+   sd->needs_size_calc = EINA_TRUE;
+   evas_object_smart_changed(obj);
+}
+
+/* for the few callers that read the new geometry right away */
+static void
+_sizing_eval_now(Evas_Object *obj, Elm_Entry_Data *sd)
+{
+   sd->needs_size_calc = EINA_FALSE;
+   _sizing_eval_do(obj, sd);
+}
+
+EOLIAN static void
+_elm_entry_elm_layout_sizing_eval(Eo *obj, Elm_Entry_Data *sd)
+{
+   _sizing_eval_queue(obj, sd, EINA_TRUE);
+}
+
+EOLIAN static void
+_elm_entry_evas_object_smart_calculate(Eo *obj, Elm_Entry_Data *sd)
+{
+   evas_obj_smart_calculate(eo_super(obj, MY_CLASS));
+
+   if (!sd->needs_size_calc) return;
+   _sizing_eval_now(obj, sd);
+}
+
 static void
 _return_key_enabled_check(Evas_Object *obj)
 {
@@ -1450,8 +1662,9 @@ _paste_cb(void *data,
    else if (sd->cnp_mode != ELM_CNP_MODE_NO_IMAGE)
      formats |= ELM_SEL_FORMAT_IMAGE;
 
-   elm_cnp_selection_get
-     (data, ELM_SEL_TYPE_CLIPBOARD, formats, _selection_data_cb, NULL);
+   elm_cnp_selection_stream_get
+     (data, ELM_SEL_TYPE_CLIPBOARD, formats, ELM_SEL_FORMAT_MARKUP,
+     _selection_stream_cb, NULL);
 }
 
 static void
@@ -2035,6 +2248,15 @@ _entry_changed_handle(void *data,
 
    ELM_ENTRY_DATA_GET(data, sd);
 
+   /* a windowed entry is not editable, so this comes from the window
+    * being moved and the text did not change */
+   if (sd->doc)
+     {
+        sd->changed = EINA_TRUE;
+        _sizing_eval_queue(data, sd, EINA_FALSE);
+        return;
+     }
+
    evas_event_freeze(evas_object_evas_get(data));
    sd->changed = EINA_TRUE;
    /* Reset the size hints which are no more relevant. Keep the
@@ -2043,7 +2265,7 @@ _entry_changed_handle(void *data,
    evas_object_size_hint_min_get(data, NULL, &minh);
    evas_object_size_hint_min_set(data, -1, minh);
 
-   elm_layout_sizing_eval(data);
+   _sizing_eval_queue(data, sd, EINA_FALSE);
    ELM_SAFE_FREE(sd->text, eina_stringshare_del);
    ELM_SAFE_FREE(sd->delay_write, ecore_timer_del);
    evas_event_thaw(evas_object_evas_get(data));
@@ -2075,6 +2297,11 @@ _entry_changed_signal_cb(void *data,
                          const char *emission EINA_UNUSED,
                          const char *source EINA_UNUSED)
 {
+   ELM_ENTRY_DATA_GET(data, sd);
+
+   /* user changes follow with "entry,changed,user", telling what
+    * changed; any other change gets the length measured again */
+   sd->len.pending++;
    _entry_changed_handle(data, ELM_ENTRY_EVENT_CHANGED);
 }
 
@@ -2088,7 +2315,12 @@ _entry_changed_user_signal_cb(void *data,
    Edje_Entry_Change_Info *edje_info = (Edje_Entry_Change_Info *)
      edje_object_signal_callback_extra_data_get();
 
-   if (edje_info)
+   ELM_ENTRY_DATA_GET(data, sd);
+
+   _entry_len_user_change(sd, edje_info);
+   if (_paste_chunk_signal(sd, edje_info))
+     _paste_changed_user_emit(data, sd);
+   else if (edje_info)
      {
         memcpy(&info, edje_info, sizeof(info));
         eo_event_callback_call(data, ELM_ENTRY_EVENT_CHANGED_USER, &info);
@@ -2123,6 +2355,9 @@ _entry_preedit_changed_signal_cb(void *data,
                                  const char *emission EINA_UNUSED,
                                  const char *source EINA_UNUSED)
 {
+   ELM_ENTRY_DATA_GET(data, sd);
+
+   sd->len.valid = EINA_FALSE;
    _entry_changed_handle(data, ELM_ENTRY_EVENT_PREEDIT_CHANGED);
 }
 
@@ -2256,7 +2491,8 @@ _entry_paste_request_signal_cb(void *data,
         else if (sd->cnp_mode != ELM_CNP_MODE_NO_IMAGE)
           formats |= ELM_SEL_FORMAT_IMAGE;
 
-        elm_cnp_selection_get(data, type, formats, _selection_data_cb, NULL);
+        elm_cnp_selection_stream_get(data, type, formats, ELM_SEL_FORMAT_MARKUP,
+                                     _selection_stream_cb, NULL);
      }
 }
 
@@ -2717,86 +2953,409 @@ _entry_new_line_filter_init(Evas_Object *obj)
      }
 }
 
-static void
-_entry_new_line_filter_cb(void *data EINA_UNUSED,
-                          Evas_Object *entry EINA_UNUSED,
-                          char **text)
+/* Length of the text of @p obj in @p unit, as seen by the limit size
+ * filter. Entries keep it from one insert to the next. */
+static int
+_entry_len_get(Evas_Object *obj,
+               Length_Unit unit)
 {
-   char *ret;
+   Elm_Entry_Data *sd = NULL;
+   int chars, bytes;
 
-   if (!*text) return;
+   if (eo_isa(obj, MY_CLASS)) sd = eo_data_scope_get(obj, MY_CLASS);
+   if ((!sd) || (!sd->len.valid) || (sd->len.pending))
+     {
+        char *utf8 = elm_entry_markup_to_utf8(elm_object_text_get(obj));
 
-   ret = _entry_remove_new_line(*text);
+        bytes = strlen(utf8);
+        chars = evas_string_char_len_get(utf8);
+        free(utf8);
+        if (sd)
+          {
+             sd->len.chars = chars;
+             sd->len.bytes = bytes;
+             sd->len.pending = 0;
+             sd->len.valid = EINA_TRUE;
+          }
+     }
+   else
+     {
+        chars = sd->len.chars;
+        bytes = sd->len.bytes;
+     }
 
-   if (ret)
+   return (unit == LENGTH_UNIT_BYTE) ? bytes : chars;
+}
+
+static void
+_entry_len_add(Elm_Entry_Data *sd,
+               const char *markup,
+               int sign)
+{
+   char *utf8;
+
+   utf8 = elm_entry_markup_to_utf8(markup);
+   if (!utf8)
      {
-        free(*text);
-        *text = ret;
+        sd->len.valid = EINA_FALSE;
+        return;
      }
+   sd->len.chars += sign * evas_string_char_len_get(utf8);
+   sd->len.bytes += sign * (int)strlen(utf8);
+   free(utf8);
 }
 
+/* Inserts were already counted by _markup_filter_cb(), as they went
+ * in: their signals are queued, and another insert may come first. */
 static void
-_markup_filter_cb(void *data,
-                  Evas_Object *edje EINA_UNUSED,
-                  const char *part EINA_UNUSED,
-                  char **text)
+_entry_len_user_change(Elm_Entry_Data *sd,
+                       const Edje_Entry_Change_Info *info)
 {
-   Eina_List *l;
-   Elm_Entry_Markup_Filter *tf;
+   if (sd->len.pending > 0) sd->len.pending--;
+   if (!sd->len.valid) return;
+   if (!info)
+     {
+        sd->len.valid = EINA_FALSE;
+        return;
+     }
 
-   ELM_ENTRY_DATA_GET(data, sd);
+   if (info->insert) return;
+   _entry_len_add(sd, info->change.del.content, -1);
+}
 
-   EINA_LIST_FOREACH(sd->markup_filters, l, tf)
+/* A token of markup is a whole tag, a whole escape or one character. */
+static const char *
+_markup_token_end(const char *p)
+{
+   const char *q;
+   int idx;
+
+   if ((*p == '<') || (*p == '&'))
      {
-        tf->func(tf->data, data, text);
-        if (!*text)
-          break;
+        q = strchr(p, (*p == '<') ? '>' : ';');
+        if (q) return q + 1;
+        return p + strlen(p);
      }
+
+   idx = evas_string_char_next_get(p, 0, NULL);
+   return p + ((idx > 0) ? idx : 1);
+}
+
+static int
+_markup_token_units(const char *p,
+                    const char *e,
+                    Length_Unit unit)
+{
+   const char *esc = NULL;
+   char *markup, *utf8;
+   int n;
+
+   if (*p == '&')
+     esc = evas_textblock_escape_string_range_get(p, e);
+   else if (*p != '<')
+     return (unit == LENGTH_UNIT_BYTE) ? (int)(e - p) : 1;
+   if (esc)
+     return (unit == LENGTH_UNIT_BYTE) ?
+       (int)strlen(esc) : evas_string_char_len_get(esc);
+
+   /* tags and unknown escapes are rare, convert them */
+   markup = malloc(e - p + 1);
+   if (!markup) return 0;
+   memcpy(markup, p, e - p);
+   markup[e - p] = 0;
+   utf8 = elm_entry_markup_to_utf8(markup);
+   if (unit == LENGTH_UNIT_BYTE) n = strlen(utf8);
+   else n = evas_string_char_len_get(utf8);
+   free(utf8);
+   free(markup);
+
+   return n;
 }
 
-/* This function is used to insert text by chunks in jobs */
 static Eina_Bool
-_text_append_idler(void *data)
+_markup_token_is_new_line(const char *p,
+                          const char *e)
 {
-   int start;
-   char backup;
-   Evas_Object *obj = (Evas_Object *)data;
+   if (e - p == 4)
+     return !strncmp(p, "<br>", 4) || !strncmp(p, "<ps>", 4);
+   if (e - p == 5)
+     return !strncmp(p, "<br/>", 5) || !strncmp(p, "<ps/>", 5);
+   return EINA_FALSE;
+}
 
-   ELM_ENTRY_DATA_GET(obj, sd);
+static Eina_Bool
+_filter_accept_keep(const Elm_Entry_Markup_Filter *tf,
+                    const char *p,
+                    const char *e)
+{
+   Eina_Bool in_set = EINA_FALSE;
+   unsigned int i;
+   int c = 0;
 
-   evas_event_freeze(evas_object_evas_get(obj));
-   ELM_SAFE_FREE(sd->text, eina_stringshare_del);
-   sd->changed = EINA_TRUE;
+   /* tags are never filtered, nor broken escapes */
+   if (*p == '<') return EINA_TRUE;
+   if (*p == '&')
+     {
+        const char *esc;
 
-   start = sd->append_text_position;
-   if ((start + ELM_ENTRY_CHUNK_SIZE) < sd->append_text_len)
+        if (e[-1] != ';') return EINA_TRUE;
+        esc = evas_textblock_escape_string_range_get(p, e);
+        if (!esc) return !tf->goes_in;
+        evas_string_char_next_get(esc, 0, &c);
+     }
+   else
+     evas_string_char_next_get(p, 0, &c);
+
+   if ((c > 0) && (c < 128))
+     in_set = !!(tf->ascii[c >> 3] & (1 << (c & 7)));
+   else
      {
-        int pos = start;
-        int tag_start, esc_start;
+        for (i = 0; i < tf->set_len; i++)
+          if (tf->set[i] == (Eina_Unicode)c)
+            {
+               in_set = EINA_TRUE;
+               break;
+            }
+     }
 
-        tag_start = esc_start = -1;
-        /* Find proper markup cut place */
-        while (pos - start < ELM_ENTRY_CHUNK_SIZE)
-          {
-             int prev_pos = pos;
-             Eina_Unicode tmp =
-               eina_unicode_utf8_next_get(sd->append_text_left, &pos);
+   return in_set == tf->goes_in;
+}
 
-             if (esc_start == -1)
-               {
-                  if (tmp == '<')
-                    tag_start = prev_pos;
-                  else if (tmp == '>')
-                    tag_start = -1;
-               }
-             if (tag_start == -1)
-               {
-                  if (tmp == '&')
-                    esc_start = prev_pos;
-                  else if (tmp == ';')
-                    esc_start = -1;
-               }
-          }
+typedef struct _Filter_Stage
+{
+   const Elm_Entry_Markup_Filter *tf;
+   Length_Unit                    unit;
+   int                            left, seen;
+   Eina_Bool                      active : 1;
+   Eina_Bool                      full : 1;
+   Eina_Bool                      hit : 1;
+} Filter_Stage;
+
+/* Applies @p n built-in filters in a single scan of *text, dropping the
+ * refused tokens in place. Each token goes through the filters in
+ * order, so the result is the one of calling them one after the other,
+ * without reallocating the text or measuring it again for each of
+ * them. */
+static void
+_filter_run(Evas_Object *obj,
+            Elm_Entry_Markup_Filter **run,
+            unsigned int n,
+            char **text)
+{
+   Filter_Stage stages[ELM_ENTRY_FILTER_RUN_MAX];
+   unsigned int i, refused = n;
+   Eina_Bool preedit;
+   const char *p, *e;
+   char *out;
+
+   if (!*text) return;
+   if (n > ELM_ENTRY_FILTER_RUN_MAX) n = refused = ELM_ENTRY_FILTER_RUN_MAX;
+
+   preedit = !!strstr(*text, "<preedit");
+   for (i = 0; i < n; i++)
+     {
+        Filter_Stage *st = &stages[i];
+        const Elm_Entry_Filter_Limit_Size *lim = run[i]->data;
+        int max = 0;
+
+        memset(st, 0, sizeof(Filter_Stage));
+        st->tf = run[i];
+        st->active = EINA_TRUE;
+        if (run[i]->kind != ELM_ENTRY_FILTER_LIMIT_SIZE) continue;
+
+        if (lim->max_char_count > 0)
+          {
+             st->unit = LENGTH_UNIT_CHAR;
+             max = lim->max_char_count;
+          }
+        else if (lim->max_byte_count > 0)
+          {
+             st->unit = LENGTH_UNIT_BYTE;
+             max = lim->max_byte_count;
+          }
+        else
+          {
+             st->active = EINA_FALSE;
+             continue;
+          }
+        st->left = max - _entry_len_get(obj, st->unit);
+        st->full = (st->left <= 0);
+     }
+
+   p = out = *text;
+   while ((*p) && (refused == n))
+     {
+        Eina_Bool keep = EINA_TRUE;
+
+        e = _markup_token_end(p);
+        for (i = 0; (i < n) && (keep); i++)
+          {
+             Filter_Stage *st = &stages[i];
+             int units;
+
+             switch (st->tf->kind)
+               {
+                case ELM_ENTRY_FILTER_NEW_LINE:
+                  keep = !_markup_token_is_new_line(p, e);
+                  break;
+
+                case ELM_ENTRY_FILTER_ACCEPT_SET:
+                  keep = _filter_accept_keep(st->tf, p, e);
+                  if (!keep) st->hit = EINA_TRUE;
+                  break;
+
+                case ELM_ENTRY_FILTER_LIMIT_SIZE:
+                  if (!st->active) break;
+                  units = _markup_token_units(p, e, st->unit);
+                  if (st->full)
+                    {
+                       /* already at the limit, nothing goes in */
+                       if (units > 0) refused = i;
+                    }
+                  else if (!preedit)
+                    {
+                       if (units > st->left)
+                         {
+                            if (!st->seen) refused = i;
+                            st->left = 0;
+                            st->hit = EINA_TRUE;
+                            keep = EINA_FALSE;
+                         }
+                       else
+                         st->left -= units;
+                    }
+                  st->seen++;
+                  if (refused == i) keep = EINA_FALSE;
+                  break;
+
+                default:
+                  break;
+               }
+          }
+
+        if (keep)
+          {
+             if (out != p) memmove(out, p, e - p);
+             out += e - p;
+          }
+        p = e;
+     }
+   *out = 0;
+   if (refused < n) ELM_SAFE_FREE(*text, free);
+
+   /* the filters after a refusing one never saw the text */
+   for (i = 0; (i < n) && (i <= refused); i++)
+     {
+        if ((!stages[i].hit) && (i != refused)) continue;
+        if (stages[i].tf->kind == ELM_ENTRY_FILTER_ACCEPT_SET)
+          eo_event_callback_call(obj, ELM_ENTRY_EVENT_REJECTED, NULL);
+        else
+          eo_event_callback_call(obj, ELM_ENTRY_EVENT_MAXLENGTH_REACHED, NULL);
+     }
+}
+
+static void
+_entry_new_line_filter_cb(void *data EINA_UNUSED,
+                          Evas_Object *entry EINA_UNUSED,
+                          char **text)
+{
+   char *ret;
+
+   if (!*text) return;
+
+   ret = _entry_remove_new_line(*text);
+
+   if (ret)
+     {
+        free(*text);
+        *text = ret;
+     }
+}
+
+static void
+_markup_filter_cb(void *data,
+                  Evas_Object *edje EINA_UNUSED,
+                  const char *part EINA_UNUSED,
+                  char **text)
+{
+   Elm_Entry_Markup_Filter *run[ELM_ENTRY_FILTER_RUN_MAX];
+   Elm_Entry_Markup_Filter *tf;
+   unsigned int n = 0;
+   Eina_List *l;
+
+   ELM_ENTRY_DATA_GET(data, sd);
+
+   EINA_LIST_FOREACH(sd->markup_filters, l, tf)
+     {
+        if (tf->kind != ELM_ENTRY_FILTER_USER)
+          {
+             run[n++] = tf;
+             if (n < ELM_ENTRY_FILTER_RUN_MAX) continue;
+          }
+        if (n)
+          {
+             _filter_run(data, run, n, text);
+             n = 0;
+             if (!*text) return;
+          }
+        if (tf->kind == ELM_ENTRY_FILTER_USER)
+          {
+             tf->func(tf->data, data, text);
+             if (!*text) return;
+          }
+     }
+   if (n) _filter_run(data, run, n, text);
+
+   /* what is let through lands in the text right away, the next insert
+    * has to see it. preedit text goes away once committed */
+   if ((*text) && (sd->len.valid) && (!strstr(*text, "<preedit")))
+     _entry_len_add(sd, *text, 1);
+}
+
+/* This function is used to insert text by chunks in jobs */
+static Eina_Bool
+_text_append_idler(void *data)
+{
+   int start;
+   char backup;
+   Evas_Object *obj = (Evas_Object *)data;
+
+   ELM_ENTRY_DATA_GET(obj, sd);
+
+   evas_event_freeze(evas_object_evas_get(obj));
+   ELM_SAFE_FREE(sd->text, eina_stringshare_del);
+   sd->len.valid = EINA_FALSE;
+   sd->changed = EINA_TRUE;
+
+   start = sd->append_text_position;
+   if ((start + ELM_ENTRY_CHUNK_SIZE) < sd->append_text_len)
+     {
+        int pos = start;
+        int tag_start, esc_start;
+
+        tag_start = esc_start = -1;
+        /* Find proper markup cut place */
+        while (pos - start < ELM_ENTRY_CHUNK_SIZE)
+          {
+             int prev_pos = pos;
+             Eina_Unicode tmp =
+               eina_unicode_utf8_next_get(sd->append_text_left, &pos);
+
+             if (esc_start == -1)
+               {
+                  if (tmp == '<')
+                    tag_start = prev_pos;
+                  else if (tmp == '>')
+                    tag_start = -1;
+               }
+             if (tag_start == -1)
+               {
+                  if (tmp == '&')
+                    esc_start = prev_pos;
+                  else if (tmp == ';')
+                    esc_start = -1;
+               }
+          }
 
         if (tag_start >= 0)
           {
@@ -2847,85 +3406,6 @@ _text_append_idler(void *data)
      }
 }
 
-static void
-_chars_add_till_limit(Evas_Object *obj,
-                      char **text,
-                      int can_add,
-                      Length_Unit unit)
-{
-   int i = 0, current_len = 0;
-   char *new_text;
-
-   if (!*text) return;
-   if (unit >= LENGTH_UNIT_LAST) return;
-   if (strstr(*text, "<preedit")) return;
-
-   new_text = *text;
-   current_len = strlen(*text);
-   while (*new_text)
-     {
-        int idx = 0, unit_size = 0;
-        char *markup, *utfstr;
-
-        if (*new_text == '<')
-          {
-             while (*(new_text + idx) != '>')
-               {
-                  idx++;
-                  if (!*(new_text + idx)) break;
-               }
-          }
-        else if (*new_text == '&')
-          {
-             while (*(new_text + idx) != ';')
-               {
-                  idx++;
-                  if (!*(new_text + idx)) break;
-               }
-          }
-        idx = evas_string_char_next_get(new_text, idx, NULL);
-        markup = malloc(idx + 1);
-        if (markup)
-          {
-             strncpy(markup, new_text, idx);
-             markup[idx] = 0;
-             utfstr = elm_entry_markup_to_utf8(markup);
-             if (utfstr)
-               {
-                  if (unit == LENGTH_UNIT_BYTE)
-                    unit_size = strlen(utfstr);
-                  else if (unit == LENGTH_UNIT_CHAR)
-                    unit_size = evas_string_char_len_get(utfstr);
-                  ELM_SAFE_FREE(utfstr, free);
-               }
-             ELM_SAFE_FREE(markup, free);
-          }
-        if (can_add < unit_size)
-          {
-             if (!i)
-               {
-                  eo_event_callback_call
-                    (obj, ELM_ENTRY_EVENT_MAXLENGTH_REACHED, NULL);
-                  ELM_SAFE_FREE(*text, free);
-                  return;
-               }
-             can_add = 0;
-             strncpy(new_text, new_text + idx,
-                     current_len - ((new_text + idx) - *text));
-             current_len -= idx;
-             (*text)[current_len] = 0;
-          }
-        else
-          {
-             new_text += idx;
-             can_add -= unit_size;
-          }
-        i++;
-     }
-
-   eo_event_callback_call(obj, ELM_ENTRY_EVENT_MAXLENGTH_REACHED, NULL);
-}
-
 EOLIAN static void
 _elm_entry_elm_layout_signal_emit(Eo *obj EINA_UNUSED, Elm_Entry_Data *sd, const char *emission, const char *source)
 {
@@ -3082,6 +3562,616 @@ _entry_text_append(Evas_Object* obj, const char* entry, Eina_Bool set)
      }
 }
 
+static Elm_Entry_Doc *
+_entry_doc_new(void)
+{
+   Elm_Entry_Doc *doc;
+
+   doc = calloc(1, sizeof(Elm_Entry_Doc));
+   if (!doc) return NULL;
+
+   doc->add = eina_strbuf_new();
+   doc->pieces = eina_inarray_new(sizeof(Elm_Entry_Doc_Piece), 4);
+   doc->paras = eina_inarray_new(sizeof(Elm_Entry_Doc_Para), 1024);
+   doc->blocks = eina_inarray_new(sizeof(Evas_Coord), 16);
+   doc->line_h = 16.0 * elm_config_scale_get();
+   doc->bytes_per_line = 80.0;
+   doc->tag_at = (size_t)-1;
+
+   return doc;
+}
+
+static void
+_entry_doc_free(Elm_Entry_Doc *doc)
+{
+   if (!doc) return;
+
+   ecore_job_del(doc->job);
+   free(doc->orig);
+   eina_strbuf_free(doc->add);
+   eina_inarray_free(doc->pieces);
+   eina_inarray_free(doc->paras);
+   eina_inarray_free(doc->blocks);
+   free(doc);
+}
+
+static size_t
+_entry_doc_len(const Elm_Entry_Doc *doc)
+{
+   const Elm_Entry_Doc_Piece *piece;
+   unsigned int n;
+
+   n = eina_inarray_count(doc->pieces);
+   if (!n) return 0;
+   piece = eina_inarray_nth(doc->pieces, n - 1);
+
+   return piece->start + piece->len;
+}
+
+/* Appends [start, start + len) of the document to buf. Text is only ever
+ * set or appended, so there are at most two pieces to look at. */
+static void
+_entry_doc_text_get(const Elm_Entry_Doc *doc,
+                    size_t start,
+                    size_t len,
+                    Eina_Strbuf *buf)
+{
+   const Elm_Entry_Doc_Piece *piece;
+   const char *base;
+   size_t n;
+
+   EINA_INARRAY_FOREACH(doc->pieces, piece)
+     {
+        if (!len) break;
+        if (start >= piece->start + piece->len) continue;
+
+        base = piece->add ? eina_strbuf_string_get(doc->add) : doc->orig;
+        n = piece->start + piece->len - start;
+        if (n > len) n = len;
+        eina_strbuf_append_length
+          (buf, base + piece->off + (start - piece->start), n);
+        start += n;
+        len -= n;
+     }
+}
+
+/* Length of the line or paragraph break at s, 0 if there is none */
+static size_t
+_entry_doc_break_len(const char *s, const char *end)
+{
+   const char *p, *name;
+
+   if (*s == '\n') return 1;
+   if (*s != '<') return 0;
+
+   for (p = s + 1; (p < end) && (*p == ' '); p++) ;
+   name = p;
+   while ((p < end) && (*p != ' ') && (*p != '/') && (*p != '>')) p++;
+   if ((p - name != 2) ||
+       (strncmp(name, "br", 2) && strncmp(name, "ps", 2)))
+     return 0;
+   while ((p < end) && (*p != '>')) p++;
+   if (p >= end) return 0;
+
+   return p - s + 1;
+}
+
+static Evas_Coord
+_entry_doc_estimate(const Elm_Entry_Doc *doc, size_t len)
+{
+   size_t lines = 1;
+
+   if (doc->bytes_per_line >= 1.0)
+     lines = (len + doc->bytes_per_line - 1) / doc->bytes_per_line;
+   if (lines < 1) lines = 1;
+
+   return (lines * doc->line_h) + 0.5;
+}
+
+static void
+_entry_doc_h_add(Elm_Entry_Doc *doc, unsigned int idx, Evas_Coord dh)
+{
+   unsigned int b = idx / ELM_ENTRY_DOC_BLOCK;
+   Evas_Coord zero = 0, *bh;
+
+   while (eina_inarray_count(doc->blocks) <= b)
+     eina_inarray_push(doc->blocks, &zero);
+   bh = eina_inarray_nth(doc->blocks, b);
+   *bh += dh;
+   doc->total_h += dh;
+}
+
+/* Ends the paragraph running from pstart to pend. When it is the open
+ * one, that grows in place and keeps a measured height until it is
+ * measured again. */
+static void
+_entry_doc_para_put(Elm_Entry_Doc *doc,
+                    Elm_Entry_Doc_Para **open,
+                    size_t pstart,
+                    size_t pend,
+                    Eina_Bool closed)
+{
+   Elm_Entry_Doc_Para para, *p = *open;
+   Evas_Coord h;
+
+   if (p)
+     {
+        *open = NULL;
+        p->len = pend - pstart;
+        p->closed = closed;
+        if (p->measured) return;
+
+        h = _entry_doc_estimate(doc, p->len);
+        _entry_doc_h_add(doc, eina_inarray_count(doc->paras) - 1, h - p->h);
+        p->h = h;
+        return;
+     }
+
+   memset(&para, 0, sizeof(para));
+   para.start = pstart;
+   para.len = pend - pstart;
+   para.closed = closed;
+   para.h = _entry_doc_estimate(doc, para.len);
+   eina_inarray_push(doc->paras, &para);
+   _entry_doc_h_add(doc, eina_inarray_count(doc->paras) - 1, para.h);
+}
+
+/* Splits text, the document from start on, at its breaks. The last
+ * paragraph, if still open, goes on in it. */
+static void
+_entry_doc_paras_add(Elm_Entry_Doc *doc,
+                     const char *text,
+                     size_t len,
+                     size_t start)
+{
+   const char *s = text, *end = text + len, *tag = NULL;
+   Elm_Entry_Doc_Para *open = NULL;
+   size_t blen, pstart = start;
+   unsigned int n;
+
+   n = eina_inarray_count(doc->paras);
+   if (n) open = eina_inarray_nth(doc->paras, n - 1);
+   if ((open) && (open->closed)) open = NULL;
+   if (open) pstart = open->start;
+
+   while (s < end)
+     {
+        blen = _entry_doc_break_len(s, end);
+        if (!blen)
+          {
+             if (*s == '<') tag = s;
+             else if (*s == '>') tag = NULL;
+             s++;
+             continue;
+          }
+        s += blen;
+        tag = NULL;
+
+        _entry_doc_para_put(doc, &open, pstart, start + (s - text), EINA_TRUE);
+        pstart = start + (s - text);
+     }
+
+   /* a break may still be in the making there */
+   doc->tag_at = tag ? start + (tag - text) : (size_t)-1;
+
+   if (pstart == start + len) return;
+   _entry_doc_para_put(doc, &open, pstart, start + len, EINA_FALSE);
+}
+
+static void
+_entry_doc_text_set(Elm_Entry_Doc *doc, const char *text)
+{
+   Elm_Entry_Doc_Piece piece;
+
+   free(doc->orig);
+   doc->orig = strdup(text ? text : "");
+   doc->orig_len = doc->orig ? strlen(doc->orig) : 0;
+   eina_strbuf_reset(doc->add);
+   eina_inarray_flush(doc->pieces);
+   eina_inarray_flush(doc->paras);
+   eina_inarray_flush(doc->blocks);
+   doc->total_h = 0;
+   doc->first = doc->last = 0;
+   doc->tag_at = (size_t)-1;
+   doc->laid = EINA_FALSE;
+
+   if (!doc->orig_len) return;
+
+   memset(&piece, 0, sizeof(piece));
+   piece.len = doc->orig_len;
+   eina_inarray_push(doc->pieces, &piece);
+   _entry_doc_paras_add(doc, doc->orig, doc->orig_len, 0);
+}
+
+static void
+_entry_doc_text_append(Elm_Entry_Doc *doc, const char *text)
+{
+   Elm_Entry_Doc_Piece piece, *last;
+   Eina_Strbuf *tail;
+   size_t len, start, off;
+   unsigned int n;
+
+   len = strlen(text);
+   if (!len) return;
+
+   start = _entry_doc_len(doc);
+   off = eina_strbuf_length_get(doc->add);
+   eina_strbuf_append_length(doc->add, text, len);
+
+   n = eina_inarray_count(doc->pieces);
+   last = n ? eina_inarray_nth(doc->pieces, n - 1) : NULL;
+   if ((last) && (last->add) && (last->off + last->len == off))
+     last->len += len;
+   else
+     {
+        piece.start = start;
+        piece.off = off;
+        piece.len = len;
+        piece.add = EINA_TRUE;
+        eina_inarray_push(doc->pieces, &piece);
+     }
+
+   /* only the new text is looked at for breaks, along with the start
+    * of a tag it may finish */
+   if (doc->tag_at >= start)
+     {
+        _entry_doc_paras_add(doc, text, len, start);
+        return;
+     }
+
+   tail = eina_strbuf_new();
+   _entry_doc_text_get(doc, doc->tag_at, start + len - doc->tag_at, tail);
+   _entry_doc_paras_add(doc, eina_strbuf_string_get(tail),
+                        eina_strbuf_length_get(tail), doc->tag_at);
+   eina_strbuf_free(tail);
+}
+
+static Evas_Coord
+_entry_doc_para_y(const Elm_Entry_Doc *doc, unsigned int idx)
+{
+   const Elm_Entry_Doc_Para *para;
+   unsigned int b, i;
+   Evas_Coord y = 0;
+
+   for (b = 0; b < idx / ELM_ENTRY_DOC_BLOCK; b++)
+     y += *(Evas_Coord *)eina_inarray_nth(doc->blocks, b);
+   for (i = b * ELM_ENTRY_DOC_BLOCK; i < idx; i++)
+     {
+        para = eina_inarray_nth(doc->paras, i);
+        y += para->h;
+     }
+
+   return y;
+}
+
+/* The paragraph at y in the document and where it starts */
+static unsigned int
+_entry_doc_para_at(const Elm_Entry_Doc *doc, Evas_Coord y, Evas_Coord *py)
+{
+   const Elm_Entry_Doc_Para *para;
+   unsigned int b, i, n, nb;
+   Evas_Coord acc = 0, h;
+
+   *py = 0;
+   n = eina_inarray_count(doc->paras);
+   if ((!n) || (y <= 0)) return 0;
+
+   nb = eina_inarray_count(doc->blocks);
+   for (b = 0; b < nb; b++)
+     {
+        h = *(Evas_Coord *)eina_inarray_nth(doc->blocks, b);
+        if (acc + h > y) break;
+        acc += h;
+     }
+   if (b == nb)
+     {
+        para = eina_inarray_nth(doc->paras, n - 1);
+        *py = doc->total_h - para->h;
+        return n - 1;
+     }
+
+   for (i = b * ELM_ENTRY_DOC_BLOCK; i < n - 1; i++)
+     {
+        para = eina_inarray_nth(doc->paras, i);
+        if (acc + para->h > y) break;
+        acc += para->h;
+     }
+   *py = acc;
+
+   return i;
+}
+
+/* Redoes the sums with fresh estimates for the paragraphs not laid out
+ * yet, or for all of them when the measures are stale */
+static void
+_entry_doc_reestimate(Elm_Entry_Doc *doc, Eina_Bool all)
+{
+   Elm_Entry_Doc_Para *para;
+   Evas_Coord *bh;
+   unsigned int i = 0;
+
+   EINA_INARRAY_FOREACH(doc->blocks, bh) *bh = 0;
+   doc->total_h = 0;
+
+   EINA_INARRAY_FOREACH(doc->paras, para)
+     {
+        if (all) para->measured = EINA_FALSE;
+        if (!para->measured)
+          para->h = _entry_doc_estimate(doc, para->len);
+        _entry_doc_h_add(doc, i++, para->h);
+     }
+}
+
+static void
+_entry_doc_invalidate(Elm_Entry_Doc *doc)
+{
+   doc->stat_lines = doc->stat_bytes = 0;
+   doc->stat_h = 0;
+   _entry_doc_reestimate(doc, EINA_TRUE);
+}
+
+static Eina_Bool
+_entry_doc_cursor_at_break(const Evas_Textblock_Cursor *cur)
+{
+   Eina_Bool ret;
+   size_t len;
+   char *s;
+
+   if (!evas_textblock_cursor_format_is_visible_get(cur)) return EINA_FALSE;
+   s = evas_textblock_cursor_content_get(cur);
+   if (!s) return EINA_FALSE;
+   len = strlen(s);
+   ret = (len > 0) && (_entry_doc_break_len(s, s + len) == len);
+   free(s);
+
+   return ret;
+}
+
+static void
+_entry_doc_para_measured(Elm_Entry_Doc *doc,
+                         unsigned int idx,
+                         Evas_Coord h,
+                         int lines)
+{
+   Elm_Entry_Doc_Para *para = eina_inarray_nth(doc->paras, idx);
+
+   if ((!para->measured) && (lines > 0))
+     {
+        doc->stat_lines += lines;
+        doc->stat_bytes += para->len;
+        doc->stat_h += h;
+     }
+   _entry_doc_h_add(doc, idx, h - para->h);
+   para->h = h;
+   para->measured = EINA_TRUE;
+}
+
+/* Reads back the height of the paragraphs in the textblock, from the
+ * lines their breaks end. Returns where the first of them starts. */
+static Evas_Coord
+_entry_doc_measure(Elm_Entry_Doc *doc,
+                   const Evas_Object *tb,
+                   Eina_Bool spacer)
+{
+   const Elm_Entry_Doc_Para *para;
+   Evas_Textblock_Cursor *cur;
+   Evas_Coord ly = 0, lh = 0, prev = 0, top = 0, fh = 0;
+   unsigned int i = doc->first;
+   int line, prev_line = 0;
+   Eina_Bool ok;
+
+   cur = evas_object_textblock_cursor_new(tb);
+   evas_textblock_cursor_paragraph_first(cur);
+   ok = evas_textblock_cursor_is_format(cur) ||
+     evas_textblock_cursor_format_next(cur);
+   for (; ok && (i <= doc->last); ok = evas_textblock_cursor_format_next(cur))
+     {
+        if (!_entry_doc_cursor_at_break(cur)) continue;
+
+        line = evas_textblock_cursor_line_geometry_get
+            (cur, NULL, &ly, NULL, &lh);
+        if (spacer)
+          {
+             spacer = EINA_FALSE;
+             top = prev = ly + lh;
+             prev_line = line + 1;
+             continue;
+          }
+        _entry_doc_para_measured(doc, i++, ly + lh - prev, line + 1 - prev_line);
+        prev = ly + lh;
+        prev_line = line + 1;
+     }
+
+   /* the last paragraph of the text may not end with a break */
+   para = eina_inarray_nth(doc->paras, doc->last);
+   if ((i == doc->last) && (!para->closed))
+     {
+        evas_object_textblock_size_formatted_get(tb, NULL, &fh);
+        evas_textblock_cursor_paragraph_last(cur);
+        line = evas_textblock_cursor_line_geometry_get(cur, NULL, NULL, NULL, NULL);
+        _entry_doc_para_measured(doc, i, fh - prev, line + 1 - prev_line);
+     }
+   evas_textblock_cursor_free(cur);
+
+   return top;
+}
+
+/* Estimates follow what got measured, redone when that drifts apart */
+static void
+_entry_doc_learn(Elm_Entry_Doc *doc)
+{
+   double line_h, bpl;
+
+   if (!doc->stat_lines) return;
+
+   line_h = doc->stat_h / doc->stat_lines;
+   bpl = (double)doc->stat_bytes / doc->stat_lines;
+   if ((line_h <= 0) || (bpl <= 0)) return;
+   if ((line_h > doc->line_h * 0.9) && (line_h < doc->line_h * 1.1) &&
+       (bpl > doc->bytes_per_line * 0.9) && (bpl < doc->bytes_per_line * 1.1))
+     return;
+
+   doc->line_h = line_h;
+   doc->bytes_per_line = bpl;
+   _entry_doc_reestimate(doc, EINA_FALSE);
+}
+
+/* Gives the textblock the paragraphs around the viewport, one viewport
+ * height on each side (more in the direction of a running flick), with
+ * spacers standing for the rest. Whatever is at the top of the viewport
+ * stays in place when heights above it change. */
+static void
+_entry_doc_update(Evas_Object *obj, Elm_Entry_Data *sd, Eina_Bool force)
+{
+   Evas_Coord vx = 0, vy = 0, vw = 0, vh = 0, px, py, y0, y1, need0, need1;
+   Evas_Coord margin, top, ay, fy, bottom, spacer_h, top_real = 0, y;
+   const Elm_Entry_Doc_Para *para;
+   Elm_Entry_Doc *doc = sd->doc;
+   unsigned int n, anchor, first, last;
+   const Evas_Object *tb;
+   Eina_Strbuf *buf;
+   size_t start;
+
+   if ((!doc) || (doc->updating)) return;
+
+   elm_interface_scrollable_content_region_get(obj, &vx, &vy, &vw, &vh);
+   if ((vw != doc->last_vw) && (sd->line_wrap))
+     {
+        if ((doc->last_vw > 0) && (vw > 0))
+          doc->bytes_per_line = (doc->bytes_per_line * vw) / doc->last_vw;
+        _entry_doc_invalidate(doc);
+        force = EINA_TRUE;
+     }
+   doc->last_vw = vw;
+
+   margin = (vh > 0) ? vh : 512;
+   need0 = vy;
+   need1 = vy + vh;
+   if (elm_interface_scrollable_predicted_pos_get(obj, &px, &py))
+     {
+        if (py < need0) need0 = py;
+        if (py + vh > need1) need1 = py + vh;
+     }
+   if ((!force) && (doc->laid) &&
+       ((doc->first == 0) || (doc->win_y <= need0 - (margin / 2))) &&
+       ((doc->last + 1 >= eina_inarray_count(doc->paras)) ||
+        (doc->win_y + doc->win_h >= need1 + (margin / 2))))
+     return;
+
+   doc->updating = EINA_TRUE;
+   n = eina_inarray_count(doc->paras);
+   y0 = need0 - margin;
+   y1 = need1 + margin;
+   anchor = _entry_doc_para_at(doc, vy, &ay);
+   first = _entry_doc_para_at(doc, y0, &top);
+   last = _entry_doc_para_at(doc, y1, &fy);
+
+   /* the line holding the top spacer comes out a bit taller than it */
+   spacer_h = (top > doc->top_pad + 1) ? top - doc->top_pad : 1;
+   buf = eina_strbuf_new();
+   if (first > 0)
+     eina_strbuf_append_printf
+       (buf, "<item absize=1x%d vsize=ascent></item><br/>", spacer_h);
+   if (n > 0)
+     {
+        para = eina_inarray_nth(doc->paras, first);
+        start = para->start;
+        para = eina_inarray_nth(doc->paras, last);
+        _entry_doc_text_get(doc, start, para->start + para->len - start, buf);
+        bottom = doc->total_h - fy - para->h;
+        if ((last + 1 < n) && (bottom > 0))
+          eina_strbuf_append_printf
+            (buf, "<item absize=1x%d vsize=ascent></item>", bottom);
+     }
+   edje_object_part_text_set
+     (sd->entry_edje, "elm.text", eina_strbuf_string_get(buf));
+   eina_strbuf_free(buf);
+
+   doc->first = first;
+   doc->last = last;
+   doc->laid = EINA_TRUE;
+
+   /* nothing to measure against before the entry got its width */
+   if ((n > 0) && ((vw > 0) || (!sd->line_wrap)))
+     {
+        edje_object_calc_force(sd->entry_edje);
+        tb = edje_object_part_object_get(sd->entry_edje, "elm.text");
+        top_real = _entry_doc_measure(doc, tb, first > 0);
+        if (first > 0) doc->top_pad = top_real - spacer_h;
+        _entry_doc_learn(doc);
+     }
+
+   doc->win_y = _entry_doc_para_y(doc, first);
+   doc->win_h = _entry_doc_para_y(doc, last) - doc->win_y;
+   if (n > 0)
+     {
+        para = eina_inarray_nth(doc->paras, last);
+        doc->win_h += para->h;
+     }
+
+   sd->changed = EINA_TRUE;
+   _sizing_eval_now(obj, sd);
+
+   if (doc->follow)
+     y = doc->total_h - vh;
+   else if (first > 0)
+     y = top_real + (_entry_doc_para_y(doc, anchor) - doc->win_y) + (vy - ay);
+   else
+     y = _entry_doc_para_y(doc, anchor) + (vy - ay);
+   doc->follow = EINA_FALSE;
+   if (y < 0) y = 0;
+   if (y != vy)
+     elm_interface_scrollable_content_pos_set(obj, vx, y, EINA_FALSE);
+
+   doc->updating = EINA_FALSE;
+}
+
+static void
+_entry_doc_job(void *data)
+{
+   ELM_ENTRY_DATA_GET(data, sd);
+
+   sd->doc->job = NULL;
+   _entry_doc_update(data, sd, EINA_TRUE);
+}
+
+static void
+_entry_doc_append(Evas_Object *obj, Elm_Entry_Data *sd, const char *entry)
+{
+   Evas_Coord vy = 0, vh = 0, ch = 0;
+
+   /* follow the end, like a log viewer would */
+   elm_interface_scrollable_content_region_get(obj, NULL, &vy, NULL, &vh);
+   elm_interface_scrollable_content_size_get(obj, NULL, &ch);
+   if ((sd->doc->laid) && (vy + vh >= ch - 1)) sd->doc->follow = EINA_TRUE;
+
+   _entry_doc_text_append(sd->doc, entry);
+   ELM_SAFE_FREE(sd->text, eina_stringshare_del);
+   sd->len.valid = EINA_FALSE;
+
+   /* appends coming in bursts get laid out once */
+   if (!sd->doc->job)
+     sd->doc->job = ecore_job_add(_entry_doc_job, obj);
+
+   eo_event_callback_call(obj, ELM_ENTRY_EVENT_CHANGED, NULL);
+}
+
+static void
+_entry_doc_set(Evas_Object *obj, Elm_Entry_Data *sd, const char *entry)
+{
+   _entry_doc_text_set(sd->doc, entry);
+   ELM_SAFE_FREE(sd->text, eina_stringshare_del);
+   sd->len.valid = EINA_FALSE;
+   ELM_SAFE_FREE(sd->doc->job, ecore_job_del);
+
+   elm_interface_scrollable_content_pos_set(obj, 0, 0, EINA_FALSE);
+   _entry_doc_update(obj, sd, EINA_TRUE);
+   _elm_entry_guide_update(obj, sd->doc->orig_len > 0);
+
+   eo_event_callback_call(obj, ELM_ENTRY_EVENT_CHANGED, NULL);
+   eo_event_callback_call(obj, ELM_ENTRY_EVENT_TEXT_SET_DONE, NULL);
+}
+
 EOLIAN static Eina_Bool
 _elm_entry_elm_layout_text_set(Eo *obj, Elm_Entry_Data *sd, const char *part, const char *entry)
 {
@@ -3098,8 +4188,15 @@ _elm_entry_elm_layout_text_set(Eo *obj, Elm_Entry_Data *sd, const char *part, co
         return EINA_TRUE;
      }
 
+   if (sd->doc)
+     {
+        _entry_doc_set(obj, sd, entry);
+        return EINA_TRUE;
+     }
+
    evas_event_freeze(evas_object_evas_get(obj));
    ELM_SAFE_FREE(sd->text, eina_stringshare_del);
+   sd->len.valid = EINA_FALSE;
    sd->changed = EINA_TRUE;
 
    /* Clear currently pending job if there is one */
@@ -3151,6 +4248,18 @@ _elm_entry_elm_layout_text_get(Eo *obj, Elm_Entry_Data *sd, const char *item)
 
 proceed:
 
+   if (sd->doc)
+     {
+        Eina_Strbuf *buf;
+
+        if (sd->text) return sd->text;
+        buf = eina_strbuf_new();
+        _entry_doc_text_get(sd->doc, 0, _entry_doc_len(sd->doc), buf);
+        sd->text = eina_stringshare_add(eina_strbuf_string_get(buf));
+        eina_strbuf_free(buf);
+        return sd->text;
+     }
+
    text = edje_object_part_text_get(sd->entry_edje, "elm.text");
    if (!text)
      {
@@ -3313,7 +4422,7 @@ _elm_entry_resize_internal(Evas_Object *obj)
 
    if (sd->line_wrap)
      {
-        elm_layout_sizing_eval(obj);
+        _sizing_eval_queue(obj, sd, EINA_FALSE);
      }
    else if (sd->scroll)
      {
@@ -3730,6 +4839,7 @@ _elm_entry_evas_object_smart_del(Eo *obj, Elm_Entry_Data *sd)
    Elm_Entry_Context_Menu_Item *it;
    Elm_Entry_Item_Provider *ip;
    Elm_Entry_Markup_Filter *tf;
+   const char *str;
 
    if (sd->delay_write)
      {
@@ -3758,7 +4868,12 @@ _elm_entry_evas_object_smart_del(Eo *obj, Elm_Entry_Data *sd)
    entries = eina_list_remove(entries, obj);
    eina_stringshare_del(sd->cut_sel);
    eina_stringshare_del(sd->text);
-   ecore_job_del(sd->deferred_recalc_job);
+   _entry_doc_free(sd->doc);
+   if (sd->paste_image) eina_strbuf_free(sd->paste_image);
+   if (sd->paste.cur) evas_textblock_cursor_free(sd->paste.cur);
+   if (sd->paste.content) eina_strbuf_free(sd->paste.content);
+   EINA_LIST_FREE(sd->paste.queued, str)
+     eina_stringshare_del(str);
    if (sd->append_text_idler)
      {
         ecore_idler_del(sd->append_text_idler);
@@ -4028,6 +5143,12 @@ _elm_entry_entry_append(Eo *obj EINA_UNUSED, Elm_Entry_Data *sd, const char *ent
 {
    if (!entry) entry = "";
 
+   if (sd->doc)
+     {
+        _entry_doc_append(obj, sd, entry);
+        return;
+     }
+
    sd->changed = EINA_TRUE;
    _entry_text_append(obj, entry, EINA_FALSE);
 }
@@ -4035,6 +5156,8 @@ _elm_entry_entry_append(Eo *obj EINA_UNUSED, Elm_Entry_Data *sd, const char *ent
 EOLIAN static Eina_Bool
 _elm_entry_is_empty(const Eo *obj EINA_UNUSED, Elm_Entry_Data *sd)
 {
+   if (sd->doc) return _entry_doc_len(sd->doc) == 0;
+
    edje_object_part_text_cursor_copy
                (sd->entry_edje, "elm.text", EDJE_CURSOR_MAIN, EDJE_CURSOR_USER);
    edje_object_part_text_cursor_pos_set
@@ -4053,12 +5176,20 @@ _elm_entry_textblock_get(Eo *obj EINA_UNUSED, Elm_Entry_Data *sd)
         (sd->entry_edje, "elm.text");
 }
 
+EOLIAN static void
+_elm_entry_recalc_stats_get(Eo *obj EINA_UNUSED, Elm_Entry_Data *sd, unsigned int *calcs, double *per_second)
+{
+   if (calcs) *calcs = sd->recalc.count;
+   if (per_second) *per_second = sd->recalc.rate;
+}
+
 EOLIAN static void
 _elm_entry_calc_force(Eo *obj, Elm_Entry_Data *sd)
 {
    edje_object_calc_force(sd->entry_edje);
    sd->changed = EINA_TRUE;
-   elm_layout_sizing_eval(obj);
+   sd->scr_min_valid = EINA_FALSE;
+   _sizing_eval_now(obj, sd);
 }
 
 EOLIAN static const char*
@@ -4086,7 +5217,8 @@ _elm_entry_entry_insert(Eo *obj, Elm_Entry_Data *sd, const char *entry)
 {
    edje_object_part_text_insert(sd->entry_edje, "elm.text", entry);
    sd->changed = EINA_TRUE;
-   elm_layout_sizing_eval(obj);
+   sd->len.valid = EINA_FALSE;
+   _sizing_eval_queue(obj, sd, EINA_FALSE);
 }
 
 EOLIAN static void
@@ -4095,8 +5227,6 @@ _elm_entry_line_wrap_set(Eo *obj, Elm_Entry_Data *sd, Elm_Wrap_Type wrap)
    if (sd->line_wrap == wrap) return;
    sd->last_w = -1;
    sd->line_wrap = wrap;
-   if (wrap == ELM_WRAP_NONE)
-     ELM_SAFE_FREE(sd->deferred_recalc_job, ecore_job_del);
    elm_obj_widget_theme_apply(obj);
 }
 
@@ -4110,6 +5240,7 @@ EOLIAN static void
 _elm_entry_editable_set(Eo *obj, Elm_Entry_Data *sd, Eina_Bool editable)
 {
    if (sd->editable == editable) return;
+   if ((editable) && (sd->doc)) elm_obj_entry_windowed_set(obj, EINA_FALSE);
    sd->editable = editable;
    elm_obj_widget_theme_apply(obj);
 
@@ -4518,70 +5649,24 @@ elm_entry_utf8_to_markup(const char *s)
    return ss;
 }
 
-static const char *
-_text_get(const Evas_Object *obj)
-{
-   return elm_object_text_get(obj);
-}
-
+/* Called directly rather than from the markup filters of an entry,
+ * the built-in filters still go through _filter_run(). */
 EAPI void
 elm_entry_filter_limit_size(void *data,
                             Evas_Object *entry,
                             char **text)
 {
-   const char *(*text_get)(const Evas_Object *);
-   Elm_Entry_Filter_Limit_Size *lim = data;
-   char *current, *utfstr;
-   int len, newlen;
+   Elm_Entry_Markup_Filter tf, *run = &tf;
 
    EINA_SAFETY_ON_NULL_RETURN(data);
    EINA_SAFETY_ON_NULL_RETURN(entry);
    EINA_SAFETY_ON_NULL_RETURN(text);
 
-   /* hack. I don't want to copy the entire function to work with
-    * scrolled_entry */
-   text_get = _text_get;
-
-   current = elm_entry_markup_to_utf8(text_get(entry));
-   utfstr = elm_entry_markup_to_utf8(*text);
-
-   if (lim->max_char_count > 0)
-     {
-        len = evas_string_char_len_get(current);
-        newlen = evas_string_char_len_get(utfstr);
-        if ((len >= lim->max_char_count) && (newlen > 0))
-          {
-             eo_event_callback_call
-               (entry, ELM_ENTRY_EVENT_MAXLENGTH_REACHED, NULL);
-             ELM_SAFE_FREE(*text, free);
-             free(current);
-             free(utfstr);
-             return;
-          }
-        if ((len + newlen) > lim->max_char_count)
-          _chars_add_till_limit
-            (entry, text, (lim->max_char_count - len), LENGTH_UNIT_CHAR);
-     }
-   else if (lim->max_byte_count > 0)
-     {
-        len = strlen(current);
-        newlen = strlen(utfstr);
-        if ((len >= lim->max_byte_count) && (newlen > 0))
-          {
-             eo_event_callback_call
-               (entry, ELM_ENTRY_EVENT_MAXLENGTH_REACHED, NULL);
-             ELM_SAFE_FREE(*text, free);
-             free(current);
-             free(utfstr);
-             return;
-          }
-        if ((len + newlen) > lim->max_byte_count)
-          _chars_add_till_limit
-            (entry, text, (lim->max_byte_count - len), LENGTH_UNIT_BYTE);
-     }
-
-   free(current);
-   free(utfstr);
+   memset(&tf, 0, sizeof(tf));
+   tf.func = elm_entry_filter_limit_size;
+   tf.data = data;
+   tf.kind = ELM_ENTRY_FILTER_LIMIT_SIZE;
+   _filter_run(entry, &run, 1, text);
 }
 
 EAPI void
@@ -4589,12 +5674,8 @@ elm_entry_filter_accept_set(void *data,
                             Evas_Object *entry,
                             char **text)
 {
-   int read_idx, last_read_idx = 0, read_char;
    Elm_Entry_Filter_Accept_Set *as = data;
-   Eina_Bool goes_in;
-   Eina_Bool rejected = EINA_FALSE;
-   const char *set;
-   char *insert;
+   Elm_Entry_Markup_Filter tf, *run = &tf;
 
    EINA_SAFETY_ON_NULL_RETURN(data);
    EINA_SAFETY_ON_NULL_RETURN(text);
@@ -4602,108 +5683,14 @@ elm_entry_filter_accept_set(void *data,
    if ((!as->accepted) && (!as->rejected))
      return;
 
-   if (as->accepted)
-     {
-        set = as->accepted;
-        goes_in = EINA_TRUE;
-     }
-   else
-     {
-        set = as->rejected;
-        goes_in = EINA_FALSE;
-     }
-
-   insert = *text;
-   read_idx = evas_string_char_next_get(*text, 0, &read_char);
-   while (read_char)
-     {
-        int cmp_idx, cmp_char;
-        Eina_Bool in_set = EINA_FALSE;
-
-        if (read_char == '<')
-          {
-             while (read_char && (read_char != '>'))
-               read_idx = evas_string_char_next_get(*text, read_idx, &read_char);
-
-             if (goes_in) in_set = EINA_TRUE;
-             else in_set = EINA_FALSE;
-          }
-        else
-          {
-             if (read_char == '&')
-               {
-                  while (read_char && (read_char != ';'))
-                    read_idx = evas_string_char_next_get(*text, read_idx, &read_char);
-
-                  if (!read_char)
-                    {
-                       if (goes_in) in_set = EINA_TRUE;
-                       else in_set = EINA_FALSE;
-                       goto inserting;
-                    }
-                  if (read_char == ';')
-                    {
-                       char *tag;
-                       int utf8 = 0;
-                       tag = malloc(read_idx - last_read_idx + 1);
-                       if (tag)
-                         {
-                            char *markup;
-                            strncpy(tag, (*text) + last_read_idx, read_idx - last_read_idx);
-                            tag[read_idx - last_read_idx] = 0;
-                            markup = elm_entry_markup_to_utf8(tag);
-                            free(tag);
-                            if (markup)
-                              {
-                                 utf8 = *markup;
-                                 free(markup);
-                              }
-                            if (!utf8)
-                              {
-                                 in_set = EINA_FALSE;
-                                 goto inserting;
-                              }
-                            read_char = utf8;
-                         }
-                    }
-               }
-
-             cmp_idx = evas_string_char_next_get(set, 0, &cmp_char);
-             while (cmp_char)
-               {
-                  if (read_char == cmp_char)
-                    {
-                       in_set = EINA_TRUE;
-                       break;
-                    }
-                  cmp_idx = evas_string_char_next_get(set, cmp_idx, &cmp_char);
-               }
-          }
-
-inserting:
-
-        if (in_set == goes_in)
-          {
-             int size = read_idx - last_read_idx;
-             const char *src = (*text) + last_read_idx;
-             if (src != insert)
-               memcpy(insert, *text + last_read_idx, size);
-             insert += size;
-          }
-        else
-          {
-             rejected = EINA_TRUE;
-          }
-
-        if (read_char)
-          {
-             last_read_idx = read_idx;
-             read_idx = evas_string_char_next_get(*text, read_idx, &read_char);
-          }
-     }
-   *insert = 0;
-   if (rejected)
-     eo_event_callback_call(entry, ELM_ENTRY_EVENT_REJECTED, NULL);
+   memset(&tf, 0, sizeof(tf));
+   tf.func = elm_entry_filter_accept_set;
+   tf.data = data;
+   tf.kind = ELM_ENTRY_FILTER_ACCEPT_SET;
+   tf.goes_in = !!as->accepted;
+   _filter_set_compile(&tf, as->accepted ? as->accepted : as->rejected);
+   _filter_run(entry, &run, 1, text);
+   free(tf.set);
 }
 
 EOLIAN static void
@@ -4828,7 +5815,10 @@ static void
 _elm_entry_content_viewport_resize_cb(Evas_Object *obj,
                                       Evas_Coord w EINA_UNUSED, Evas_Coord h EINA_UNUSED)
 {
+   ELM_ENTRY_DATA_GET(obj, sd);
+
    _elm_entry_resize_internal(obj);
+   if (sd->doc) _entry_doc_update(obj, sd, EINA_FALSE);
 }
 
 static void
@@ -4841,6 +5831,8 @@ _scroll_cb(Evas_Object *obj, void *data EINA_UNUSED)
 
    if (sd->have_selection)
      _update_selection_handler(obj);
+
+   if (sd->doc) _entry_doc_update(obj, sd, EINA_FALSE);
 }
 
 EOLIAN static void
@@ -4848,6 +5840,7 @@ _elm_entry_scrollable_set(Eo *obj, Elm_Entry_Data *sd, Eina_Bool scroll)
 {
    scroll = !!scroll;
    if (sd->scroll == scroll) return;
+   if ((!scroll) && (sd->doc)) elm_obj_entry_windowed_set(obj, EINA_FALSE);
    sd->scroll = scroll;
 
    if (sd->scroll)
@@ -4915,6 +5908,47 @@ _elm_entry_scrollable_get(Eo *obj EINA_UNUSED, Elm_Entry_Data *sd)
    return sd->scroll;
 }
 
+EOLIAN static void
+_elm_entry_windowed_set(Eo *obj, Elm_Entry_Data *sd, Eina_Bool windowed)
+{
+   const char *t;
+   char *text;
+
+   windowed = !!windowed;
+   if (windowed == !!sd->doc) return;
+
+   t = elm_object_text_get(obj);
+   text = strdup(t ? t : "");
+   if (!text) return;
+
+   if (windowed)
+     {
+        elm_obj_entry_editable_set(obj, EINA_FALSE);
+        elm_obj_entry_scrollable_set(obj, EINA_TRUE);
+
+        ELM_SAFE_FREE(sd->append_text_idler, ecore_idler_del);
+        ELM_SAFE_FREE(sd->append_text_left, free);
+        sd->append_text_len = 0;
+        sd->append_text_position = 0;
+
+        sd->doc = _entry_doc_new();
+        if (sd->doc) _entry_doc_set(obj, sd, text);
+     }
+   else
+     {
+        ELM_SAFE_FREE(sd->doc, _entry_doc_free);
+        ELM_SAFE_FREE(sd->text, eina_stringshare_del);
+        elm_object_text_set(obj, text);
+     }
+   free(text);
+}
+
+EOLIAN static Eina_Bool
+_elm_entry_windowed_get(Eo *obj EINA_UNUSED, Elm_Entry_Data *sd)
+{
+   return !!sd->doc;
+}
+
 EOLIAN static void
 _elm_entry_icon_visible_set(Eo *obj, Elm_Entry_Data *_pd EINA_UNUSED, Eina_Bool setting)
 {
@@ -531,6 +531,189 @@ _item_mouse_in_cb(void *data,
      elm_object_item_focus_set(EO_OBJ(it), EINA_TRUE);
 }
 
+static Eina_Bool
+_reorder_move_animator_cb(void *data)
+{
+   Elm_Gengrid_Data *sd = data;
+   Elm_Gen_Item *it;
+   Eina_List *l, *ll;
+   double t;
+
+   EINA_LIST_FOREACH_SAFE(sd->reorder_move.items, l, ll, it)
+     {
+        Elm_Gen_Item_Type *item = GG_IT(it);
+
+        t = (ecore_loop_time_get() - item->moving_effect_start_time) /
+          REORDER_EFFECT_TIME;
+        if ((t >= 1.0) || (!it->realized))
+          {
+             if (it->realized)
+               evas_object_move(VIEW(it), item->tx, item->ty);
+             item->moving = EINA_FALSE;
+             sd->reorder_move.items =
+               eina_list_remove_list(sd->reorder_move.items, l);
+             continue;
+          }
+        if (t < 0.0) t = 0.0;
+        t = sin(t * (M_PI / 2));
+        evas_object_move(VIEW(it), item->rx + ((item->tx - item->rx) * t),
+                         item->ry + ((item->ty - item->ry) * t));
+     }
+   if (sd->reorder_move.items) return ECORE_CALLBACK_RENEW;
+
+   sd->reorder_move.animator = NULL;
+   if (!sd->reorder_move.on)
+     {  /* released meanwhile, settle with the layout */
+        ecore_job_del(sd->calc_job);
+        sd->calc_job = ecore_job_add(_calc_job, sd->obj);
+     }
+   return ECORE_CALLBACK_CANCEL;
+}
+
+static void
+_reorder_cell_pos_get(Elm_Gengrid_Data *sd,
+                      int idx,
+                      Evas_Coord *x,
+                      Evas_Coord *y)
+{
+   int cx, cy;
+
+   if (sd->horizontal)
+     {
+        cx = idx / sd->nmax;
+        cy = idx % sd->nmax;
+     }
+   else
+     {
+        cx = idx % sd->nmax;
+        cy = idx / sd->nmax;
+     }
+   *x = sd->reorder_move.x + (sd->reorder_move.dir * cx * sd->item_width);
+   *y = sd->reorder_move.y + (cy * sd->item_height);
+}
+
+static int
+_reorder_cell_index_get(Elm_Gengrid_Data *sd,
+                        Evas_Coord px,
+                        Evas_Coord py)
+{
+   Evas_Coord rx, ry;
+   int cx, cy, idx, nmax = sd->nmax;
+
+   if (sd->reorder_move.dir > 0) rx = px - sd->reorder_move.x;
+   else rx = sd->reorder_move.x + sd->item_width - 1 - px;
+   ry = py - sd->reorder_move.y;
+   cx = (rx > 0) ? (rx / sd->item_width) : 0;
+   cy = (ry > 0) ? (ry / sd->item_height) : 0;
+
+   if (sd->horizontal) idx = (cx * nmax) + MIN(cy, nmax - 1);
+   else idx = (cy * nmax) + MIN(cx, nmax - 1);
+   if (idx >= (int)sd->item_count) idx = sd->item_count - 1;
+
+   return idx;
+}
+
+/* Slides a displaced item from where it is now to cell idx. Items not
+ * realized are put in place when they get realized. */
+static void
+_reorder_move_item(Elm_Gengrid_Data *sd,
+                   Elm_Gen_Item *it,
+                   int idx)
+{
+   Elm_Gen_Item_Type *item = GG_IT(it);
+
+   if (!it->realized) return;
+
+   ELM_SAFE_FREE(item->item_reorder_move_animator, ecore_animator_del);
+   evas_object_geometry_get(VIEW(it), &item->rx, &item->ry, NULL, NULL);
+   _reorder_cell_pos_get(sd, idx, &item->tx, &item->ty);
+   item->moving_effect_start_time = ecore_loop_time_get();
+   if (!item->moving)
+     {
+        item->moving = EINA_TRUE;
+        sd->reorder_move.items = eina_list_append(sd->reorder_move.items, it);
+     }
+   if (!sd->reorder_move.animator)
+     sd->reorder_move.animator =
+       ecore_animator_add(_reorder_move_animator_cb, sd);
+}
+
+static void
+_reorder_move_start(Elm_Gengrid_Data *sd)
+{
+   Elm_Gen_Item *it = sd->reorder_it;
+   Evas_Coord x, y;
+
+   /* group items break the lattice, those grids are left to the layout */
+   sd->reorder_move.on = ((!sd->group_items) && (sd->nmax > 0) &&
+                          (sd->item_width > 0) && (sd->item_height > 0) &&
+                          (it->realized));
+   if (!sd->reorder_move.on) return;
+
+   sd->reorder_move.dir = elm_widget_mirrored_get(sd->obj) ? -1 : 1;
+   if (sd->horizontal)
+     sd->reorder_move.index = (it->x * sd->nmax) + it->y;
+   else
+     sd->reorder_move.index = (it->y * sd->nmax) + it->x;
+
+   evas_object_geometry_get(VIEW(it), &x, &y, NULL, NULL);
+   sd->reorder_move.x = x - (sd->reorder_move.dir * it->x * sd->item_width);
+   sd->reorder_move.y = y - (it->y * sd->item_height);
+}
+
+/* Ends the drag. With finish, the displaced items still sliding go on to
+ * their cells, else they are left where they are to the layout. */
+static void
+_reorder_move_stop(Elm_Gengrid_Data *sd, Eina_Bool finish)
+{
+   Elm_Gen_Item *it;
+
+   sd->reorder_move.on = EINA_FALSE;
+   if ((finish) && (sd->reorder_move.animator)) return;
+
+   EINA_LIST_FREE(sd->reorder_move.items, it)
+     GG_IT(it)->moving = EINA_FALSE;
+   ELM_SAFE_FREE(sd->reorder_move.animator, ecore_animator_del);
+}
+
+/* Follows the pointer: only the items between the old and the new cell
+ * of reorder_it move, and it is relinked once in sd->items. */
+static void
+_reorder_move_update(Elm_Gengrid_Data *sd)
+{
+   Elm_Gen_Item *it = sd->reorder_it;
+   Eina_Inlist *itr = EINA_INLIST_GET(it);
+   int from = sd->reorder_move.index, to, i = from;
+
+   evas_object_move(VIEW(it), sd->reorder_item_x, sd->reorder_item_y);
+
+   to = _reorder_cell_index_get(sd,
+                                sd->reorder_item_x + (sd->item_width / 2),
+                                sd->reorder_item_y + (sd->item_height / 2));
+
+   /* the items in between shift one cell toward the one left free */
+   while ((i < to) && (itr->next))
+     {
+        itr = itr->next;
+        _reorder_move_item(sd, ELM_GEN_ITEM_FROM_INLIST(itr), i++);
+     }
+   while ((i > to) && (itr->prev))
+     {
+        itr = itr->prev;
+        _reorder_move_item(sd, ELM_GEN_ITEM_FROM_INLIST(itr), i--);
+     }
+   if (i == from) return;
+
+   sd->items = eina_inlist_remove(sd->items, EINA_INLIST_GET(it));
+   if (i > from)
+     sd->items = eina_inlist_append_relative
+         (sd->items, EINA_INLIST_GET(it), itr);
+   else
+     sd->items = eina_inlist_prepend_relative
+         (sd->items, EINA_INLIST_GET(it), itr);
+   sd->reorder_move.index = i;
+}
+
 static void
 _item_mouse_move_cb(void *data,
                     Evas *evas EINA_UNUSED,
@@ -597,8 +780,13 @@ _item_mouse_move_cb(void *data,
                sd->reorder_item_y = oy + oh - sd->item_height;
              else sd->reorder_item_y = it_scrl_y;
 
-             ecore_job_del(sd->calc_job);
-             sd->calc_job = ecore_job_add(_calc_job, sd->obj);
+             if (sd->reorder_move.on)
+               _reorder_move_update(sd);
+             else
+               {
+                  ecore_job_del(sd->calc_job);
+                  sd->calc_job = ecore_job_add(_calc_job, sd->obj);
+               }
           }
         return;
      }
@@ -691,6 +879,7 @@ _long_press_cb(void *data)
 
         elm_interface_scrollable_bounce_allow_set(WIDGET(it), EINA_FALSE, EINA_FALSE);
         edje_object_signal_emit(VIEW(it), "elm,state,reorder,enabled", "elm");
+        _reorder_move_start(sd);
      }
 
    return ECORE_CALLBACK_CANCEL;
@@ -1069,6 +1258,7 @@ _item_mouse_up_cb(void *data,
      {
         eo_event_callback_call
           (WIDGET(it), ELM_WIDGET_EVENT_MOVED, EO_OBJ(sd->reorder_it));
+        _reorder_move_stop(sd, EINA_TRUE);
         sd->reorder_it = NULL;
         sd->move_effect_enabled = EINA_FALSE;
         ecore_job_del(sd->calc_job);
@@ -1670,6 +1860,13 @@ _item_place(Elm_Gen_Item *it,
                        evas_object_resize(VIEW(it), iw, ih);
                        return;
                     }
+                  else if (wsd->reorder_move.on)
+                    {
+                       /* keep the lattice in step with the layout */
+                       wsd->reorder_move.x =
+                         x - (wsd->reorder_move.dir * cx * wsd->item_width);
+                       wsd->reorder_move.y = y - (cy * wsd->item_height);
+                    }
                   else
                     {
                        Evas_Coord nx, ny, nw, nh;
@@ -1776,6 +1973,8 @@ _item_place(Elm_Gen_Item *it,
                                 ecore_animator_del);
                   item->moving = EINA_FALSE;
                }
+             /* still sliding to its cell after the drag */
+             else if (item->moving) return;
           }
         if (!it->group)
           {
@@ -3821,6 +4020,8 @@ _elm_gengrid_item_del_serious(Elm_Gen_Item *it)
    ELM_GENGRID_DATA_GET_FROM_ITEM(it, sd);
 
    sd->item_count--;
+   /* the cells of the items moved, let the layout finish the reorder */
+   _reorder_move_stop(sd, EINA_FALSE);
    _elm_gengrid_item_del_not_serious(it);
    sd->items = eina_inlist_remove(sd->items, EINA_INLIST_GET(it));
    if (it->tooltip.del_cb)
@@ -4190,6 +4391,7 @@ _elm_gengrid_item_new(Elm_Gengrid_Data *sd,
    it->group = it->itc->item_style &&
      (!strcmp(it->itc->item_style, "group_index"));
    sd->item_count++;
+   _reorder_move_stop(sd, EINA_FALSE);
 
   return it;
 }
@@ -5020,6 +5222,7 @@ EOLIAN static void
 _elm_gengrid_reorder_mode_set(Eo *obj EINA_UNUSED, Elm_Gengrid_Data *sd, Eina_Bool reorder_mode)
 {
    sd->reorder_mode = !!reorder_mode;
+   if (!sd->reorder_mode) _reorder_move_stop(sd, EINA_FALSE);
 }
 
 EOLIAN static Eina_Bool
@@ -28,18 +28,8 @@
 #define RAD2DEG(x) ((x) * 57.295779513)
 #define DEG2RAD(x) ((x) / 57.295779513)
 
-static void *
-_glayer_buf_dup(void *buf, size_t size)
-{
-   void *p;
-
-   p = malloc(size);
-   memcpy(p, buf, size);
-
-   return p;
-}
-
-#define COPY_EVENT_INFO(EV) _glayer_buf_dup(EV, sizeof(*EV))
+/* Initial number of event slots kept for refeeding */
+#define ELM_GESTURE_EVENT_HISTORY_SIZE 64
 
 #define SET_TEST_BIT(P)                               \
   do {                                                \
@@ -239,19 +229,43 @@ static Tests_Array_Funcs _glayer_tests_array[] = {
    { NULL, NULL, NULL }
 };
 
+/**
+ * @internal
+ *
+ * @union _Event_Info_Buf
+ * Storage big enough for a copy of any input event the layer keeps
+ * in its history.
+ *
+ * @ingroup Elm_Gesture_Layer
+ */
+union _Event_Info_Buf
+{
+   Evas_Event_Mouse_Down  mouse_down;
+   Evas_Event_Mouse_Move  mouse_move;
+   Evas_Event_Mouse_Up    mouse_up;
+   Evas_Event_Mouse_Wheel mouse_wheel;
+   Evas_Event_Multi_Down  multi_down;
+   Evas_Event_Multi_Move  multi_move;
+   Evas_Event_Multi_Up    multi_up;
+   Evas_Event_Key_Down    key_down;
+   Evas_Event_Key_Up      key_up;
+};
+typedef union _Event_Info_Buf Event_Info_Buf;
+
 /**
  * @internal
  *
  * @struct _Event_History
  * Struct holds event history.
  * These events are repeated if no gesture found.
+ * Entries are slots of a preallocated array, so recording an event
+ * is a plain copy on the input path.
  *
  * @ingroup Elm_Gesture_Layer
  */
 struct _Event_History
 {
-   EINA_INLIST;
-   void              *event;
+   Event_Info_Buf     event;
    Evas_Callback_Type event_type;
 };
 
@@ -361,7 +375,9 @@ typedef struct _Elm_Gesture_Layer_Data Elm_Gesture_Layer_Data;
 struct _Elm_Gesture_Layer_Data
 {
    Evas_Object          *target; /* Target Widget */
-   Event_History        *event_history_list;
+   Event_History        *event_history; /* Slots, refeed in order */
+   unsigned int          event_history_count; /* Slots in use */
+   unsigned int          event_history_size; /* Slots allocated */
 
    int                   line_min_length;
    Evas_Coord            zoom_distance_tolerance;
@@ -773,61 +789,74 @@ _pointer_event_make(void *data EINA_UNUSED,
  * @internal
  *
  * This function copies input events.
- * We copy event info before adding it to history.
- * The memory is freed when we clear history.
+ * We copy event info into a history slot before refeeding it.
  *
  * @param event the event to copy
  * @param event_type event type to copy
+ * @param buf the slot to copy event into
+ * @return EINA_FALSE if the event type is not kept in history
  *
  * @ingroup Elm_Gesture_Layer
  */
-static void *
+static Eina_Bool
 _event_info_copy(void *event,
-                 Evas_Callback_Type event_type)
+                 Evas_Callback_Type event_type,
+                 Event_Info_Buf *buf)
 {
    switch (event_type)
      {
       case EVAS_CALLBACK_MOUSE_DOWN:
-        return COPY_EVENT_INFO((Evas_Event_Mouse_Down *)event);
+        buf->mouse_down = *(Evas_Event_Mouse_Down *)event;
         break;
 
       case EVAS_CALLBACK_MOUSE_MOVE:
-        return COPY_EVENT_INFO((Evas_Event_Mouse_Move *)event);
+        buf->mouse_move = *(Evas_Event_Mouse_Move *)event;
         break;
 
       case EVAS_CALLBACK_MOUSE_UP:
-        return COPY_EVENT_INFO((Evas_Event_Mouse_Up *)event);
+        buf->mouse_up = *(Evas_Event_Mouse_Up *)event;
         break;
 
       case EVAS_CALLBACK_MOUSE_WHEEL:
-        return COPY_EVENT_INFO((Evas_Event_Mouse_Wheel *)event);
+        buf->mouse_wheel = *(Evas_Event_Mouse_Wheel *)event;
         break;
 
       case EVAS_CALLBACK_MULTI_DOWN:
-        return COPY_EVENT_INFO((Evas_Event_Multi_Down *)event);
+        buf->multi_down = *(Evas_Event_Multi_Down *)event;
         break;
 
       case EVAS_CALLBACK_MULTI_MOVE:
-        return COPY_EVENT_INFO((Evas_Event_Multi_Move *)event);
+        buf->multi_move = *(Evas_Event_Multi_Move *)event;
         break;
 
       case EVAS_CALLBACK_MULTI_UP:
-        return COPY_EVENT_INFO((Evas_Event_Multi_Up *)event);
+        buf->multi_up = *(Evas_Event_Multi_Up *)event;
         break;
 
       case EVAS_CALLBACK_KEY_DOWN:
-        return COPY_EVENT_INFO((Evas_Event_Key_Down *)event);
+        buf->key_down = *(Evas_Event_Key_Down *)event;
         break;
 
       case EVAS_CALLBACK_KEY_UP:
-        return COPY_EVENT_INFO((Evas_Event_Key_Up *)event);
+        buf->key_up = *(Evas_Event_Key_Up *)event;
         break;
 
       default:
-        return NULL;
+        return EINA_FALSE;
      }
+
+   return EINA_TRUE;
 }
 
+/**
+ * @internal
+ *
+ * Record an event in history.
+ * Slots are only allocated when history grows past what was needed
+ * by a previous gesture, and are reused after each clear.
+ *
+ * @ingroup Elm_Gesture_Layer
+ */
 static Eina_Bool
 _event_history_add(Evas_Object *obj,
                    void *event,
@@ -837,12 +866,21 @@ _event_history_add(Evas_Object *obj,
 
    ELM_GESTURE_LAYER_DATA_GET(obj, sd);
 
-   ev = malloc(sizeof(Event_History));
-   ev->event = _event_info_copy(event, event_type);  /* Freed on
-                                                      * _event_history_clear */
+   if (sd->event_history_count == sd->event_history_size)
+     {
+        unsigned int size = sd->event_history_size ?
+          (sd->event_history_size * 2) : ELM_GESTURE_EVENT_HISTORY_SIZE;
+
+        ev = realloc(sd->event_history, size * sizeof(Event_History));
+        if (!ev) return EINA_FALSE;
+        sd->event_history = ev;
+        sd->event_history_size = size;
+     }
+
+   ev = sd->event_history + sd->event_history_count;
+   if (!_event_info_copy(event, event_type, &ev->event)) return EINA_FALSE;
    ev->event_type = event_type;
-   sd->event_history_list = (Event_History *)eina_inlist_append(
-       EINA_INLIST_GET(sd->event_history_list), EINA_INLIST_GET(ev));
+   sd->event_history_count++;
 
    return EINA_TRUE;
 }
@@ -1149,6 +1187,7 @@ static Eina_Bool
 _event_history_clear(Evas_Object *obj)
 {
    int i;
+   unsigned int n;
    Gesture_Info *p;
    Evas *e = evas_object_evas_get(obj);
    Eina_Bool gesture_found = EINA_FALSE;
@@ -1189,19 +1228,16 @@ _event_history_clear(Evas_Object *obj)
 
    /* Disable gesture layer so refeeded events won't be consumed by it */
    _callbacks_unregister(obj);
-   while (sd->event_history_list)
+   for (n = 0; n < sd->event_history_count; n++)
      {
-        Event_History *t;
-        t = sd->event_history_list;
+        Event_History *t = sd->event_history + n;
         Eina_List *pending = _device_is_pending
-            (sd->pending, sd->event_history_list->event,
-            sd->event_history_list->event_type);
+            (sd->pending, &t->event, t->event_type);
 
         /* Refeed events if no gesture matched input */
         if (pending || ((!gesture_found) && (!sd->repeat_events)))
           {
-             evas_event_refeed_event(e, sd->event_history_list->event,
-                                     sd->event_history_list->event_type);
+             evas_event_refeed_event(e, &t->event, t->event_type);
 
              if (pending)
                {
@@ -1210,17 +1246,11 @@ _event_history_clear(Evas_Object *obj)
              else
                {
                   sd->pending = _pending_device_add
-                      (sd->pending, sd->event_history_list->event,
-                      sd->event_history_list->event_type);
+                      (sd->pending, &t->event, t->event_type);
                }
           }
-
-        free(sd->event_history_list->event);
-        sd->event_history_list = (Event_History *)eina_inlist_remove(
-            EINA_INLIST_GET(sd->event_history_list),
-            EINA_INLIST_GET(sd->event_history_list));
-        free(t);
      }
+   sd->event_history_count = 0;
    _callbacks_register(obj);
    return EINA_TRUE;
 }
@@ -3802,6 +3832,8 @@ _elm_gesture_layer_evas_object_smart_del(Eo *obj, Elm_Gesture_Layer_Data *sd)
 
    /* Then take care of clearing events */
    _event_history_clear(obj);
+   ELM_SAFE_FREE(sd->event_history, free);
+   sd->event_history_size = 0;
    sd->pending = eina_list_free(sd->pending);
 
    EINA_LIST_FREE(sd->touched, data)
@@ -78,28 +78,287 @@ _on_mouse_up(void *data,
    eo_event_callback_call(data, EVAS_CLICKABLE_INTERFACE_EVENT_CLICKED, NULL);
 }
 
+/* All playing animated images are advanced from one animator instead of
+ * a timer each. Images that are hidden or clipped out are skipped, and
+ * when none is on screen the animator is swapped for a slow poll so an
+ * idle application does not wake up every frame. */
+static Eina_List *_anim_images = NULL;
+static Ecore_Animator *_anim_animator = NULL;
+static Ecore_Timer *_anim_poll = NULL;
+
+#define ANIM_POLL_INTERVAL 0.25
+
+static Eina_Bool _elm_image_anim_tick(void *data);
+
+static double
+_elm_image_anim_duration(Elm_Image_Data *sd, int frame)
+{
+   double d;
+
+   if ((sd->sched.durations) && (frame >= 1) && (frame <= sd->frame_count))
+     return sd->sched.durations[frame - 1];
+
+   d = evas_object_image_animated_frame_duration_get(sd->img, frame, 0);
+   if (d > 0) sd->frame_duration = d;
+   return (sd->frame_duration > 0) ? sd->frame_duration : 0.1;
+}
+
+static void
+_elm_image_anim_durations_fill(Elm_Image_Data *sd)
+{
+   double d, prev = 0.1;
+   int i;
+
+   ELM_SAFE_FREE(sd->sched.durations, free);
+   if (sd->frame_count <= 0) return;
+
+   sd->sched.durations = malloc(sd->frame_count * sizeof(double));
+   if (!sd->sched.durations) return;
+   /* like the old per image timer, a frame without a duration keeps the
+    * previous frame's */
+   for (i = 0; i < sd->frame_count; i++)
+     {
+        d = evas_object_image_animated_frame_duration_get(sd->img, i + 1, 0);
+        if (d > 0) prev = d;
+        sd->sched.durations[i] = prev;
+     }
+}
+
+static int
+_elm_image_anim_frame_next(Elm_Image_Data *sd, int frame)
+{
+   frame++;
+   if ((sd->frame_count > 0) && (frame > sd->frame_count))
+     frame = frame % sd->frame_count;
+   return frame;
+}
+
+/* Hidden image objects on the same file hold the next frames, each
+ * preloaded so evas decodes it on its loader thread. Decoded frames are
+ * kept with the image cache entry, so setting one on sd->img once it
+ * is due does not decode it on the main loop again. Ring objects whose
+ * frame is still upcoming are left alone, the others take the missing
+ * frames. */
+static void
+_elm_image_anim_ring_fill(Elm_Image_Data *sd)
+{
+   int want[ELM_IMAGE_ANIM_PRELOAD_FRAMES];
+   const char *file = NULL, *key = NULL;
+   Eina_Bool used[ELM_IMAGE_ANIM_PRELOAD_FRAMES] = { EINA_FALSE };
+   int i, j, n = 0, frame = sd->cur_frame;
+
+   if (sd->frame_count <= 1) return;
+   evas_object_image_file_get(sd->img, &file, &key);
+   if (!file) return;
+
+   for (i = 0; i < ELM_IMAGE_ANIM_PRELOAD_FRAMES; i++)
+     {
+        frame = _elm_image_anim_frame_next(sd, frame);
+        if (frame == sd->cur_frame) break;
+        want[n++] = frame;
+     }
+
+   /* keep the objects already holding a wanted frame */
+   for (i = 0; i < n; i++)
+     for (j = 0; j < ELM_IMAGE_ANIM_PRELOAD_FRAMES; j++)
+       {
+          if (used[j] || !sd->sched.ring[j] ||
+              (sd->sched.ring_frame[j] != want[i]))
+            continue;
+          used[j] = EINA_TRUE;
+          want[i] = 0;
+          break;
+       }
+
+   for (i = 0; i < n; i++)
+     {
+        if (!want[i]) continue;
+        j = 0;
+        while (used[j]) j++;
+        used[j] = EINA_TRUE;
+
+        if (!sd->sched.ring[j])
+          {
+             sd->sched.ring[j] =
+               evas_object_image_add(evas_object_evas_get(sd->img));
+             evas_object_image_file_set(sd->sched.ring[j], file, key);
+          }
+        sd->sched.ring_frame[j] = want[i];
+        evas_object_image_animated_frame_set(sd->sched.ring[j], want[i]);
+        evas_object_image_preload(sd->sched.ring[j], EINA_FALSE);
+     }
+}
+
+static void
+_elm_image_anim_ring_free(Elm_Image_Data *sd)
+{
+   int i;
+
+   for (i = 0; i < ELM_IMAGE_ANIM_PRELOAD_FRAMES; i++)
+     {
+        ELM_SAFE_FREE(sd->sched.ring[i], evas_object_del);
+        sd->sched.ring_frame[i] = 0;
+     }
+}
+
 static Eina_Bool
-_elm_image_animate_cb(void *data)
+_elm_image_anim_visible(Evas_Object *obj, Elm_Image_Data *sd)
+{
+   Evas_Coord x, y, w, h, cx, cy, cw, ch;
+   Evas_Object *o;
+
+   if ((!sd->show) || (!evas_object_visible_get(sd->img))) return EINA_FALSE;
+
+   for (o = evas_object_smart_parent_get(obj); o;
+        o = evas_object_smart_parent_get(o))
+     if (!evas_object_visible_get(o)) return EINA_FALSE;
+
+   evas_object_geometry_get(sd->img, &x, &y, &w, &h);
+   if ((w <= 0) || (h <= 0)) return EINA_FALSE;
+
+   evas_output_viewport_get(evas_object_evas_get(obj), &cx, &cy, &cw, &ch);
+   if (!ELM_RECTS_INTERSECT(x, y, w, h, cx, cy, cw, ch)) return EINA_FALSE;
+
+   for (o = evas_object_clip_get(sd->img); o; o = evas_object_clip_get(o))
+     {
+        if (!evas_object_visible_get(o)) return EINA_FALSE;
+        evas_object_geometry_get(o, &cx, &cy, &cw, &ch);
+        if (!ELM_RECTS_INTERSECT(x, y, w, h, cx, cy, cw, ch))
+          return EINA_FALSE;
+     }
+
+   return EINA_TRUE;
+}
+
+static void
+_elm_image_anim_advance(Elm_Image_Data *sd, double now)
 {
-   ELM_IMAGE_DATA_GET(data, sd);
+   int frame = sd->cur_frame, steps = 0;
 
-   if (!sd->anim) return ECORE_CALLBACK_CANCEL;
+   /* jump straight to the frame due now, only that one gets decoded */
+   while (sd->sched.next <= now)
+     {
+        frame = _elm_image_anim_frame_next(sd, frame);
+        sd->sched.next += _elm_image_anim_duration(sd, frame);
+        steps++;
 
-   sd->cur_frame++;
-   if ((sd->frame_count > 0) && (sd->cur_frame > sd->frame_count))
-     sd->cur_frame = sd->cur_frame % sd->frame_count;
+        /* stalled for more than a whole loop: restart the clock */
+        if (steps > ((sd->frame_count > 0) ? sd->frame_count : 100))
+          {
+             sd->sched.next = now + _elm_image_anim_duration(sd, frame);
+             break;
+          }
+     }
+   if (!steps) return;
 
+   /* the ring first, so the frame shown is the last one set */
+   sd->cur_frame = frame;
+   _elm_image_anim_ring_fill(sd);
    evas_object_image_animated_frame_set(sd->img, sd->cur_frame);
+   sd->sched.shown++;
+   sd->sched.dropped += steps - 1;
+}
+
+static Eina_Bool
+_elm_image_anim_poll_cb(void *data EINA_UNUSED)
+{
+   const Eina_List *l;
+   Evas_Object *obj;
 
-   sd->frame_duration = evas_object_image_animated_frame_duration_get
-       (sd->img, sd->cur_frame, 0);
+   EINA_LIST_FOREACH(_anim_images, l, obj)
+     {
+        ELM_IMAGE_DATA_GET(obj, sd);
 
-   if (sd->frame_duration > 0)
-     ecore_timer_interval_set(sd->anim_timer, sd->frame_duration);
+        if (!_elm_image_anim_visible(obj, sd)) continue;
+
+        _anim_poll = NULL;
+        _anim_animator = ecore_animator_add(_elm_image_anim_tick, NULL);
+        return ECORE_CALLBACK_CANCEL;
+     }
 
    return ECORE_CALLBACK_RENEW;
 }
 
+static Eina_Bool
+_elm_image_anim_tick(void *data EINA_UNUSED)
+{
+   double now = ecore_loop_time_get();
+   Eina_Bool visible = EINA_FALSE;
+   const Eina_List *l;
+   Evas_Object *obj;
+
+   EINA_LIST_FOREACH(_anim_images, l, obj)
+     {
+        ELM_IMAGE_DATA_GET(obj, sd);
+
+        if (!_elm_image_anim_visible(obj, sd))
+          {
+             sd->sched.paused = EINA_TRUE;
+             continue;
+          }
+        visible = EINA_TRUE;
+
+        /* resume where it stopped instead of catching up */
+        if (sd->sched.paused)
+          {
+             sd->sched.paused = EINA_FALSE;
+             sd->sched.next =
+               now + _elm_image_anim_duration(sd, sd->cur_frame);
+             continue;
+          }
+
+        _elm_image_anim_advance(sd, now);
+     }
+
+   if (visible) return ECORE_CALLBACK_RENEW;
+
+   _anim_animator = NULL;
+   _anim_poll = ecore_timer_add(ANIM_POLL_INTERVAL, _elm_image_anim_poll_cb, NULL);
+   return ECORE_CALLBACK_CANCEL;
+}
+
+/* brings back the animator at once when an image shows up */
+static void
+_elm_image_anim_wake(void)
+{
+   if (!_anim_poll) return;
+
+   ELM_SAFE_FREE(_anim_poll, ecore_timer_del);
+   _anim_animator = ecore_animator_add(_elm_image_anim_tick, NULL);
+}
+
+static void
+_elm_image_anim_start(Evas_Object *obj, Elm_Image_Data *sd)
+{
+   if (sd->sched.node) return;
+
+   _anim_images = eina_list_append(_anim_images, obj);
+   sd->sched.node = eina_list_last(_anim_images);
+   sd->sched.paused = EINA_FALSE;
+   sd->sched.next =
+     ecore_loop_time_get() + _elm_image_anim_duration(sd, sd->cur_frame);
+   _elm_image_anim_ring_fill(sd);
+
+   if (!_anim_animator && !_anim_poll)
+     _anim_animator = ecore_animator_add(_elm_image_anim_tick, NULL);
+   else
+     _elm_image_anim_wake();
+}
+
+static void
+_elm_image_anim_stop(Elm_Image_Data *sd)
+{
+   if (!sd->sched.node) return;
+
+   _anim_images = eina_list_remove_list(_anim_images, sd->sched.node);
+   sd->sched.node = NULL;
+   _elm_image_anim_ring_free(sd);
+
+   if (_anim_images) return;
+   ELM_SAFE_FREE(_anim_animator, ecore_animator_del);
+   ELM_SAFE_FREE(_anim_poll, ecore_timer_del);
+}
+
 static Evas_Object *
 _img_new(Evas_Object *obj)
 {
@@ -646,7 +905,8 @@ _elm_image_evas_object_smart_add(Eo *obj, Elm_Image_Data *priv)
 EOLIAN static void
 _elm_image_evas_object_smart_del(Eo *obj, Elm_Image_Data *sd)
 {
-   ecore_timer_del(sd->anim_timer);
+   _elm_image_anim_stop(sd);
+   free(sd->sched.durations);
    evas_object_del(sd->img);
    evas_object_del(sd->prev_img);
    if (sd->remote) _elm_url_cancel(sd->remote);
@@ -712,6 +972,8 @@ _elm_image_evas_object_smart_show(Eo *obj, Elm_Image_Data *sd)
    evas_object_show(sd->img);
 
    ELM_SAFE_FREE(sd->prev_img, evas_object_del);
+
+   if (sd->sched.node) _elm_image_anim_wake();
 }
 
 EOLIAN static void
@@ -1057,10 +1319,13 @@ _elm_image_efl_file_file_set(Eo *obj, Elm_Image_Data *sd, const char *file, cons
 
    if (sd->anim)
      {
-        ELM_SAFE_FREE(sd->anim_timer, ecore_timer_del);
+        _elm_image_anim_stop(sd);
+        ELM_SAFE_FREE(sd->sched.durations, free);
         sd->play = EINA_FALSE;
         sd->anim = EINA_FALSE;
      }
+   sd->sched.shown = 0;
+   sd->sched.dropped = 0;
 
    for (i = 0; i < sizeof (remote_uri) / sizeof (remote_uri[0]); ++i)
      if (file && !strncmp(remote_uri[i], file, strlen(remote_uri[i])))
@@ -1383,10 +1648,14 @@ _elm_image_animated_set_internal(Eo *obj, Elm_Image_Data *sd, Eina_Bool anim)
         sd->frame_duration =
           evas_object_image_animated_frame_duration_get
             (sd->img, sd->cur_frame, 0);
+        _elm_image_anim_durations_fill(sd);
         evas_object_image_animated_frame_set(sd->img, sd->cur_frame);
      }
    else
      {
+        _elm_image_anim_stop(sd);
+        ELM_SAFE_FREE(sd->sched.durations, free);
+        sd->play = EINA_FALSE;
         sd->frame_count = -1;
         sd->cur_frame = -1;
         sd->frame_duration = -1;
@@ -1431,14 +1700,9 @@ _elm_image_animated_play_set_internal(Eo *obj, Elm_Image_Data *sd, Eina_Bool pla
         return;
      }
    if (play)
-     {
-        sd->anim_timer = ecore_timer_add
-            (sd->frame_duration, _elm_image_animate_cb, obj);
-     }
+     _elm_image_anim_start(obj, sd);
    else
-     {
-        ELM_SAFE_FREE(sd->anim_timer, ecore_timer_del);
-     }
+     _elm_image_anim_stop(sd);
 }
 
 static Eina_Bool
@@ -1479,6 +1743,13 @@ _elm_image_efl_player_play_get(Eo *obj, Elm_Image_Data *sd)
    return _elm_image_animated_play_get_internal(obj, sd);
 }
 
+EOLIAN static void
+_elm_image_animated_stats_get(Eo *obj EINA_UNUSED, Elm_Image_Data *sd, unsigned int *shown, unsigned int *dropped)
+{
+   if (shown) *shown = sd->sched.shown;
+   if (dropped) *dropped = sd->sched.dropped;
+}
+
 static void
 _elm_image_class_constructor(Eo_Class *klass)
 {
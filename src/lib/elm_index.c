@@ -40,12 +40,88 @@ static const Evas_Smart_Cb_Description _smart_callbacks[] = {
    {NULL, NULL}
 };
 
+static const char *_item_groups[] =
+{
+   "item/vertical", "item_odd/vertical",
+   "item/horizontal", "item_odd/horizontal"
+};
+
+static Elm_Index_Item_Data *
+_item_selected_find(Elm_Index_Data *sd, int level)
+{
+   Eina_List *l;
+   Elm_Object_Item *eo_item;
+
+   if ((level >= 0) && (level < 2)) return sd->selected[level];
+
+   EINA_LIST_FOREACH(sd->items, l, eo_item)
+     {
+        ELM_INDEX_ITEM_DATA_GET(eo_item, it);
+        if ((it->selected) && (it->level == level)) return it;
+     }
+
+   return NULL;
+}
+
+static void
+_item_selected_mark(Elm_Index_Data *sd,
+                    Elm_Index_Item_Data *it,
+                    Eina_Bool selected)
+{
+   it->selected = selected;
+   if ((it->level < 0) || (it->level > 1)) return;
+
+   if (selected)
+     sd->selected[it->level] = it;
+   else if (sd->selected[it->level] == it)
+     sd->selected[it->level] = NULL;
+}
+
+static void
+_item_shown_append(Elm_Index_Data *sd,
+                   int level,
+                   Elm_Index_Item_Data *it)
+{
+   if (sd->shown_count[level] == sd->shown_size[level])
+     {
+        Elm_Index_Item_Data **tmp;
+        unsigned int size = sd->shown_size[level] ? sd->shown_size[level] * 2 : 32;
+
+        tmp = realloc(sd->shown[level], size * sizeof(Elm_Index_Item_Data *));
+        if (!tmp)
+          {
+             ERR("failed to allocate memory!");
+             return;
+          }
+        sd->shown[level] = tmp;
+        sd->shown_size[level] = size;
+     }
+   sd->shown[level][sd->shown_count[level]++] = it;
+}
+
 static void
 _item_free(Elm_Index_Item_Data *it)
 {
+   unsigned int i;
+
    ELM_INDEX_DATA_GET(WIDGET(it), sd);
 
    sd->items = eina_list_remove(sd->items, EO_OBJ(it));
+   sd->items_changed = EINA_TRUE;
+
+   if ((it->level >= 0) && (it->level < 2))
+     {
+        if (sd->selected[it->level] == it) sd->selected[it->level] = NULL;
+        for (i = 0; i < sd->shown_count[it->level]; i++)
+          {
+             if (sd->shown[it->level][i] != it) continue;
+             sd->shown_count[it->level]--;
+             memmove(sd->shown[it->level] + i, sd->shown[it->level] + i + 1,
+                     (sd->shown_count[it->level] - i) *
+                     sizeof(Elm_Index_Item_Data *));
+             break;
+          }
+     }
 
    if (it->omitted)
      it->omitted = eina_list_free(it->omitted);
@@ -82,6 +158,7 @@ _index_box_clear(Evas_Object *obj,
         evas_object_hide(VIEW(it));
      }
 
+   if (level < 2) sd->shown_count[level] = 0;
    sd->level_active[level] = EINA_FALSE;
 }
 
@@ -203,33 +280,61 @@ _omit_calc(void *data, int num_of_items, int max_num_of_items)
    free(omit_info);
 }
 
+/* the number of items fitting the widget's height, as _omit_calc() wants
+ * it. the item height is measured on a scratch edje object once per
+ * theme. */
+static int
+_omit_max_get(Evas_Object *obj, Elm_Index_Data *sd)
+{
+   Evas_Coord ih, mh = 0;
+   Evas_Object *o;
+   int max_num_of_items = 0;
+
+   ELM_WIDGET_DATA_GET_OR_RETURN(obj, wd, 0);
+   evas_object_geometry_get(wd->resize_obj, NULL, NULL, NULL, &ih);
+
+   if (sd->omit_item_h < 0)
+     {
+        o = edje_object_add(evas_object_evas_get(obj));
+        elm_widget_theme_object_set
+           (obj, o, "index", "item/vertical", elm_widget_style_get(obj));
+
+        edje_object_size_min_restricted_calc(o, NULL, &mh, 0, 0);
+
+        evas_object_del(o);
+        sd->omit_item_h = mh;
+     }
+   mh = sd->omit_item_h;
+
+   if (mh != 0)
+     max_num_of_items = ih / mh;
+   if (sd->group_num)
+     max_num_of_items -= (sd->group_num + sd->default_num - 1);
+
+   return max_num_of_items;
+}
+
 // FIXME: always have index filled
 static void
 _index_box_auto_fill(Evas_Object *obj,
                      int level)
 {
-   int i = 0, max_num_of_items = 0, num_of_items = 0, g = 0, skip = 0;
+   int i = 0, max_num_of_items = 0, num_of_items = 0, g = 0, skip = 0, start;
    Eina_List *l;
-   Eina_Bool rtl;
+   Eina_Bool rtl, star;
    Elm_Object_Item *eo_item;
    Elm_Index_Item_Data *head = NULL, *last_it = NULL;
-   Evas_Coord mw, mh, ih;
    Evas_Object *o;
    Elm_Index_Omit *om;
+   unsigned char group;
    const char *style = elm_widget_style_get(obj);
 
    ELM_INDEX_DATA_GET(obj, sd);
 
    if (sd->level_active[level]) return;
 
-   ELM_WIDGET_DATA_GET_OR_RETURN(obj, wd);
-   evas_object_geometry_get(wd->resize_obj, NULL, NULL, NULL, &ih);
-
    rtl = elm_widget_mirrored_get(obj);
 
-   EINA_LIST_FREE(sd->omit, om)
-     free(om);
-
    EINA_LIST_FOREACH(sd->items, l, eo_item)
      {
         ELM_INDEX_ITEM_DATA_GET(eo_item, it);
@@ -240,26 +345,38 @@ _index_box_auto_fill(Evas_Object *obj,
 
    if (sd->omit_enabled)
      {
-        o = edje_object_add(evas_object_evas_get(obj));
-        elm_widget_theme_object_set
-           (obj, o, "index", "item/vertical", style);
-
-        edje_object_size_min_restricted_calc(o, NULL, &mh, 0, 0);
-
-        evas_object_del(o);
-
         EINA_LIST_FOREACH(sd->items, l, eo_item)
           {
              ELM_INDEX_ITEM_DATA_GET(eo_item, it);
              if (it->level == level && it->priority == sd->show_group) num_of_items++;
           }
 
-        if (mh != 0)
-          max_num_of_items = ih / mh;
-        if (sd->group_num)
-          max_num_of_items -= (sd->group_num + sd->default_num - 1);
+        max_num_of_items = _omit_max_get(obj, sd);
+        if (sd->group_num > 0)
+          start = sd->show_group + sd->default_num;
+        else start = 0;
 
-        _omit_calc(sd, num_of_items, max_num_of_items);
+        // the omit list only depends on these, keep it while they hold
+        if ((!sd->omit_valid) || (sd->omit_level != level) ||
+            (sd->omit_num != num_of_items) ||
+            (sd->omit_max != max_num_of_items) ||
+            (sd->omit_start != start))
+          {
+             EINA_LIST_FREE(sd->omit, om)
+               free(om);
+             _omit_calc(sd, num_of_items, max_num_of_items);
+             sd->omit_level = level;
+             sd->omit_num = num_of_items;
+             sd->omit_max = max_num_of_items;
+             sd->omit_start = start;
+             sd->omit_valid = EINA_TRUE;
+          }
+     }
+   else
+     {
+        EINA_LIST_FREE(sd->omit, om)
+          free(om);
+        sd->omit_valid = EINA_FALSE;
      }
 
    om = eina_list_nth(sd->omit, g);
@@ -320,35 +437,37 @@ _index_box_auto_fill(Evas_Object *obj,
         edje_object_mirrored_set(VIEW(it), rtl);
         o = VIEW(it);
 
-        if (sd->horizontal)
+        /* a view already themed with the same group in this theme is
+         * reused as is, refills after a priority change or a resize then
+         * only touch the box */
+        group = (sd->horizontal ? 2 : 0) + (i & 0x1) + 1;
+        star = (skip > 0);
+        if ((it->theme_group != group) || (it->theme_gen != sd->theme_gen))
           {
-             if (i & 0x1)
-               elm_widget_theme_object_set
-                 (obj, o, "index", "item_odd/horizontal", style);
-             else
-               elm_widget_theme_object_set
-                 (obj, o, "index", "item/horizontal", style);
+             elm_widget_theme_object_set
+               (obj, o, "index", _item_groups[group - 1], style);
+             it->theme_group = group;
+             it->theme_gen = sd->theme_gen;
+             it->star = !star;
           }
-        else
+        else if (!it->selected)
+          edje_object_signal_emit(o, "elm,state,inactive", "elm");
+
+        if (it->star != star)
           {
-             if (i & 0x1)
-               elm_widget_theme_object_set
-                 (obj, o, "index", "item_odd/vertical", style);
+             if (star)
+               edje_object_part_text_escaped_set(o, "elm.text", "*");
              else
-               elm_widget_theme_object_set
-                 (obj, o, "index", "item/vertical", style);
+               edje_object_part_text_escaped_set(o, "elm.text", it->letter);
+             edje_object_size_min_restricted_calc(o, &it->minw, &it->minh, 0, 0);
+             it->star = star;
           }
-
-        if (skip > 0)
-          edje_object_part_text_escaped_set(o, "elm.text", "*");
-        else
-          edje_object_part_text_escaped_set(o, "elm.text", it->letter);
-        edje_object_size_min_restricted_calc(o, &mw, &mh, 0, 0);
-        evas_object_size_hint_min_set(o, mw, mh);
+        evas_object_size_hint_min_set(o, it->minw, it->minh);
         evas_object_size_hint_weight_set(o, EVAS_HINT_EXPAND, EVAS_HINT_EXPAND);
         evas_object_size_hint_align_set(o, EVAS_HINT_FILL, EVAS_HINT_FILL);
         elm_widget_sub_object_add(obj, o);
         evas_object_box_append(sd->bx[level], o);
+        if (level < 2) _item_shown_append(sd, level, it);
         stacking = edje_object_data_get(o, "stacking");
 
         if (it->selected)
@@ -375,6 +494,7 @@ _index_box_auto_fill(Evas_Object *obj,
 
    evas_object_smart_calculate(sd->bx[level]);
    sd->level_active[level] = EINA_TRUE;
+   if (level == 0) sd->items_changed = EINA_FALSE;
 }
 
 static void
@@ -432,6 +552,8 @@ _elm_index_elm_widget_theme_apply(Eo *obj, Elm_Index_Data *sd)
 
    _index_box_clear(obj, 0);
    _index_box_clear(obj, 1);
+   sd->theme_gen++;
+   sd->omit_item_h = -1;
 
    if (sd->horizontal)
      eina_stringshare_replace(&ld->group, "base/horizontal");
@@ -556,6 +678,7 @@ _item_new(Evas_Object *obj,
    WIDGET_ITEM_DATA_SET(EO_OBJ(it), data);
    it->level = sd->level;
    it->priority = -1;
+   sd->items_changed = EINA_TRUE;
 
    return eo_item;
 }
@@ -597,18 +720,83 @@ _delay_change_cb(void *data)
    return ECORE_CALLBACK_CANCEL;
 }
 
+/* the shown item of a level closest to the given point. the box is
+ * homogeneous, so the slot under the point is found from the box geometry
+ * and only its neighbours are measured. */
+static Elm_Index_Item_Data *
+_item_closest_find(Elm_Index_Data *sd,
+                   int level,
+                   Evas_Coord evx,
+                   Evas_Coord evy,
+                   double *cdv)
+{
+   Evas_Coord x, y, w, h, bx, by, bw, bh, xx, yy, pos, extent;
+   Elm_Index_Item_Data *it, *it_closest = NULL;
+   Evas_Coord dist = 0x7fffffff;
+   int n, slot, j, first, last;
+
+   if ((level < 0) || (level > 1)) return NULL;
+   n = sd->shown_count[level];
+   if (!n) return NULL;
+
+   evas_object_geometry_get(sd->bx[level], &bx, &by, &bw, &bh);
+   if (sd->horizontal)
+     {
+        pos = evx - bx;
+        extent = bw;
+     }
+   else
+     {
+        pos = evy - by;
+        extent = bh;
+     }
+
+   first = 0;
+   last = n - 1;
+   if (extent > 0)
+     {
+        if (pos < 0) slot = 0;
+        else if (pos >= extent) slot = n - 1;
+        else slot = (int)(((long long)pos * n) / extent);
+        first = MAX(slot - 1, 0);
+        last = MIN(slot + 1, n - 1);
+     }
+
+   for (j = first; j <= last; j++)
+     {
+        it = sd->shown[level][j];
+        if (!evas_object_visible_get(VIEW(it))) continue;
+
+        evas_object_geometry_get(VIEW(it), &x, &y, &w, &h);
+        xx = x + (w / 2);
+        yy = y + (h / 2);
+        x = evx - xx;
+        y = evy - yy;
+        x = (x * x) + (y * y);
+        if ((x < dist) || (!it_closest))
+          {
+             if (sd->horizontal)
+               *cdv = (double)(xx - bx) / (double)bw;
+             else
+               *cdv = (double)(yy - by) / (double)bh;
+             it_closest = it;
+             dist = x;
+          }
+     }
+
+   return it_closest;
+}
+
 static void
 _sel_eval(Evas_Object *obj,
           Evas_Coord evx,
           Evas_Coord evy)
 {
-   Evas_Coord x, y, w, h, bx, by, bw, bh, xx, yy;
+   Evas_Coord x, y, w, h, xx, yy;
    Elm_Index_Item_Data *it, *it_closest, *it_last, *om_closest;
-   Elm_Object_Item *eo_item;
    char *label = NULL, *last = NULL;
    double cdv = 0.5;
    Evas_Coord dist;
-   Eina_List *l;
    int i, j, size, dh, dx, dy;
 
    ELM_INDEX_DATA_GET(obj, sd);
@@ -619,46 +807,16 @@ _sel_eval(Evas_Object *obj,
         it_last = NULL;
         it_closest = NULL;
         om_closest = NULL;
-        dist = 0x7fffffff;
-        evas_object_geometry_get(sd->bx[i], &bx, &by, &bw, &bh);
 
-        EINA_LIST_FOREACH(sd->items, l, eo_item)
+        if (i != sd->level)
+          it_closest = _item_selected_find(sd, i);
+        else
           {
-             it = eo_data_scope_get(eo_item, ELM_INDEX_ITEM_CLASS);
-             if (it->level != i) continue;
-             if (it->level != sd->level)
-               {
-                  if (it->selected)
-                    {
-                       it_closest = it;
-                       break;
-                    }
-                  continue;
-               }
-             if (it->selected)
-               {
-                  it_last = it;
-                  it->selected = EINA_FALSE;
-               }
-             if (evas_object_visible_get(VIEW(it)))
-               {
-                  evas_object_geometry_get(VIEW(it), &x, &y, &w, &h);
-                  xx = x + (w / 2);
-                  yy = y + (h / 2);
-                  x = evx - xx;
-                  y = evy - yy;
-                  x = (x * x) + (y * y);
-                  if ((x < dist) || (!it_closest))
-                    {
-                       if (sd->horizontal)
-                         cdv = (double)(xx - bx) / (double)bw;
-                       else
-                         cdv = (double)(yy - by) / (double)bh;
-                       it_closest = it;
-                       dist = x;
-                    }
-               }
+             it_last = _item_selected_find(sd, i);
+             if (it_last) _item_selected_mark(sd, it_last, EINA_FALSE);
+             it_closest = _item_closest_find(sd, i, evx, evy, &cdv);
           }
+
         if ((i == 0) && (sd->level == 0))
           edje_object_part_drag_value_set
             (wd->resize_obj, "elm.dragable.index.1", cdv, cdv);
@@ -690,8 +848,13 @@ _sel_eval(Evas_Object *obj,
                }
           }
 
-        if (om_closest) om_closest->selected = EINA_TRUE;
-        else if (it_closest) it_closest->selected = EINA_TRUE;
+        if (om_closest)
+          {
+             if ((it_closest->selected) && (it_closest != om_closest))
+               _item_selected_mark(sd, it_closest, EINA_FALSE);
+             _item_selected_mark(sd, om_closest, EINA_TRUE);
+          }
+        else if (it_closest) _item_selected_mark(sd, it_closest, EINA_TRUE);
 
         if (it_closest != it_last)
           {
@@ -997,6 +1160,12 @@ _index_resize_cb(void *data EINA_UNUSED,
 
    Elm_Object_Item *eo_item;
 
+   // nothing to redo while the same number of items still fits
+   if ((sd->level_active[0]) && (!sd->items_changed) &&
+       (sd->omit_valid) && (sd->omit_level == 0) &&
+       (_omit_max_get(obj, sd) == sd->omit_max))
+     return;
+
    _index_box_clear(obj, 0);
    _index_box_auto_fill(obj, 0);
 
@@ -1081,6 +1250,7 @@ _elm_index_evas_object_smart_add(Eo *obj, Elm_Index_Data *priv)
    evas_object_show(priv->bx[0]);
 
    priv->delay_change_time = INDEX_DELAY_CHANGE_TIME;
+   priv->omit_item_h = -1;
 
    if (edje_object_part_exists
          (wd->resize_obj, "elm.swallow.index.1"))
@@ -1112,6 +1282,9 @@ _elm_index_evas_object_smart_del(Eo *obj, Elm_Index_Data *sd)
    EINA_LIST_FREE(sd->omit, o)
      free(o);
 
+   ELM_SAFE_FREE(sd->shown[0], free);
+   ELM_SAFE_FREE(sd->shown[1], free);
+
    ecore_timer_del(sd->delay);
 
    evas_obj_smart_del(eo_super(obj, MY_CLASS));
@@ -1296,7 +1469,7 @@ _elm_index_item_selected_set(Eo *eo_it,
         if (eo_it_last)
           {
              ELM_INDEX_ITEM_DATA_GET(eo_it_last, it_last);
-             it_last->selected = EINA_FALSE;
+             _item_selected_mark(sd, it_last, EINA_FALSE);
              if (it_last->head)
                it_inactive = it_last->head;
              else
@@ -1307,7 +1480,7 @@ _elm_index_item_selected_set(Eo *eo_it,
              edje_object_message_signal_process(VIEW(it_inactive));
           }
 
-        it_sel->selected = EINA_TRUE;
+        _item_selected_mark(sd, it_sel, EINA_TRUE);
         if (it_sel->head)
           it_active = it_sel->head;
         else
@@ -1326,7 +1499,7 @@ _elm_index_item_selected_set(Eo *eo_it,
      }
    else
      {
-        it_sel->selected = EINA_FALSE;
+        _item_selected_mark(sd, it_sel, EINA_FALSE);
         if (it_sel->head)
           it_inactive = it_sel->head;
         else
@@ -1343,19 +1516,9 @@ _elm_index_item_selected_set(Eo *eo_it,
 EOLIAN static Elm_Object_Item*
 _elm_index_selected_item_get(const Eo *obj EINA_UNUSED, Elm_Index_Data *sd, int level)
 {
-   Eina_List *l;
-   Elm_Object_Item *eo_item;
+   Elm_Index_Item_Data *it = _item_selected_find(sd, level);
 
-   EINA_LIST_FOREACH(sd->items, l, eo_item)
-     {
-        ELM_INDEX_ITEM_DATA_GET(eo_item, it);
-        if ((it->selected) && (it->level == level))
-          {
-             return eo_item;
-          }
-     }
-
-   return NULL;
+   return EO_OBJ(it);
 }
 
 EOLIAN static Elm_Object_Item*
@@ -1647,13 +1810,17 @@ _elm_index_omit_enabled_get(Eo *obj EINA_UNUSED, Elm_Index_Data *sd)
 EOLIAN static void
 _elm_index_item_priority_set(Eo *eo_it EINA_UNUSED, Elm_Index_Item_Data *it, int priority)
 {
+   ELM_INDEX_DATA_GET(WIDGET(it), sd);
+
    if (priority < -1)
      {
         WRN("priority value should be greater than or equal to -1.");
         return;
      }
 
+   if (it->priority == priority) return;
    it->priority = priority;
+   sd->items_changed = EINA_TRUE;
 }
 
 EOLIAN static void
@@ -1495,6 +1495,20 @@ _elm_interface_scrollable_content_pos_get(Eo *obj EINA_UNUSED, Elm_Scrollable_Sm
    elm_obj_pan_pos_get(sid->pan_obj, x, y);
 }
 
+EOLIAN static Eina_Bool
+_elm_interface_scrollable_predicted_pos_get(Eo *obj EINA_UNUSED, Elm_Scrollable_Smart_Interface_Data *sid, Evas_Coord *x, Evas_Coord *y)
+{
+   if ((!sid->down.momentum_animator) || (!sid->predict.valid))
+     {
+        elm_interface_scrollable_content_pos_get(sid->obj, x, y);
+        return EINA_FALSE;
+     }
+
+   if (x) *x = sid->predict.x;
+   if (y) *y = sid->predict.y;
+   return EINA_TRUE;
+}
+
 EOLIAN static void
 _elm_interface_scrollable_content_pos_set(Eo *obj, Elm_Scrollable_Smart_Interface_Data *sid, Evas_Coord x, Evas_Coord y, Eina_Bool sig)
 {
@@ -2085,10 +2099,127 @@ _paging_is_enabled(Elm_Scrollable_Smart_Interface_Data *sid)
    return EINA_TRUE;
 }
 
+/* Samples older than this, counted back from the release, do not take part
+ * in the velocity fit. */
+#define ELM_SCROLL_FIT_WINDOW 0.1
+
+static void
+_elm_scroll_sample_push(Elm_Scrollable_Smart_Interface_Data *sid,
+                        Evas_Coord x,
+                        Evas_Coord y,
+                        unsigned int timestamp)
+{
+   unsigned int i = sid->down.ring.head;
+
+   sid->down.ring.samples[i].x = x;
+   sid->down.ring.samples[i].y = y;
+   sid->down.ring.samples[i].timestamp =
+     (timestamp / 1000.0) + sid->down.hist.est_timestamp_diff;
+   sid->down.ring.head = (i + 1) % ELM_SCROLL_SAMPLES;
+   if (sid->down.ring.count < ELM_SCROLL_SAMPLES) sid->down.ring.count++;
+}
+
+/* Least squares fit of a straight line through the recent samples: its
+ * slope is the velocity of the finger, in pixels per second. Fails when
+ * the samples do not tell, so the caller can use the averaged history. */
+static Eina_Bool
+_elm_scroll_velocity_fit(Elm_Scrollable_Smart_Interface_Data *sid,
+                         double *vx,
+                         double *vy)
+{
+   double t0, t, st = 0.0, stt = 0.0, sx = 0.0, sy = 0.0, stx = 0.0,
+          sty = 0.0, d;
+   unsigned int i, idx, n = 0;
+
+   *vx = *vy = 0.0;
+   if (sid->down.ring.count < 2) return EINA_FALSE;
+
+   idx = (sid->down.ring.head + ELM_SCROLL_SAMPLES - 1) % ELM_SCROLL_SAMPLES;
+   t0 = sid->down.ring.samples[idx].timestamp;
+   for (i = 0; i < sid->down.ring.count; i++)
+     {
+        idx = (sid->down.ring.head + ELM_SCROLL_SAMPLES - 1 - i) %
+          ELM_SCROLL_SAMPLES;
+        t = sid->down.ring.samples[idx].timestamp - t0;
+        if (t < -ELM_SCROLL_FIT_WINDOW) break;
+        st += t;
+        stt += t * t;
+        sx += sid->down.ring.samples[idx].x;
+        sy += sid->down.ring.samples[idx].y;
+        stx += t * sid->down.ring.samples[idx].x;
+        sty += t * sid->down.ring.samples[idx].y;
+        n++;
+     }
+   // the finger rested before it was lifted, nothing to fling
+   if (n < 2) return EINA_TRUE;
+
+   d = (n * stt) - (st * st);
+   if (d < 1e-9) return EINA_FALSE;
+   *vx = ((n * stx) - (st * sx)) / d;
+   *vy = ((n * sty) - (st * sy)) / d;
+   return EINA_TRUE;
+}
+
+/* Normalized progress, from 0.0 to 1.0, of a flick @p dt seconds after it
+ * started. */
+static double
+_elm_scroll_momentum_progress(Elm_Scrollable_Smart_Interface_Data *sid,
+                              double dt)
+{
+   double at, r;
+
+   r = _elm_config->thumbscroll_min_friction / _elm_config->thumbscroll_friction;
+   at = (double)sqrt(
+      (sid->down.dx * sid->down.dx) + (sid->down.dy * sid->down.dy));
+   at = at < ((1.0 - r) * _elm_config->thumbscroll_friction_standard) ?
+      at : (1.0 - r) * _elm_config->thumbscroll_friction_standard;
+   at = ((at / _elm_config->thumbscroll_friction_standard) + r) *
+      (_elm_config->thumbscroll_friction + sid->down.extra_time);
+   dt = dt / at;
+   if (dt > 1.0) dt = 1.0;
+   return dt;
+}
+
+static void
+_elm_scroll_momentum_predict(Elm_Scrollable_Smart_Interface_Data *sid,
+                             double t)
+{
+   double p;
+   Evas_Coord x, y, minx, miny, maxx, maxy;
+
+   p = _elm_scroll_momentum_progress(sid, t - sid->down.anim_start);
+   p = 1.0 - ((1.0 - p) * (1.0 - p));
+   x = sid->down.sx - lround(sid->down.dx * (_elm_config->thumbscroll_friction +
+                                             sid->down.extra_time) * p);
+   y = sid->down.sy - lround(sid->down.dy * (_elm_config->thumbscroll_friction +
+                                             sid->down.extra_time) * p);
+
+   elm_obj_pan_pos_max_get(sid->pan_obj, &maxx, &maxy);
+   elm_obj_pan_pos_min_get(sid->pan_obj, &minx, &miny);
+   if (!sid->loop_h)
+     {
+        if (x < minx) x = minx;
+        else if (x > minx + maxx) x = minx + maxx;
+     }
+   if (!sid->loop_v)
+     {
+        if (y < miny) y = miny;
+        else if (y > miny + maxy) y = miny + maxy;
+     }
+
+   if ((sid->predict.valid) && (sid->predict.x == x) && (sid->predict.y == y))
+     return;
+   sid->predict.x = x;
+   sid->predict.y = y;
+   sid->predict.valid = EINA_TRUE;
+   eo_event_callback_call
+     (sid->obj, ELM_INTERFACE_SCROLLABLE_EVENT_PREDICTED, NULL);
+}
+
 static Eina_Bool
 _elm_scroll_momentum_animator(void *data, const Eo_Event *event EINA_UNUSED)
 {
-   double t, at, dt, p, r;
+   double t, dt, p, ft = 0.0;
    Elm_Scrollable_Smart_Interface_Data *sid = data;
    Evas_Coord x, y, dx, dy, px, py, maxx, maxy, minx, miny;
    Eina_Bool no_bounce_x_end = EINA_FALSE, no_bounce_y_end = EINA_FALSE;
@@ -2100,23 +2231,32 @@ _elm_scroll_momentum_animator(void *data, const Eo_Event *event EINA_UNUSED)
      }
 
    t = ecore_loop_time_get();
+   // the predictive engine positions the content for the time the frame
+   // will be on screen, one frame after the tick
+   if (sid->down.predict)
+     {
+        ft = ecore_animator_frametime_get();
+        t += ft;
+     }
    dt = t - sid->down.anim_start;
    if (dt >= 0.0)
      {
-        r = _elm_config->thumbscroll_min_friction / _elm_config->thumbscroll_friction;
-        at = (double)sqrt(
-           (sid->down.dx * sid->down.dx) + (sid->down.dy * sid->down.dy));
-        at = at < ((1.0 - r) * _elm_config->thumbscroll_friction_standard) ?
-           at : (1.0 - r) * _elm_config->thumbscroll_friction_standard;
-        at = ((at / _elm_config->thumbscroll_friction_standard) + r) *
-           (_elm_config->thumbscroll_friction + sid->down.extra_time);
-        dt = dt / at;
-        if (dt > 1.0) dt = 1.0;
+        dt = _elm_scroll_momentum_progress(sid, dt);
         p = 1.0 - ((1.0 - dt) * (1.0 - dt));
-        dx = (sid->down.dx * (_elm_config->thumbscroll_friction +
-                              sid->down.extra_time) * p);
-        dy = (sid->down.dy * (_elm_config->thumbscroll_friction +
-                              sid->down.extra_time) * p);
+        if (sid->down.predict)
+          {
+             dx = lround(sid->down.dx * (_elm_config->thumbscroll_friction +
+                                         sid->down.extra_time) * p);
+             dy = lround(sid->down.dy * (_elm_config->thumbscroll_friction +
+                                         sid->down.extra_time) * p);
+          }
+        else
+          {
+             dx = (sid->down.dx * (_elm_config->thumbscroll_friction +
+                                   sid->down.extra_time) * p);
+             dy = (sid->down.dy * (_elm_config->thumbscroll_friction +
+                                   sid->down.extra_time) * p);
+          }
         sid->down.ax = dx;
         sid->down.ay = dy;
         x = sid->down.sx - dx;
@@ -2136,6 +2276,8 @@ _elm_scroll_momentum_animator(void *data, const Eo_Event *event EINA_UNUSED)
           }
         elm_interface_scrollable_content_pos_set(sid->obj, x, y, EINA_TRUE);
         _elm_scroll_wanted_coordinates_update(sid, x, y);
+        if ((sid->down.predict) && (dt < 1.0))
+          _elm_scroll_momentum_predict(sid, t + ft);
         elm_obj_pan_pos_max_get(sid->pan_obj, &maxx, &maxy);
         elm_obj_pan_pos_min_get(sid->pan_obj, &minx, &miny);
 
@@ -2162,6 +2304,7 @@ _elm_scroll_momentum_animator(void *data, const Eo_Event *event EINA_UNUSED)
              sid->down.ay = 0;
              sid->down.pdx = 0;
              sid->down.pdy = 0;
+             sid->predict.valid = EINA_FALSE;
              if (sid->content_info.resized)
                _elm_scroll_wanted_region_set(sid->obj);
           }
@@ -2471,8 +2614,9 @@ _elm_scroll_mouse_up_event_cb(void *data,
              if ((!sid->hold) && (!sid->freeze))
                {
                   int i;
-                  double t, at, dt;
+                  double t, at, dt, fvx = 0.0, fvy = 0.0;
                   Evas_Coord ax, ay, dx, dy, vel;
+                  Eina_Bool fit = EINA_FALSE;
 
 #ifdef EVTIME
                   t = ev->timestamp / 1000.0;
@@ -2487,6 +2631,15 @@ _elm_scroll_mouse_up_event_cb(void *data,
 #ifdef SCROLLDBG
                   DBG("------ %i %i\n", ev->canvas.x, ev->canvas.y);
 #endif
+                  sid->predict.valid = EINA_FALSE;
+                  if (sid->down.predict)
+                    {
+                       _elm_scroll_sample_push(sid, ev->canvas.x,
+                                               ev->canvas.y, ev->timestamp);
+                       fit = _elm_scroll_velocity_fit(sid, &fvx, &fvy);
+                       fvx *= _elm_config->thumbscroll_sensitivity_friction;
+                       fvy *= _elm_config->thumbscroll_sensitivity_friction;
+                    }
                   for (i = 0; i < 60; i++)
                     {
                        dt = t - sid->down.history[i].timestamp;
@@ -2506,9 +2659,15 @@ _elm_scroll_mouse_up_event_cb(void *data,
                   at /= _elm_config->thumbscroll_sensitivity_friction;
                   dx = ev->canvas.x - ax;
                   dy = ev->canvas.y - ay;
+                  // the fit already gives a velocity, there is no time to
+                  // divide by
+                  if (fit) at = 1.0;
                   if (at > 0)
                     {
-                       vel = sqrt((dx * dx) + (dy * dy)) / at;
+                       if (fit)
+                         vel = sqrt((fvx * fvx) + (fvy * fvy));
+                       else
+                         vel = sqrt((dx * dx) + (dy * dy)) / at;
                        if ((_elm_config->thumbscroll_friction > 0.0) &&
                            (vel > _elm_config->thumbscroll_momentum_threshold))
                          {
@@ -2522,29 +2681,45 @@ _elm_scroll_mouse_up_event_cb(void *data,
                                   (sid->pan_obj, &mx, &my);
                             elm_obj_pan_pos_get(sid->pan_obj, &px, &py);
                             max_d = _elm_config->thumbscroll_flick_distance_tolerance;
-                            if (dx > 0)
-                              {
-                                 if (dx > max_d) dx = max_d;
-                                 sid->down.dx = (sin((M_PI * (double)dx / max_d)
-                                                     - (M_PI / 2)) + 1) * max_d / at;
-                              }
-                            else
-                              {
-                                 if (dx < -max_d) dx = -max_d;
-                                 sid->down.dx = (sin((M_PI * (double)dx / max_d)
-                                                     + (M_PI / 2)) - 1) * max_d / at;
-                              }
-                            if (dy > 0)
+                            if (fit)
                               {
-                                 if (dy > max_d) dy = max_d;
-                                 sid->down.dy = (sin((M_PI * (double)dy / max_d)
-                                                     - (M_PI / 2)) + 1) * max_d / at;
+                                 double vmax = 2.0 * max_d *
+                                   _elm_config->thumbscroll_sensitivity_friction /
+                                   ELM_SCROLL_FIT_WINDOW;
+
+                                 if (fvx > vmax) fvx = vmax;
+                                 else if (fvx < -vmax) fvx = -vmax;
+                                 if (fvy > vmax) fvy = vmax;
+                                 else if (fvy < -vmax) fvy = -vmax;
+                                 sid->down.dx = lround(fvx);
+                                 sid->down.dy = lround(fvy);
                               }
                             else
                               {
-                                 if (dy < -max_d) dy = -max_d;
-                                 sid->down.dy = (sin((M_PI * (double)dy / max_d)
-                                                     + (M_PI / 2)) - 1) * max_d / at;
+                                 if (dx > 0)
+                                   {
+                                      if (dx > max_d) dx = max_d;
+                                      sid->down.dx = (sin((M_PI * (double)dx / max_d)
+                                                          - (M_PI / 2)) + 1) * max_d / at;
+                                   }
+                                 else
+                                   {
+                                      if (dx < -max_d) dx = -max_d;
+                                      sid->down.dx = (sin((M_PI * (double)dx / max_d)
+                                                          + (M_PI / 2)) - 1) * max_d / at;
+                                   }
+                                 if (dy > 0)
+                                   {
+                                      if (dy > max_d) dy = max_d;
+                                      sid->down.dy = (sin((M_PI * (double)dy / max_d)
+                                                          - (M_PI / 2)) + 1) * max_d / at;
+                                   }
+                                 else
+                                   {
+                                      if (dy < -max_d) dy = -max_d;
+                                      sid->down.dy = (sin((M_PI * (double)dy / max_d)
+                                                          + (M_PI / 2)) - 1) * max_d / at;
+                                   }
                               }
                             if (((sid->down.dx > 0) && (sid->down.pdx > 0)) ||
                                 ((sid->down.dx < 0) && (sid->down.pdx < 0)) ||
@@ -2809,6 +2984,10 @@ _elm_scroll_mouse_down_event_cb(void *data,
         sid->down.dragged_began_timestamp = sid->down.history[0].timestamp;
         sid->down.history[0].x = ev->canvas.x;
         sid->down.history[0].y = ev->canvas.y;
+        sid->down.predict = !!_elm_config->scroll_momentum_predict;
+        sid->down.ring.head = 0;
+        sid->down.ring.count = 0;
+        _elm_scroll_sample_push(sid, ev->canvas.x, ev->canvas.y, ev->timestamp);
      }
    sid->down.dragged_began = EINA_FALSE;
    sid->down.hold_parent = EINA_FALSE;
@@ -3218,6 +3397,9 @@ _elm_scroll_mouse_move_event_cb(void *data,
 #endif
    sid->down.history[0].x = ev->cur.canvas.x;
    sid->down.history[0].y = ev->cur.canvas.y;
+   if (sid->down.predict)
+     _elm_scroll_sample_push(sid, ev->cur.canvas.x, ev->cur.canvas.y,
+                             ev->timestamp);
 
    if (!sid->down.dragged_began)
      {
@@ -54,6 +54,9 @@ typedef void      (*Elm_Interface_Scrollable_Cb)(Evas_Object *, void *data);
 typedef void      (*Elm_Interface_Scrollable_Min_Limit_Cb)(Evas_Object *obj, Eina_Bool w, Eina_Bool h);
 typedef void      (*Elm_Interface_Scrollable_Resize_Cb)(Evas_Object *obj, Evas_Coord w, Evas_Coord h);
 
+/* input samples kept for the velocity fit of the predictive engine */
+#define ELM_SCROLL_SAMPLES 32
+
 typedef struct _Elm_Scrollable_Smart_Interface_Data
   Elm_Scrollable_Smart_Interface_Data;
 struct _Elm_Scrollable_Smart_Interface_Data
@@ -97,6 +100,16 @@ struct _Elm_Scrollable_Smart_Interface_Data
          double est_timestamp_diff;
       } hist;
 
+      struct
+      {
+         struct
+         {
+            Evas_Coord x, y;
+            double     timestamp; /**< event time, in ecore_loop_time_get() units */
+         } samples[ELM_SCROLL_SAMPLES];
+         unsigned int head, count;
+      } ring; /**< drag samples, oldest overwritten first */
+
       double          dragged_began_timestamp;
       double          anim_start;
       double          anim_start2;
@@ -135,8 +148,15 @@ struct _Elm_Scrollable_Smart_Interface_Data
       Eina_Bool       dir_y : 1;
       Eina_Bool       hold : 1;
       Eina_Bool       now : 1;
+      Eina_Bool       predict : 1; /**< this flick uses the predictive engine */
    } down;
 
+   struct
+   {
+      Evas_Coord x, y;
+      Eina_Bool  valid : 1;
+   } predict; /**< where the flick will be on the next frame */
+
    struct
    {
       Evas_Coord w, h;
@@ -113,11 +113,204 @@ _part_cursor_free(Elm_Layout_Sub_Object_Cursor *pc)
    free(pc);
 }
 
+/* process wide counters of the min size memo, for profiling */
+static unsigned int _size_memo_hits = 0;
+static unsigned int _size_memo_misses = 0;
+
+#define SIG_SEED  14695981039346656037ULL
+#define SIG_PRIME 1099511628211ULL
+
+static inline unsigned long long
+_sig_mix(unsigned long long sig, const void *data, size_t len)
+{
+   const unsigned char *p = data;
+
+   while (len--)
+     {
+        sig ^= *p++;
+        sig *= SIG_PRIME;
+     }
+
+   return sig;
+}
+
+static inline unsigned long long
+_sig_mix_str(unsigned long long sig, const char *str)
+{
+   /* the terminator goes in too, so "ab" + "c" != "a" + "bc" */
+   if (!str) str = "";
+   return _sig_mix(sig, str, strlen(str) + 1);
+}
+
+static unsigned long long
+_sig_mix_hints(unsigned long long sig, const Evas_Object *o)
+{
+   Evas_Coord c[8];
+   double d[4];
+   Evas_Aspect_Control aspect;
+
+   evas_object_size_hint_min_get(o, &c[0], &c[1]);
+   evas_object_size_hint_max_get(o, &c[2], &c[3]);
+   evas_object_size_hint_padding_get(o, &c[4], &c[5], &c[6], &c[7]);
+   sig = _sig_mix(sig, c, sizeof(c));
+
+   evas_object_size_hint_weight_get(o, &d[0], &d[1]);
+   evas_object_size_hint_align_get(o, &d[2], &d[3]);
+   sig = _sig_mix(sig, d, sizeof(d));
+
+   evas_object_size_hint_aspect_get(o, &aspect, &c[0], &c[1]);
+   sig = _sig_mix(sig, &aspect, sizeof(aspect));
+   return _sig_mix(sig, c, 2 * sizeof(Evas_Coord));
+}
+
+/* everything edje_object_size_min_restricted_calc() depends on, as far
+ * as the layout can see it: the theme, the restriction, scale and
+ * mirroring, the hints of whatever was handed to the parts, the part
+ * texts and the signals seen by the edje object */
+static unsigned long long
+_sizing_signature_get(Elm_Layout_Smart_Data *sd,
+                      Evas_Object *edje,
+                      Evas_Coord rest_w,
+                      Evas_Coord rest_h)
+{
+   Elm_Layout_Sub_Object_Data *sub_d;
+   unsigned long long sig = SIG_SEED;
+   Evas_Coord rest[2] = { rest_w, rest_h };
+   double scale[2] = { edje_object_scale_get(edje), edje_scale_get() };
+   Eina_Bool mirrored = edje_object_mirrored_get(edje);
+   const Eina_List *l;
+
+   sig = _sig_mix(sig, &sd->signal_epoch, sizeof(sd->signal_epoch));
+   sig = _sig_mix(sig, &sd->signal_states_sig, sizeof(sd->signal_states_sig));
+   sig = _sig_mix(sig, rest, sizeof(rest));
+   sig = _sig_mix(sig, scale, sizeof(scale));
+   sig = _sig_mix(sig, &mirrored, sizeof(mirrored));
+
+   EINA_LIST_FOREACH(sd->subs, l, sub_d)
+     {
+        sig = _sig_mix(sig, &sub_d->type, sizeof(sub_d->type));
+        sig = _sig_mix_str(sig, sub_d->part);
+
+        if (sub_d->type == TEXT)
+          {
+             sig = _sig_mix_str(sig, sub_d->p.text.text);
+             continue;
+          }
+        if (sub_d->type == TABLE_PACK)
+          sig = _sig_mix(sig, &sub_d->p.table, sizeof(sub_d->p.table));
+        if (sub_d->obj) sig = _sig_mix_hints(sig, sub_d->obj);
+     }
+
+   /* 0 marks an unused memo slot */
+   return sig ? sig : 1;
+}
+
+static void
+_size_memo_reset(Elm_Layout_Smart_Data *sd)
+{
+   memset(sd->size_memo, 0, sizeof(sd->size_memo));
+   sd->size_memo_next = 0;
+
+   /* the edje object was (re)loaded, its parts are back to their
+    * default states */
+   if (sd->signal_states) eina_hash_free_buckets(sd->signal_states);
+   sd->signal_states_sig = 0;
+   sd->signal_epoch++;
+}
+
+static inline unsigned long long
+_signal_state_sig(const char *key, uintptr_t value)
+{
+   unsigned long long sig = _sig_mix_str(SIG_SEED, key);
+
+   return _sig_mix(sig, &value, sizeof(value));
+}
+
+static void
+_signal_state_set(Elm_Layout_Smart_Data *sd,
+                  const char *key,
+                  uintptr_t value)
+{
+   uintptr_t old;
+
+   if (!sd->signal_states)
+     {
+        sd->signal_states = eina_hash_string_small_new(NULL);
+        if (!sd->signal_states)
+          {
+             sd->signal_epoch++;
+             return;
+          }
+     }
+
+   old = (uintptr_t)eina_hash_find(sd->signal_states, key);
+   if (old == value) return;
+
+   /* keep the signature order independent, so that the same set of
+    * states always ends up with the same value */
+   if (old) sd->signal_states_sig -= _signal_state_sig(key, old);
+   sd->signal_states_sig += _signal_state_sig(key, value);
+   eina_hash_set(sd->signal_states, key, (void *)value);
+}
+
+/* watches the "elm,state,*" signals going through the layout's edje
+ * object, those that move the theme from state to state. Most of them
+ * come in visible/hidden or enabled/disabled pairs, whose last value is
+ * all that matters for the min size; any other may have moved the theme
+ * to some state we can't describe, so it invalidates the remembered
+ * sizes. Pointer, show/hide and drag signals are not even looked at */
+static void
+_on_size_memo_signal(void *data,
+                     Evas_Object *obj EINA_UNUSED,
+                     const char *emission,
+                     const char *source)
+{
+   char key[1024];
+   const char *sep;
+   uintptr_t value = 0;
+   size_t len = 0;
+
+   ELM_LAYOUT_DATA_GET(data, sd);
+   if (!sd || sd->destructed_is || !emission) return;
+
+   if (!strcmp(emission, "elm,state,enabled") ||
+       !strcmp(emission, "elm,state,disabled"))
+     {
+        /* kept apart from a plain "elm,state,visible" */
+        value = (emission[10] == 'e') ? 1 : 2;
+        len = strlen("elm,state,disabled");
+        emission = "elm,state,disabled";
+     }
+   else if ((sep = strrchr(emission, ',')))
+     {
+        len = sep - emission;
+        if (!strcmp(sep, ",visible")) value = 1;
+        else if (!strcmp(sep, ",hidden")) value = 2;
+     }
+
+   if (!value)
+     {
+        sd->signal_epoch++;
+        return;
+     }
+
+   if (snprintf(key, sizeof(key), "%.*s|%s", (int)len, emission,
+                source ? source : "") >= (int)sizeof(key))
+     {
+        sd->signal_epoch++;
+        return;
+     }
+
+   _signal_state_set(sd, key, value);
+}
+
 static void
 _sizing_eval(Evas_Object *obj, Elm_Layout_Smart_Data *sd)
 {
    Evas_Coord minh = -1, minw = -1;
    Evas_Coord rest_w = 0, rest_h = 0;
+   unsigned long long sig;
+   unsigned int i;
    ELM_WIDGET_DATA_GET_OR_RETURN(sd->obj, wd);
 
    if (sd->restricted_calc_w)
@@ -125,13 +318,53 @@ _sizing_eval(Evas_Object *obj, Elm_Layout_Smart_Data *sd)
    if (sd->restricted_calc_h)
      rest_h = wd->h;
 
-   edje_object_size_min_restricted_calc(wd->resize_obj, &minw, &minh,
-                                        rest_w, rest_h);
+   sig = _sizing_signature_get(sd, wd->resize_obj, rest_w, rest_h);
+   for (i = 0; i < ELM_LAYOUT_SIZE_MEMO_SLOTS; i++)
+     {
+        if (sd->size_memo[i].sig != sig) continue;
+
+        minw = sd->size_memo[i].minw;
+        minh = sd->size_memo[i].minh;
+        sd->size_memo_hits++;
+        _size_memo_hits++;
+        break;
+     }
+
+   if (i == ELM_LAYOUT_SIZE_MEMO_SLOTS)
+     {
+        edje_object_size_min_restricted_calc(wd->resize_obj, &minw, &minh,
+                                             rest_w, rest_h);
+
+        i = sd->size_memo_next;
+        sd->size_memo[i].sig = sig;
+        sd->size_memo[i].minw = minw;
+        sd->size_memo[i].minh = minh;
+        sd->size_memo_next = (i + 1) % ELM_LAYOUT_SIZE_MEMO_SLOTS;
+        sd->size_memo_misses++;
+        _size_memo_misses++;
+     }
+
    evas_object_size_hint_min_set(obj, minw, minh);
 
    sd->restricted_calc_w = sd->restricted_calc_h = EINA_FALSE;
 }
 
+/* hits and misses of the min size memo of obj, or of all layouts for a
+ * NULL obj */
+void
+_elm_layout_size_memo_stats_get(const Evas_Object *obj,
+                                unsigned int *hits,
+                                unsigned int *misses)
+{
+   Elm_Layout_Smart_Data *sd = NULL;
+
+   if (obj && eo_isa(obj, MY_CLASS))
+     sd = eo_data_scope_get(obj, MY_CLASS);
+
+   if (hits) *hits = sd ? sd->size_memo_hits : _size_memo_hits;
+   if (misses) *misses = sd ? sd->size_memo_misses : _size_memo_misses;
+}
+
 /* common content cases for layout objects: icon and text */
 static inline void
 _icon_signal_emit(Elm_Layout_Smart_Data *sd,
@@ -325,6 +558,7 @@ _visuals_refresh(Evas_Object *obj,
 
    ELM_WIDGET_DATA_GET_OR_RETURN(obj, wd, EINA_FALSE);
 
+   _size_memo_reset(sd);
    _parts_swallow_fix(sd, wd);
    _parts_text_fix(sd);
    _parts_signals_emit(sd);
@@ -766,6 +1000,8 @@ _elm_layout_evas_object_smart_add(Eo *obj, Elm_Layout_Smart_Data *_pd EINA_UNUSE
 
    edje_object_signal_callback_add
      (edje, "size,eval", "elm", _on_size_evaluate_signal, obj);
+   edje_object_signal_callback_add
+     (edje, "elm,state,*", "*", _on_size_memo_signal, obj);
 
    elm_obj_layout_sizing_eval(obj);
 }
@@ -809,6 +1045,13 @@ _elm_layout_evas_object_smart_del(Eo *obj, Elm_Layout_Smart_Data *sd)
    eina_stringshare_del(sd->klass);
    eina_stringshare_del(sd->group);
 
+   edje_object_signal_callback_del_full
+     (wd->resize_obj, "elm,state,*", "*", _on_size_memo_signal, obj);
+   ELM_SAFE_FREE(sd->signal_states, eina_hash_free);
+   DBG("min size memo of %p: %u hits, %u misses (all layouts: %u, %u)",
+       obj, sd->size_memo_hits, sd->size_memo_misses,
+       _size_memo_hits, _size_memo_misses);
+
    /* let's make our Edje object the *last* to be processed, since it
     * may (smart) parent other sub objects here */
    EINA_LIST_FOREACH(wd->subobjs, l, child)
@@ -58,7 +58,33 @@ static const Evas_Smart_Cb_Description _smart_callbacks[] = {
    {NULL, NULL}
 };
 
+enum
+{
+   ELM_LIST_PARITY_UNKNOWN = 0,
+   ELM_LIST_PARITY_SIGNAL,
+   ELM_LIST_PARITY_GROUP
+};
+
+enum
+{
+   ELM_LIST_ITEM_POSITION_NONE = 0,
+   ELM_LIST_ITEM_POSITION_SINGLE,
+   ELM_LIST_ITEM_POSITION_FIRST,
+   ELM_LIST_ITEM_POSITION_MIDDLE,
+   ELM_LIST_ITEM_POSITION_LAST
+};
+
+static const char *_item_position_signals[] =
+{
+   NULL,
+   "elm,state,list,single",
+   "elm,state,list,first",
+   "elm,state,list,middle",
+   "elm,state,list,last"
+};
+
 static void _size_hints_changed_cb(void *, Evas *, Evas_Object *, void *);
+static void _item_size_hints_changed_cb(void *, Evas *, Evas_Object *, void *);
 static void _mouse_up_cb(void *, Evas *, Evas_Object *, void *);
 static void _mouse_down_cb(void *, Evas *, Evas_Object *, void *);
 static void _mouse_move_cb(void *, Evas *, Evas_Object *, void *);
@@ -88,6 +114,77 @@ _is_no_select(Elm_List_Item_Data *it)
    return EINA_FALSE;
 }
 
+static void
+_item_part_min_unaccount(Elm_List_Data *sd, Elm_List_Item_Data *it)
+{
+   int p;
+
+   for (p = 0; p < 2; p++)
+     {
+        if ((it->part_minw[p] > 0) &&
+            (it->part_minw[p] == sd->part_min[p].w))
+          sd->part_min[p].w_count--;
+        if ((it->part_minh[p] > 0) &&
+            (it->part_minh[p] == sd->part_min[p].h))
+          sd->part_min[p].h_count--;
+        it->part_minw[p] = it->part_minh[p] = 0;
+     }
+}
+
+static void
+_item_part_min_account(Elm_List_Data *sd, Elm_List_Item_Data *it)
+{
+   Evas_Object *part[2];
+   Evas_Coord mw, mh;
+   int p;
+
+   part[0] = it->dummy_icon ? NULL : it->icon;
+   part[1] = it->dummy_end ? NULL : it->end;
+
+   for (p = 0; p < 2; p++)
+     {
+        if (!part[p]) continue;
+
+        evas_object_size_hint_min_get(part[p], &mw, &mh);
+        it->part_minw[p] = mw;
+        it->part_minh[p] = mh;
+
+        if (mw > sd->part_min[p].w)
+          {
+             sd->part_min[p].w = mw;
+             sd->part_min[p].w_count = 1;
+          }
+        else if ((mw > 0) && (mw == sd->part_min[p].w))
+          sd->part_min[p].w_count++;
+
+        if (mh > sd->part_min[p].h)
+          {
+             sd->part_min[p].h = mh;
+             sd->part_min[p].h_count = 1;
+          }
+        else if ((mh > 0) && (mh == sd->part_min[p].h))
+          sd->part_min[p].h_count++;
+     }
+}
+
+/* only needed when the last item holding a maximum goes away */
+static void
+_items_part_min_rescan(Elm_List_Data *sd)
+{
+   const Eina_List *l;
+   Elm_Object_Item *eo_it;
+
+   memset(sd->part_min, 0, sizeof(sd->part_min));
+
+   EINA_LIST_FOREACH(sd->items, l, eo_it)
+     {
+        ELM_LIST_ITEM_DATA_GET(eo_it, it);
+        if (!it) continue;
+        if (it->deleted) continue;
+        _item_part_min_account(sd, it);
+     }
+}
+
 static inline void
 _elm_list_item_free(Elm_List_Item_Data *it)
 {
@@ -114,12 +211,15 @@ _elm_list_item_free(Elm_List_Item_Data *it)
    if (it->icon)
      evas_object_event_callback_del_full
        (it->icon, EVAS_CALLBACK_CHANGED_SIZE_HINTS,
-       _size_hints_changed_cb, WIDGET(it));
+       _item_size_hints_changed_cb, it);
 
    if (it->end)
      evas_object_event_callback_del_full
        (it->end, EVAS_CALLBACK_CHANGED_SIZE_HINTS,
-       _size_hints_changed_cb, WIDGET(it));
+       _item_size_hints_changed_cb, it);
+
+   _item_part_min_unaccount(sd, it);
+   sd->items_dirty = EINA_TRUE;
 
    ELM_SAFE_FREE(it->label, eina_stringshare_del);
    ELM_SAFE_FREE(it->swipe_timer, ecore_timer_del);
@@ -665,6 +765,7 @@ _elm_list_deletions_process(Elm_List_Data *sd)
    EINA_LIST_FREE(sd->to_delete, it)
      {
         sd->items = eina_list_remove_list(sd->items, it->node);
+        sd->items_dirty = EINA_TRUE;
 
         /* issuing free because of "locking" item del pre hook */
         _elm_list_item_free(it);
@@ -801,14 +902,44 @@ _elm_list_unwalk(Evas_Object *obj, Elm_List_Data *sd)
      }
 }
 
+static void
+_item_theme_set(Evas_Object *obj,
+                Elm_List_Data *sd,
+                Elm_List_Item_Data *it,
+                const char *group,
+                const char *group_odd,
+                const char *style)
+{
+   const char *odd_signal;
+
+   if ((it->even) || (sd->parity_mode != ELM_LIST_PARITY_GROUP))
+     elm_widget_theme_object_set(obj, VIEW(it), "list", group, style);
+
+   // themes advertising "oddsignal" style odd items by signal, saving a
+   // full theme reload whenever an item changes parity
+   if (sd->parity_mode == ELM_LIST_PARITY_UNKNOWN)
+     {
+        odd_signal = edje_object_data_get(VIEW(it), "oddsignal");
+        if ((odd_signal) && (!strcmp(odd_signal, "on")))
+          sd->parity_mode = ELM_LIST_PARITY_SIGNAL;
+        else
+          sd->parity_mode = ELM_LIST_PARITY_GROUP;
+     }
+
+   if (sd->parity_mode == ELM_LIST_PARITY_SIGNAL)
+     edje_object_signal_emit
+       (VIEW(it), it->even ? "elm,state,even" : "elm,state,odd", "elm");
+   else if (!it->even)
+     elm_widget_theme_object_set(obj, VIEW(it), "list", group_odd, style);
+}
+
 static void
 _items_fix(Evas_Object *obj)
 {
-   Evas_Coord minw[2] = { 0, 0 }, minh[2] = { 0, 0 };
    const Eina_List *l;
    Elm_Object_Item *eo_it;
    Evas_Coord mw, mh;
-   int i, redo = 0;
+   int i, position, count, redo = 0;
 
    const char *style;
    const char *it_odd;
@@ -830,38 +961,32 @@ _items_fix(Evas_Object *obj)
         return;
      }
 
-   evas_object_ref(obj);
-   _elm_list_walk(sd); // watch out "return" before unwalk!
+   if (((sd->part_min[0].w > 0) && (!sd->part_min[0].w_count)) ||
+       ((sd->part_min[0].h > 0) && (!sd->part_min[0].h_count)) ||
+       ((sd->part_min[1].w > 0) && (!sd->part_min[1].w_count)) ||
+       ((sd->part_min[1].h > 0) && (!sd->part_min[1].h_count)))
+     _items_part_min_rescan(sd);
 
-   EINA_LIST_FOREACH(sd->items, l, eo_it)
+   if ((sd->part_min[0].w != sd->minw[0]) ||
+       (sd->part_min[1].w != sd->minw[1]) ||
+       (sd->part_min[0].h != sd->minh[0]) ||
+       (sd->part_min[1].h != sd->minh[1]))
      {
-        ELM_LIST_ITEM_DATA_GET(eo_it, it);
-        if (!it) continue;
-        if (it->deleted) continue;
-        if (it->icon)
-          {
-             evas_object_size_hint_min_get(it->icon, &mw, &mh);
-             if (mw > minw[0]) minw[0] = mw;
-             if (mh > minh[0]) minh[0] = mh;
-          }
-        if (it->end)
-          {
-             evas_object_size_hint_min_get(it->end, &mw, &mh);
-             if (mw > minw[1]) minw[1] = mw;
-             if (mh > minh[1]) minh[1] = mh;
-          }
-     }
-
-   if ((minw[0] != sd->minw[0]) || (minw[1] != sd->minw[1]) ||
-       (minh[0] != sd->minh[0]) || (minh[1] != sd->minh[1]))
-     {
-        sd->minw[0] = minw[0];
-        sd->minw[1] = minw[1];
-        sd->minh[0] = minh[0];
-        sd->minh[1] = minh[1];
+        sd->minw[0] = sd->part_min[0].w;
+        sd->minw[1] = sd->part_min[1].w;
+        sd->minh[0] = sd->part_min[0].h;
+        sd->minh[1] = sd->part_min[1].h;
         redo = 1;
      }
 
+   // nothing added, removed or changed since the last fix
+   if ((!redo) && (!sd->items_dirty)) return;
+   sd->items_dirty = EINA_FALSE;
+
+   evas_object_ref(obj);
+   _elm_list_walk(sd); // watch out "return" before unwalk!
+
+   count = eina_list_count(sd->items);
    i = 0;
    EINA_LIST_FOREACH(sd->items, l, eo_it)
      {
@@ -871,7 +996,9 @@ _items_fix(Evas_Object *obj)
           continue;
 
         it->even = i & 0x1;
-        if ((it->even != it->is_even) || (!it->fixed) || (redo))
+        if ((!it->fixed) || (redo) ||
+            ((it->even != it->is_even) &&
+             (sd->parity_mode != ELM_LIST_PARITY_SIGNAL)))
           {
              const char *stacking;
 
@@ -880,23 +1007,10 @@ _items_fix(Evas_Object *obj)
                  (obj, VIEW(it), "separator", sd->h_mode ?
                      "vertical" : "horizontal", style);
              else if (sd->mode == ELM_LIST_COMPRESS)
-               {
-                  if (it->even)
-                    elm_widget_theme_object_set
-                      (obj, VIEW(it), "list", it_compress, style);
-                  else
-                    elm_widget_theme_object_set
-                      (obj, VIEW(it), "list", it_compress_odd, style);
-               }
+               _item_theme_set
+                 (obj, sd, it, it_compress, it_compress_odd, style);
              else
-               {
-                  if (it->even)
-                    elm_widget_theme_object_set
-                      (obj, VIEW(it), "list", it_plain, style);
-                  else
-                    elm_widget_theme_object_set
-                      (obj, VIEW(it), "list", it_odd, style);
-               }
+               _item_theme_set(obj, sd, it, it_plain, it_odd, style);
              stacking = edje_object_data_get(VIEW(it), "stacking");
              if (stacking)
                {
@@ -912,40 +1026,22 @@ _items_fix(Evas_Object *obj)
                      (VIEW(it), "elm.text", it->label);
                   elm_wdg_item_part_text_custom_update(EO_OBJ(it));
 
-                  if ((!it->icon) && (minh[0] > 0))
+                  if ((!it->icon) && (sd->minh[0] > 0))
                     {
                        it->icon = evas_object_rectangle_add
                           (evas_object_evas_get(VIEW(it)));
                        evas_object_color_set(it->icon, 0, 0, 0, 0);
                        it->dummy_icon = EINA_TRUE;
                     }
-                  if ((!it->end) && (minh[1] > 0))
+                  if ((!it->end) && (sd->minh[1] > 0))
                     {
                        it->end = evas_object_rectangle_add
                           (evas_object_evas_get(VIEW(it)));
                        evas_object_color_set(it->end, 0, 0, 0, 0);
                        it->dummy_end = EINA_TRUE;
                     }
-                  if (eina_list_count(sd->items) == 1)
-                    {
-                       edje_object_signal_emit
-                           (VIEW(it), "elm,state,list,single", "elm");
-                    }
-                  else if (l == sd->items) //1st item
-                    {
-                       edje_object_signal_emit
-                           (VIEW(it), "elm,state,list,first", "elm");
-                    }
-                  else if (l == eina_list_last(sd->items))
-                    {
-                       edje_object_signal_emit
-                           (VIEW(it), "elm,state,list,last", "elm");
-                    }
-                  else
-                   {
-                       edje_object_signal_emit
-                           (VIEW(it), "elm,state,list,middle", "elm");
-                   }
+                  // the theme was reloaded, resend the position
+                  it->position = ELM_LIST_ITEM_POSITION_NONE;
                }
              if (!it->fixed)
                {
@@ -993,20 +1089,55 @@ _items_fix(Evas_Object *obj)
 
              it->fixed = EINA_TRUE;
              it->is_even = it->even;
+             it->parts_dirty = EINA_TRUE;
           }
-        if (it->icon)
+        else if (it->even != it->is_even)
           {
-             evas_object_size_hint_min_set(it->icon, minw[0], minh[0]);
-             evas_object_size_hint_max_set(it->icon, 99999, 99999);
-             edje_object_part_swallow
-                (VIEW(it), "elm.swallow.icon", it->icon);
+             if (!it->is_separator)
+               edje_object_signal_emit
+                 (VIEW(it), it->even ? "elm,state,even" : "elm,state,odd",
+                 "elm");
+             it->is_even = it->even;
           }
-        if (it->end)
+
+        if (!it->is_separator)
           {
-             evas_object_size_hint_min_set(it->end, minw[1], minh[1]);
-             evas_object_size_hint_max_set(it->end, 99999, 99999);
-             edje_object_part_swallow
-                (VIEW(it), "elm.swallow.end", it->end);
+             if (count == 1)
+               position = ELM_LIST_ITEM_POSITION_SINGLE;
+             else if (l == sd->items) //1st item
+               position = ELM_LIST_ITEM_POSITION_FIRST;
+             else if (l == eina_list_last(sd->items))
+               position = ELM_LIST_ITEM_POSITION_LAST;
+             else
+               position = ELM_LIST_ITEM_POSITION_MIDDLE;
+
+             if (position != it->position)
+               {
+                  edje_object_signal_emit
+                    (VIEW(it), _item_position_signals[position], "elm");
+                  it->position = position;
+               }
+          }
+
+        if (it->parts_dirty)
+          {
+             if (it->icon)
+               {
+                  evas_object_size_hint_min_set
+                    (it->icon, sd->minw[0], sd->minh[0]);
+                  evas_object_size_hint_max_set(it->icon, 99999, 99999);
+                  edje_object_part_swallow
+                     (VIEW(it), "elm.swallow.icon", it->icon);
+               }
+             if (it->end)
+               {
+                  evas_object_size_hint_min_set
+                    (it->end, sd->minw[1], sd->minh[1]);
+                  evas_object_size_hint_max_set(it->end, 99999, 99999);
+                  edje_object_part_swallow
+                     (VIEW(it), "elm.swallow.end", it->end);
+               }
+             it->parts_dirty = EINA_FALSE;
           }
         if (!it->is_separator)
           i++;
@@ -1034,6 +1165,35 @@ _size_hints_changed_cb(void *data,
    elm_layout_sizing_eval(data);
 }
 
+static void
+_item_size_hints_changed_cb(void *data,
+                            Evas *e EINA_UNUSED,
+                            Evas_Object *obj,
+                            void *event_info EINA_UNUSED)
+{
+   Elm_List_Item_Data *it = data;
+   Evas_Coord mw, mh;
+   int p;
+
+   ELM_LIST_DATA_GET(WIDGET(it), sd);
+   if (sd->delete_me) return;
+
+   _item_part_min_unaccount(sd, it);
+   _item_part_min_account(sd, it);
+
+   // contents hold the list wide maxima, put them back when changed
+   p = (obj == it->icon) ? 0 : 1;
+   evas_object_size_hint_min_get(obj, &mw, &mh);
+   if ((mw != sd->minw[p]) || (mh != sd->minh[p]))
+     {
+        it->parts_dirty = EINA_TRUE;
+        sd->items_dirty = EINA_TRUE;
+     }
+
+   _items_fix(WIDGET(it));
+   elm_layout_sizing_eval(WIDGET(it));
+}
+
 /* FIXME: take off later. maybe this show region coords belong in the
  * interface (new api functions, set/get)? */
 static void
@@ -1107,6 +1267,8 @@ _elm_list_elm_widget_theme_apply(Eo *obj, Elm_List_Data *sd)
           (VIEW(it), elm_widget_scale_get(obj) * elm_config_scale_get());
         it->fixed = EINA_FALSE;
      }
+   sd->parity_mode = ELM_LIST_PARITY_UNKNOWN;
+   sd->items_dirty = EINA_TRUE;
 
    _items_fix(obj);
 
@@ -1319,11 +1481,14 @@ _elm_list_elm_widget_sub_object_del(Eo *obj, Elm_List_Data *sd, Evas_Object *sob
         ELM_LIST_ITEM_DATA_GET(eo_it, it);
         if ((sobj == it->icon) || (sobj == it->end))
           {
+             _item_part_min_unaccount(sd, it);
              if (it->icon == sobj) it->icon = NULL;
              if (it->end == sobj) it->end = NULL;
+             _item_part_min_account(sd, it);
+             sd->items_dirty = EINA_TRUE;
              evas_object_event_callback_del_full
-               (sobj, EVAS_CALLBACK_CHANGED_SIZE_HINTS, _size_hints_changed_cb,
-               obj);
+               (sobj, EVAS_CALLBACK_CHANGED_SIZE_HINTS,
+               _item_size_hints_changed_cb, it);
              if (!sd->walking)
                {
                   _items_fix(obj);
@@ -1954,6 +2119,12 @@ _elm_list_item_elm_widget_item_part_content_set(Eo *eo_item EINA_UNUSED, Elm_Lis
    evas_object_del(*icon_p);
    *icon_p = content;
 
+   ELM_LIST_DATA_GET(WIDGET(item), sd);
+   _item_part_min_unaccount(sd, item);
+   _item_part_min_account(sd, item);
+   item->parts_dirty = EINA_TRUE;
+   sd->items_dirty = EINA_TRUE;
+
    if (VIEW(item))
      {
         if ((!part) || !strcmp(part, "start"))
@@ -2054,6 +2225,7 @@ _elm_list_item_elm_widget_item_del_pre(Eo *eo_item EINA_UNUSED, Elm_List_Item_Da
      }
 
    sd->items = eina_list_remove_list(sd->items, item->node);
+   sd->items_dirty = EINA_TRUE;
 
    evas_object_ref(obj);
    _elm_list_walk(sd);
@@ -2319,19 +2491,23 @@ _item_new(Evas_Object *obj,
      {
         elm_widget_sub_object_add(obj, it->icon);
         evas_object_event_callback_add
-          (it->icon, EVAS_CALLBACK_CHANGED_SIZE_HINTS, _size_hints_changed_cb,
-          obj);
+          (it->icon, EVAS_CALLBACK_CHANGED_SIZE_HINTS,
+          _item_size_hints_changed_cb, it);
         elm_interface_atspi_accessible_type_set(it->icon, ELM_ATSPI_TYPE_DISABLED);
      }
    if (it->end)
      {
         elm_widget_sub_object_add(obj, it->end);
         evas_object_event_callback_add
-          (it->end, EVAS_CALLBACK_CHANGED_SIZE_HINTS, _size_hints_changed_cb,
-          obj);
+          (it->end, EVAS_CALLBACK_CHANGED_SIZE_HINTS,
+          _item_size_hints_changed_cb, it);
         elm_interface_atspi_accessible_type_set(it->end, ELM_ATSPI_TYPE_DISABLED);
      }
 
+   ELM_LIST_DATA_GET(obj, sd);
+   _item_part_min_account(sd, it);
+   sd->items_dirty = EINA_TRUE;
+
    if (_elm_config->atspi_mode)
      elm_interface_atspi_accessible_added(eo_it);
 
@@ -2464,11 +2640,11 @@ _elm_list_evas_object_smart_del(Eo *obj, Elm_List_Data *sd)
         if (it->icon)
           evas_object_event_callback_del
             (it->icon, EVAS_CALLBACK_CHANGED_SIZE_HINTS,
-            _size_hints_changed_cb);
+            _item_size_hints_changed_cb);
         if (it->end)
           evas_object_event_callback_del
             (it->end, EVAS_CALLBACK_CHANGED_SIZE_HINTS,
-            _size_hints_changed_cb);
+            _item_size_hints_changed_cb);
      }
 
    evas_object_event_callback_del
@@ -2608,6 +2784,8 @@ _elm_list_mode_set(Eo *obj, Elm_List_Data *sd, Elm_List_Mode mode)
         ELM_LIST_ITEM_DATA_GET(eo_it, it);
         it->fixed = EINA_FALSE;
      }
+   sd->parity_mode = ELM_LIST_PARITY_UNKNOWN;
+   sd->items_dirty = EINA_TRUE;
    _items_fix(obj);
 }
 
@@ -2628,6 +2806,7 @@ _elm_list_horizontal_set(Eo *obj, Elm_List_Data *sd, Eina_Bool horizontal)
      return;
 
    sd->h_mode = horizontal;
+   sd->parity_mode = ELM_LIST_PARITY_UNKNOWN;
    elm_box_horizontal_set(sd->box, horizontal);
 
    if (horizontal)
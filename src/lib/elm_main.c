@@ -6,6 +6,8 @@
 # include <dlfcn.h> /* dlopen,dlclose,etc */
 #endif
 
+#include <ctype.h>
+
 #ifdef HAVE_CRT_EXTERNS_H
 # include <crt_externs.h>
 #endif
@@ -21,6 +23,13 @@
 
 #define SEMI_BROKEN_QUICKLAUNCH 1
 
+#ifndef RTLD_DEFAULT
+# define RTLD_DEFAULT ((void *)0)
+#endif
+
+/* warm-up profile, under the user's elementary dir */
+#define ELM_QL_PROFILE "quicklaunch.profile"
+
 #ifdef __CYGWIN__
 # define LIBEXT ".dll"
 #else
@@ -76,6 +85,11 @@ static int _elm_ql_init_count = 0;
 static int _elm_policies[ELM_POLICY_LAST];
 static Ecore_Event_Handler *_elm_exit_handler = NULL;
 static Eina_Bool quicklaunch_on = 0;
+static Eina_Hash *_elm_ql_profile = NULL; /* entries seen, when recording */
+static Ecore_Evas *_elm_ql_warm_ee = NULL;
+static int _elm_ql_report_fd = -1;
+
+static void _elm_quicklaunch_warm_free(void);
 
 static Eina_Bool
 _elm_signal_exit(void *data  EINA_UNUSED,
@@ -346,6 +360,7 @@ elm_shutdown(void)
    while (_elm_win_deferred_free) ecore_main_loop_iterate();
 
    _elm_clouseau_unload();
+   _elm_quicklaunch_profile_save();
 // wrningz :(
 //   _prefix_shutdown();
    ELM_SAFE_FREE(app_name, eina_stringshare_del);
@@ -657,6 +672,9 @@ elm_quicklaunch_init(int    argc,
         elm_app_name_set(_elm_appname);
      }
 
+   if (getenv("ELM_QUICKLAUNCH_PROFILE_RECORD"))
+     _elm_ql_profile = eina_hash_string_superfast_new(NULL);
+
    pfx = eina_prefix_new(argv ? argv[0] : NULL, elm_quicklaunch_init,
                          "ELM", "elementary", "config/profile.cfg",
                          PACKAGE_LIB_DIR, /* don't have a bin dir currently */
@@ -745,6 +763,8 @@ elm_quicklaunch_shutdown(void)
 
    eina_log_timing(_elm_log_dom, EINA_LOG_STATE_STOP, EINA_LOG_STATE_SHUTDOWN);
 
+   _elm_quicklaunch_warm_free();
+
    if (pfx) eina_prefix_free(pfx);
    pfx = NULL;
    ELM_SAFE_FREE(_elm_data_dir, eina_stringshare_del);
@@ -811,6 +831,191 @@ elm_quicklaunch_seed(void)
         ecore_main_loop_iterate();
      }
 #endif
+   if (quicklaunch_on) _elm_quicklaunch_warm();
+}
+
+void
+_elm_quicklaunch_profile_add(const char *kind,
+                             const char *name)
+{
+   char buf[PATH_MAX];
+
+   if ((!_elm_ql_profile) || (!name)) return;
+
+   snprintf(buf, sizeof(buf), "%s %s", kind, name);
+   if (!eina_hash_find(_elm_ql_profile, buf))
+     eina_hash_add(_elm_ql_profile, buf, _elm_ql_profile);
+}
+
+static Eina_Bool
+_elm_ql_profile_line_write(const Eina_Hash *hash EINA_UNUSED,
+                           const void *key,
+                           void *data EINA_UNUSED,
+                           void *fdata)
+{
+   fprintf(fdata, "%s\n", (const char *)key);
+   return EINA_TRUE;
+}
+
+/* Merges what this run used into the profile written by earlier ones,
+ * when ELM_QUICKLAUNCH_PROFILE_RECORD is set. */
+void
+_elm_quicklaunch_profile_save(void)
+{
+   char path[PATH_MAX], tmp[PATH_MAX], line[PATH_MAX];
+   FILE *f;
+
+   if (!_elm_ql_profile) return;
+
+   _elm_config_user_dir_snprintf(path, sizeof(path), ELM_QL_PROFILE);
+   f = fopen(path, "r");
+   if (f)
+     {
+        while (fgets(line, sizeof(line), f))
+          {
+             line[strcspn(line, "\n")] = 0;
+             if ((*line) && (!eina_hash_find(_elm_ql_profile, line)))
+               eina_hash_add(_elm_ql_profile, line, _elm_ql_profile);
+          }
+        fclose(f);
+     }
+
+   _elm_config_user_dir_snprintf(tmp, sizeof(tmp), "%s", "");
+   ecore_file_mkpath(tmp);
+   snprintf(tmp, sizeof(tmp), "%s.tmp", path);
+   f = fopen(tmp, "w");
+   if (f)
+     {
+        eina_hash_foreach(_elm_ql_profile, _elm_ql_profile_line_write, f);
+        if ((fclose(f) != 0) || (rename(tmp, path) != 0))
+          {
+             ERR("could not write quicklaunch profile '%s'", path);
+             unlink(tmp);
+          }
+     }
+   else
+     ERR("could not write quicklaunch profile '%s'", tmp);
+
+   ELM_SAFE_FREE(_elm_ql_profile, eina_hash_free);
+}
+
+static void
+_elm_ql_warm_class(const char *name)
+{
+#ifndef _WIN32
+   const Eo_Class *(*class_get)(void);
+   char sym[PATH_MAX];
+   size_t i;
+
+   /* Elm_Button (or Elm.Button) is built by elm_button_class_get() */
+   for (i = 0; (name[i]) && (i < sizeof(sym) - sizeof("_class_get")); i++)
+     sym[i] = (name[i] == '.') ? '_' : tolower(name[i]);
+   strcpy(sym + i, "_class_get");
+
+   class_get = dlsym(RTLD_DEFAULT, sym);
+   if (class_get) class_get();
+#else
+   (void)name;
+#endif
+}
+
+static void
+_elm_ql_warm_group(Evas *e,
+                   const char *group)
+{
+   const char *file = elm_theme_group_path_find(NULL, group);
+   Evas_Object *o;
+
+   if (!file) return;
+
+   o = edje_object_add(e);
+   if (!edje_object_file_set(o, file, group))
+     {
+        evas_object_del(o);
+        return;
+     }
+   evas_object_resize(o, 128, 128);
+   evas_object_show(o);
+}
+
+/* Preloads what the profile lists: Eo classes get constructed and
+ * theme groups loaded (and kept) on a buffer canvas, which is rendered
+ * once so that the fonts and images they use get loaded too. Nothing
+ * here touches the display, so this can be shared by all the processes
+ * forked afterwards. */
+void
+_elm_quicklaunch_warm(void)
+{
+   char path[PATH_MAX], line[PATH_MAX];
+   Evas *e;
+   FILE *f;
+
+   if (_elm_ql_warm_ee) return;
+
+   _elm_config_user_dir_snprintf(path, sizeof(path), ELM_QL_PROFILE);
+   f = fopen(path, "r");
+   if (!f) return;
+
+   ecore_evas_init();
+   _elm_ql_warm_ee = ecore_evas_buffer_new(256, 256);
+   if (!_elm_ql_warm_ee)
+     {
+        fclose(f);
+        ecore_evas_shutdown();
+        return;
+     }
+   ecore_evas_manual_render_set(_elm_ql_warm_ee, EINA_TRUE);
+   e = ecore_evas_get(_elm_ql_warm_ee);
+
+   while (fgets(line, sizeof(line), f))
+     {
+        char *name;
+
+        line[strcspn(line, "\n")] = 0;
+        name = strchr(line, ' ');
+        if (!name) continue;
+        *name++ = 0;
+
+        if (!strcmp(line, "class")) _elm_ql_warm_class(name);
+        else if (!strcmp(line, "group")) _elm_ql_warm_group(e, name);
+     }
+   fclose(f);
+
+   ecore_evas_show(_elm_ql_warm_ee);
+   ecore_evas_manual_render(_elm_ql_warm_ee);
+}
+
+/* drops the warm-up canvas: the caches it filled outlive it, but its
+ * objects are no use to the app nor to a quicklaunch server going away */
+static void
+_elm_quicklaunch_warm_free(void)
+{
+   if (!_elm_ql_warm_ee) return;
+
+   ELM_SAFE_FREE(_elm_ql_warm_ee, ecore_evas_free);
+   ecore_evas_shutdown();
+}
+
+Eina_Bool
+_elm_quicklaunch_first_frame_pending(void)
+{
+   return _elm_ql_report_fd >= 0;
+}
+
+/* tells elementary_run how long it took to get a frame out */
+void
+_elm_quicklaunch_first_frame(double t)
+{
+   char buf[64];
+   int len;
+
+   if (_elm_ql_report_fd < 0) return;
+
+   len = snprintf(buf, sizeof(buf), "%f\n", t);
+   if (write(_elm_ql_report_fd, buf, len) != len)
+     WRN("could not report first frame time");
+   close(_elm_ql_report_fd);
+   _elm_ql_report_fd = -1;
 }
 
 #ifdef HAVE_FORK
@@ -916,6 +1121,7 @@ elm_quicklaunch_fork(int    argc,
                      void  *postfork_data)
 {
 #ifdef HAVE_FORK
+   const char *report;
    pid_t child;
    int ret;
 
@@ -952,6 +1158,14 @@ elm_quicklaunch_fork(int    argc,
 
    ecore_fork_reset();
    eina_main_loop_define();
+   _elm_quicklaunch_warm_free();
+
+   report = getenv("ELM_QUICKLAUNCH_REPORT_FD");
+   if (report)
+     {
+        _elm_ql_report_fd = atoi(report);
+        unsetenv("ELM_QUICKLAUNCH_REPORT_FD");
+     }
 
    if (quicklaunch_on)
      {
@@ -1008,6 +1222,7 @@ elm_quicklaunch_fork(int    argc,
    if (_elm_config->atspi_mode != ELM_ATSPI_MODE_OFF)
      _elm_atspi_bridge_init();
    ret = qr_main(argc, argv);
+   _elm_quicklaunch_profile_save();
    exit(ret);
    return EINA_TRUE;
 #else
@@ -44,12 +44,39 @@ static void _elm_prefs_values_get_default(Elm_Prefs_Page_Node *,
                                           Eina_Bool);
 static Eina_Bool _prefs_item_widget_value_from_self(Elm_Prefs_Item_Node *,
                                                     Eina_Bool);
+static Eina_Bool _elm_prefs_page_build(Elm_Prefs_Page_Node *);
+static void _elm_prefs_subpages_build(Elm_Prefs_Page_Node *);
+
+static void
+_elm_prefs_build_job(void *data)
+{
+   ELM_PREFS_DATA_GET(data, sd);
+
+   sd->build_job = NULL;
+   if (sd->root && sd->root->built) _elm_prefs_subpages_build(sd->root);
+}
+
+/* subpages get their items once we're about to be seen */
+static void
+_elm_prefs_show_cb(void *data EINA_UNUSED,
+                   Evas *e EINA_UNUSED,
+                   Evas_Object *obj,
+                   void *event_info EINA_UNUSED)
+{
+   ELM_PREFS_DATA_GET(obj, sd);
+
+   if (!sd->root || sd->build_job) return;
+   sd->build_job = ecore_job_add(_elm_prefs_build_job, obj);
+}
 
 EOLIAN static void
 _elm_prefs_evas_object_smart_add(Eo *obj, Elm_Prefs_Data *_pd EINA_UNUSED)
 {
    evas_obj_smart_add(eo_super(obj, MY_CLASS));
    elm_widget_sub_object_parent_add(obj);
+
+   evas_object_event_callback_add
+     (obj, EVAS_CALLBACK_SHOW, _elm_prefs_show_cb, NULL);
 }
 
 static void _item_free(Elm_Prefs_Item_Node *it);
@@ -111,6 +138,12 @@ _item_free(Elm_Prefs_Item_Node *it)
         break;
      }
 
+   if (it->pending)
+     {
+        eina_value_flush(it->pending);
+        free(it->pending);
+     }
+
    eina_stringshare_del(it->name);
    eina_stringshare_del(it->label);
    eina_stringshare_del(it->icon);
@@ -150,6 +183,7 @@ end:
 static void
 _root_node_free(Elm_Prefs_Data *sd)
 {
+   ELM_SAFE_FREE(sd->items, eina_hash_free);
    _page_free(sd->root);
 }
 
@@ -304,46 +338,13 @@ _elm_prefs_item_changed_report(Eo *obj,
      (wd->obj, ELM_PREFS_EVENT_ITEM_CHANGED, buf);
 }
 
-static Elm_Prefs_Item_Node *
-_elm_prefs_page_item_by_name(Elm_Prefs_Page_Node *p,
-                             char **path)
-{
-   Elm_Prefs_Item_Node *it;
-   Eina_List *l;
-   char *token;
-
-   token = strsep(path, ":");
-
-   EINA_LIST_FOREACH(p->items, l, it)
-     {
-        if (strcmp(it->name, token)) continue;
-
-        if (!*path)
-          return it;
-        else if (it->type == ELM_PREFS_TYPE_PAGE)
-          return _elm_prefs_page_item_by_name(it->subpage, path);
-     }
-
-   return NULL;
-}
-
 static Elm_Prefs_Item_Node *
 _elm_prefs_item_node_by_name(Elm_Prefs_Data *sd,
                              const char *name)
 {
-   char buf[PATH_MAX];
-   char *token;
-   char *aux = buf;
-
-   strncpy(buf, name, PATH_MAX - 1);
-   buf[PATH_MAX - 1] = '\0';
-
-   token = strsep(&aux, ":");
-
-   if (strcmp(sd->root->name, token))
-     return NULL; // first token should be the current page name
+   if (!sd->items) return NULL;
 
-   return _elm_prefs_page_item_by_name(sd->root, &aux);
+   return eina_hash_find(sd->items, name);
 }
 
 static Eina_List *
@@ -351,12 +352,11 @@ _elm_prefs_item_list_node_by_name(Elm_Prefs_Data *sd,
                                   const char *name)
 {
    Elm_Prefs_Item_Node *it;
-   Eina_List *l;
 
-   EINA_LIST_FOREACH(sd->root->items, l, it)
-     if (!strcmp(it->name, name)) return l;
+   it = _elm_prefs_item_node_by_name(sd, name);
+   if (!it || !_elm_prefs_page_build(it->page)) return NULL;
 
-   return NULL;
+   return eina_list_data_find_list(it->page->items, it);
 }
 
 static void
@@ -376,6 +376,14 @@ _prefs_data_item_changed_cb(void *cb_data,
    it = _elm_prefs_item_node_by_name(sd, evt->key);
    if (!it) return;
 
+   /* the page will fetch it from the data when it gets built */
+   if (!it->page->built)
+     {
+        _elm_prefs_item_changed_report(obj, it);
+        _elm_prefs_mark_as_dirty(obj);
+        return;
+     }
+
    if (elm_prefs_data_value_get(prefs_data, evt->key, NULL, &value))
      {
         if (!_prefs_item_widget_value_from_data(sd, it, &value)) goto end;
@@ -452,6 +460,7 @@ _elm_prefs_evas_object_smart_del(Eo *obj, Elm_Prefs_Data *sd)
    sd->delete_me = EINA_TRUE;
 
    if (sd->saving_poller) ecore_poller_del(sd->saving_poller);
+   ELM_SAFE_FREE(sd->build_job, ecore_job_del);
 
    _elm_prefs_data_cbs_del(obj);
 
@@ -550,6 +559,7 @@ _item_changed_cb(Evas_Object *it_obj)
    ELM_PREFS_DATA_GET(it->prefs, sd);
    ELM_WIDGET_DATA_GET_OR_RETURN(it->prefs, wd);
 
+   if (sd->page_building) return;
    if (sd->values_fetching) goto end;
 
    /* we use the changed cb on ACTION/RESET/SAVE items specially */
@@ -928,9 +938,9 @@ wid_found:
 
 static Elm_Prefs_Page_Node *
 _elm_prefs_page_load(Evas_Object *obj,
+                     Eet_File    *eet_file,
                      const char  *pname)
 {
-   Eet_File *eet_file;
    Elm_Prefs_Page_Node *ret = NULL;
 
    ELM_PREFS_CHECK(obj) NULL;
@@ -938,35 +948,68 @@ _elm_prefs_page_load(Evas_Object *obj,
 
    ELM_PREFS_DATA_GET(obj, sd);
 
-   eet_file = eet_open(sd->file, EET_FILE_MODE_READ);
-
-   if (eet_file)
-     {
-        ret = eet_data_read(eet_file, _page_edd, pname);
-        eet_close(eet_file);
+   ret = eet_data_read(eet_file, _page_edd, pname);
 
-        if (!ret)
-          ERR("problem while reading from file %s, key %s", sd->file, pname);
-        else
-          ret->prefs = obj;
-     }
+   if (!ret)
+     ERR("problem while reading from file %s, key %s", sd->file, pname);
    else
-     ERR("failed to load from requested epb file (%s)", sd->file);
+     ret->prefs = obj;
 
    return ret;
 }
 
-static Eina_Bool
-_elm_prefs_page_populate(Elm_Prefs_Page_Node *page,
-                         Evas_Object         *parent)
+/* Reads all subpages under @a page and indexes their items by full
+ * path. No widgets are created here, see _elm_prefs_page_build(). */
+static void
+_elm_prefs_page_tree_load(Evas_Object         *obj,
+                          Eet_File            *eet_file,
+                          Elm_Prefs_Page_Node *page)
 {
+   char buf[PATH_MAX];
    Elm_Prefs_Page_Node *subpage;
    Elm_Prefs_Item_Node *it;
    Eina_List           *l;
 
-   EINA_SAFETY_ON_NULL_RETURN_VAL(page, EINA_FALSE);
+   ELM_PREFS_DATA_GET(obj, sd);
 
-   if (!_elm_prefs_page_widget_new(parent, page)) goto err;
+   EINA_LIST_FOREACH(page->items, l, it)
+     {
+        it->prefs = obj;
+        it->page  = page;
+
+        snprintf(buf, sizeof(buf), "%s:%s", page->name, it->name);
+        if (!eina_hash_find(sd->items, buf))
+          eina_hash_add(sd->items, buf, it);
+
+        if (it->type != ELM_PREFS_TYPE_PAGE) continue;
+
+        subpage = _elm_prefs_page_load(obj, eet_file, it->spec.p.source);
+        if (!subpage)
+          {
+             ERR("subpage %s could not be created inside %s, skipping it",
+                 it->name, page->name);
+             continue;
+          }
+
+        eina_stringshare_del(subpage->name);
+        subpage->name = eina_stringshare_printf("%s:%s",
+                                                page->name, it->name);
+        subpage->owner = it;
+        it->subpage = subpage;
+
+        _elm_prefs_page_tree_load(obj, eet_file, subpage);
+     }
+}
+
+/* Creates the widgets of the items of @a page, whose own widget has
+ * to exist already. Subpages only get their (empty) page widget,
+ * their items come later, from _elm_prefs_page_build(). */
+static Eina_Bool
+_elm_prefs_page_items_add(Elm_Prefs_Page_Node *page)
+{
+   Elm_Prefs_Page_Node *subpage;
+   Elm_Prefs_Item_Node *it;
+   Eina_List           *l;
 
    EINA_LIST_FOREACH(page->items, l, it)
      {
@@ -979,30 +1022,15 @@ _elm_prefs_page_populate(Elm_Prefs_Page_Node *page,
           }
         else if (it->type == ELM_PREFS_TYPE_PAGE)
           {
-             subpage = _elm_prefs_page_load(page->prefs, it->spec.p.source);
-             if (!subpage)
-               {
-                  ERR("subpage %s could not be created inside %s, skipping it",
-                      it->name, page->name);
-                  continue;
-               }
-
-             eina_stringshare_del(subpage->name);
-             subpage->name = eina_stringshare_printf("%s:%s",
-                                                     page->name, it->name);
+             subpage = it->subpage;
+             if (!subpage) continue;
 
-             if (!_elm_prefs_page_populate(subpage, page->w_obj))
-               {
-                  _page_free(subpage);
-                  goto err;
-               }
+             if (!_elm_prefs_page_widget_new(page->w_obj, subpage))
+               goto err;
 
-             it->prefs     = page->prefs;
-             it->page      = page;
              it->w_obj     = subpage->w_obj;
              it->w_impl    = NULL;
              it->available = EINA_TRUE;
-             it->subpage   = subpage;
           }
         else if (!_elm_prefs_item_widget_new(page->prefs, page, it)) goto err;
 
@@ -1016,15 +1044,37 @@ _elm_prefs_page_populate(Elm_Prefs_Page_Node *page,
           }
      }
 
+   page->built = EINA_TRUE;
+
    return EINA_TRUE;
 
 err:
    EINA_LIST_FOREACH(page->items, l, it)
      {
+        if (it->subpage)
+          {
+             it->subpage->w_obj = NULL;
+             it->subpage->w_impl = NULL;
+          }
         ELM_SAFE_FREE(it->w_obj, evas_object_del);
         it->w_impl = NULL;
      }
 
+   return EINA_FALSE;
+}
+
+static Eina_Bool
+_elm_prefs_page_populate(Elm_Prefs_Page_Node *page,
+                         Evas_Object         *parent)
+{
+   EINA_SAFETY_ON_NULL_RETURN_VAL(page, EINA_FALSE);
+
+   if (!_elm_prefs_page_widget_new(parent, page)) goto err;
+   if (!_elm_prefs_page_items_add(page)) goto err;
+
+   return EINA_TRUE;
+
+err:
    ELM_SAFE_FREE(page->w_obj, evas_object_del);
    page->w_impl = NULL;
 
@@ -1041,7 +1091,15 @@ _elm_prefs_values_get_default(Elm_Prefs_Page_Node *page,
    EINA_LIST_FOREACH(page->items, l, it)
      {
         if (it->type == ELM_PREFS_TYPE_PAGE)
-          _elm_prefs_values_get_default(it->subpage, mark_changed);
+          {
+             if (!it->subpage) continue;
+
+             /* a reset has to reach the data of pages not built yet,
+              * otherwise they get their defaults once built */
+             if (mark_changed) _elm_prefs_page_build(it->subpage);
+             if (it->subpage->built)
+               _elm_prefs_values_get_default(it->subpage, mark_changed);
+          }
         else
           _prefs_item_widget_value_from_self(it, mark_changed);
      }
@@ -1066,6 +1124,8 @@ _elm_prefs_values_get_user(Elm_Prefs_Data *sd,
           {
              Elm_Prefs_Page_Node *subp = it->subpage;
 
+             if (!subp) continue;
+
              if (!elm_prefs_data_value_get
                  (sd->prefs_data, subp->name, NULL, &value))
                {
@@ -1082,7 +1142,8 @@ _elm_prefs_values_get_user(Elm_Prefs_Data *sd,
                     }
                }
 
-             _elm_prefs_values_get_user(sd, subp);
+             /* pages not built yet fetch their values when they are */
+             if (subp->built) _elm_prefs_values_get_user(sd, subp);
 
              eina_value_flush(&value);
              continue;
@@ -1124,10 +1185,120 @@ _elm_prefs_values_get_user(Elm_Prefs_Data *sd,
      }
 }
 
+static Eina_Bool
+_elm_prefs_item_value_push(Elm_Prefs_Item_Node *it,
+                           const Eina_Value *value)
+{
+   const Eina_Value_Type *t, *def_t;
+   Eina_Value it_val;
+
+   t = eina_value_type_get(value);
+   if (!t) return EINA_FALSE;
+
+   if (!it->available)
+     {
+        ERR("widget of item %s has been deleted, we can't set values on it",
+            it->name);
+        return EINA_FALSE;
+     }
+
+   if (!it->w_impl->value_get(it->w_obj, &it_val))
+     {
+        ERR("failed to fetch value from widget of item %s", it->name);
+        return EINA_FALSE;
+     }
+
+   def_t = eina_value_type_get(&it_val);
+   if ((t != def_t) && (!eina_value_convert(value, &it_val)))
+     {
+        eina_value_flush(&it_val);
+        ERR("failed to convert value to proper type");
+        return EINA_FALSE;
+     }
+   else if (!eina_value_copy(value, &it_val) ||
+            (!it->w_impl->value_set(it->w_obj, &it_val)))
+     {
+        eina_value_flush(&it_val);
+        ERR("failed to set value on widget of item %s", it->name);
+        return EINA_FALSE;
+     }
+
+   eina_value_flush(&it_val);
+   return EINA_TRUE;
+}
+
+/* Subpages get their item widgets the first time they are needed: on
+ * the first show of the prefs widget or on the first access to one of
+ * their items. Their values are then, in order, the defaults, the
+ * user data and whatever got pushed to them in the meantime. */
+static Eina_Bool
+_elm_prefs_page_build(Elm_Prefs_Page_Node *page)
+{
+   Elm_Prefs_Item_Node *it;
+   Eina_Bool fetching;
+   Eina_List *l;
+
+   if (page->built) return EINA_TRUE;
+   if (!page->owner || !_elm_prefs_page_build(page->owner->page))
+     return EINA_FALSE;
+   if (!page->w_obj) return EINA_FALSE;
+
+   ELM_PREFS_DATA_GET(page->prefs, sd);
+
+   if (!_elm_prefs_page_items_add(page))
+     {
+        ERR("failed to create the items of page %s", page->name);
+        return EINA_FALSE;
+     }
+
+   /* the widgets may report changes on their own meanwhile, but the
+    * data is the source here */
+   sd->page_building = EINA_TRUE;
+   _elm_prefs_values_get_default(page, EINA_FALSE);
+   if (sd->prefs_data)
+     {
+        fetching = sd->values_fetching;
+        sd->values_fetching = EINA_TRUE;
+        _elm_prefs_values_get_user(sd, page);
+        sd->values_fetching = fetching;
+     }
+   sd->page_building = EINA_FALSE;
+
+   EINA_LIST_FOREACH(page->items, l, it)
+     {
+        if (!it->pending) continue;
+
+        _elm_prefs_item_value_push(it, it->pending);
+        eina_value_flush(it->pending);
+        ELM_SAFE_FREE(it->pending, free);
+     }
+
+   return EINA_TRUE;
+}
+
+/* builds the subpages of @a page visible to the user, recursively */
+static void
+_elm_prefs_subpages_build(Elm_Prefs_Page_Node *page)
+{
+   Elm_Prefs_Item_Node *it;
+   Eina_List *l;
+
+   EINA_LIST_FOREACH(page->items, l, it)
+     {
+        if ((it->type != ELM_PREFS_TYPE_PAGE) || (!it->subpage) ||
+            (!it->visible))
+          continue;
+
+        if (_elm_prefs_page_build(it->subpage))
+          _elm_prefs_subpages_build(it->subpage);
+     }
+}
+
 EOLIAN static Eina_Bool
 _elm_prefs_efl_file_file_set(Eo *obj, Elm_Prefs_Data *sd, const char *file, const char *page)
 {
    const char *prefix;
+   Eet_File *eet_file;
 
    if (!_elm_prefs_init_count)
      {
@@ -1159,7 +1330,22 @@ _elm_prefs_efl_file_file_set(Eo *obj, Elm_Prefs_Data *sd, const char *file, cons
 
    sd->page = eina_stringshare_add(page ? page : "main");
 
-   sd->root = _elm_prefs_page_load(obj, sd->page);
+   eet_file = eet_open(sd->file, EET_FILE_MODE_READ);
+   if (!eet_file)
+     {
+        ERR("failed to load from requested epb file (%s)", sd->file);
+        return EINA_FALSE;
+     }
+
+   sd->root = _elm_prefs_page_load(obj, eet_file, sd->page);
+   if (sd->root)
+     {
+        if (sd->items) eina_hash_free(sd->items);
+        sd->items = eina_hash_string_superfast_new(NULL);
+        _elm_prefs_page_tree_load(obj, eet_file, sd->root);
+     }
+   eet_close(eet_file);
+
    if (!sd->root) return EINA_FALSE;
 
    if (!_elm_prefs_page_populate(sd->root, obj))
@@ -1174,6 +1360,9 @@ _elm_prefs_efl_file_file_set(Eo *obj, Elm_Prefs_Data *sd, const char *file, cons
 
    _elm_prefs_values_get_default(sd->root, EINA_FALSE);
 
+   if (evas_object_visible_get(obj) && !sd->build_job)
+     sd->build_job = ecore_job_add(_elm_prefs_build_job, obj);
+
    eo_event_callback_call
      (obj, ELM_PREFS_EVENT_PAGE_LOADED, (char *)sd->root->name);
 
@@ -1278,8 +1467,8 @@ _elm_prefs_reset(Eo *obj EINA_UNUSED, Elm_Prefs_Data *sd, Elm_Prefs_Reset_Mode m
 }
 
 static Elm_Prefs_Item_Node *
-_elm_prefs_item_api_entry_common(const Evas_Object *obj,
-                                 const char *it_name)
+_elm_prefs_item_api_lookup(const Evas_Object *obj,
+                           const char *it_name)
 {
    Elm_Prefs_Item_Node *ret;
 
@@ -1298,14 +1487,60 @@ _elm_prefs_item_api_entry_common(const Evas_Object *obj,
    return ret;
 }
 
+/* stores a value set on an item whose page isn't built yet in the user
+ * data, converted to the item's type */
+static Eina_Bool
+_elm_prefs_item_value_write_through(Elm_Prefs_Data *sd,
+                                    Elm_Prefs_Item_Node *it,
+                                    const Eina_Value *value)
+{
+   char buf[PATH_MAX];
+   Eina_Value v;
+   Eina_Bool v_set = EINA_FALSE;
+
+   if (!sd->prefs_data || !it->persistent) return EINA_FALSE;
+   if (!eina_value_copy(value, &v)) return EINA_FALSE;
+
+   snprintf(buf, sizeof(buf), "%s:%s", it->page->name, it->name);
+
+   if (_prefs_data_types_match(eina_value_type_get(&v), it->type) ||
+       _prefs_data_type_fix(it, &v))
+     {
+        sd->changing_from_ui = EINA_TRUE;
+        v_set = elm_prefs_data_value_set(sd->prefs_data, buf, it->type, &v);
+        sd->changing_from_ui = EINA_FALSE;
+     }
+
+   eina_value_flush(&v);
+   return v_set;
+}
+
+/* as above, building the item's page if it wasn't yet */
+static Elm_Prefs_Item_Node *
+_elm_prefs_item_api_entry_common(const Evas_Object *obj,
+                                 const char *it_name)
+{
+   Elm_Prefs_Item_Node *ret;
+
+   ret = _elm_prefs_item_api_lookup(obj, it_name);
+   if (!ret) return NULL;
+
+   if (!_elm_prefs_page_build(ret->page))
+     {
+        ERR("page %s of item %s could not be built",
+            ret->page->name, it_name);
+        return NULL;
+     }
+
+   return ret;
+}
+
 EOLIAN static Eina_Bool
-_elm_prefs_item_value_set(Eo *obj, Elm_Prefs_Data *_pd EINA_UNUSED, const char *name, const Eina_Value *value)
+_elm_prefs_item_value_set(Eo *obj, Elm_Prefs_Data *sd, const char *name, const Eina_Value *value)
 {
-   const Eina_Value_Type *t, *def_t;
    Elm_Prefs_Item_Node *it;
-   Eina_Value it_val;
 
-   it = _elm_prefs_item_api_entry_common(obj, name);
+   it = _elm_prefs_item_api_lookup(obj, name);
    if (!it) return EINA_FALSE;
 
    if (!_elm_prefs_item_has_value(it))
@@ -1316,42 +1551,39 @@ _elm_prefs_item_value_set(Eo *obj, Elm_Prefs_Data *_pd EINA_UNUSED, const char *
      }
 
    EINA_SAFETY_ON_NULL_RETURN_VAL(value, EINA_FALSE);
-   t = eina_value_type_get(value);
-   if (!t) return EINA_FALSE;
+   if (!eina_value_type_get(value)) return EINA_FALSE;
 
-   if (!it->available)
+   if (!it->page->built)
      {
-        ERR("widget of item %s has been deleted, we can't set values on it",
-            it->name);
-        return EINA_FALSE;
-     }
+        /* the data gets it right away, the page fetches it from there
+         * when built */
+        if (_elm_prefs_item_value_write_through(sd, it, value))
+          {
+             if (it->pending)
+               {
+                  eina_value_flush(it->pending);
+                  ELM_SAFE_FREE(it->pending, free);
+               }
+             _elm_prefs_item_changed_report(obj, it);
+             _elm_prefs_mark_as_dirty(obj);
 
-   if (!it->w_impl->value_get(it->w_obj, &it_val))
-     {
-        ERR("failed to fetch value from widget of item %s", it->name);
-        goto err;
-     }
+             return EINA_TRUE;
+          }
 
-   def_t = eina_value_type_get(&it_val);
-   if ((t != def_t) && (!eina_value_convert(value, &it_val)))
-     {
-        eina_value_flush(&it_val);
-        ERR("failed to convert value to proper type");
-        goto err;
-     }
-   else if (!eina_value_copy(value, &it_val) ||
-            (!it->w_impl->value_set(it->w_obj, &it_val)))
-     {
-        eina_value_flush(&it_val);
-        ERR("failed to set value on widget of item %s", it->name);
-        goto err;
-     }
+        /* pushed to the widget once its page gets built */
+        if (!it->pending) it->pending = calloc(1, sizeof(Eina_Value));
+        else eina_value_flush(it->pending);
 
-   eina_value_flush(&it_val);
-   return EINA_TRUE;
+        if (!it->pending || !eina_value_copy(value, it->pending))
+          {
+             ELM_SAFE_FREE(it->pending, free);
+             return EINA_FALSE;
+          }
 
-err:
-   return EINA_FALSE;
+        return EINA_TRUE;
+     }
+
+   return _elm_prefs_item_value_push(it, value);
 }
 
 EOLIAN static Eina_Bool
@@ -1398,7 +1630,7 @@ _elm_prefs_item_object_get(Eo *obj, Elm_Prefs_Data *_pd EINA_UNUSED, const char
 }
 
 EOLIAN static void
-_elm_prefs_item_visible_set(Eo *obj EINA_UNUSED, Elm_Prefs_Data *sd, const char *name, Eina_Bool visible)
+_elm_prefs_item_visible_set(Eo *obj, Elm_Prefs_Data *sd, const char *name, Eina_Bool visible)
 {
    Elm_Prefs_Item_Node *it;
    Eina_List *l;
@@ -1476,6 +1708,13 @@ _elm_prefs_item_visible_set(Eo *obj EINA_UNUSED, Elm_Prefs_Data *sd, const char
         if (lbl) evas_object_show(lbl);
         if (icon) evas_object_show(icon);
         evas_object_show(it->w_obj);
+
+        if ((it->type == ELM_PREFS_TYPE_PAGE) && (it->subpage) &&
+            (evas_object_visible_get(obj)))
+          {
+             if (_elm_prefs_page_build(it->subpage))
+               _elm_prefs_subpages_build(it->subpage);
+          }
      }
 }
 
@@ -5,6 +5,9 @@
 #include <Elementary.h>
 #include "elm_priv.h"
 
+#include <fcntl.h>
+#include <errno.h>
+
 #define ELM_PREFS_DATA_CHECK(prefs_data)                        \
   do                                                            \
     {                                                           \
@@ -98,6 +101,16 @@ typedef struct _Eet_Data_Value
    Eina_List   *values;
 } Eet_Data_Value;
 
+/* a journal record: one value set (item) or deleted (deleted) in a
+ * group, or neither when only the version changed */
+typedef struct _Eet_Journal_Entry
+{
+   const char    *key;
+   const char    *deleted;
+   unsigned int   version;
+   Eet_Data_Item *item;
+} Eet_Journal_Entry;
+
 /* Run time data */
 typedef struct _Elm_Prefs_Data_Item
 {
@@ -117,6 +130,39 @@ typedef struct _Elm_Prefs_Data_Event
    Eina_Bool                 deleted : 1;
 } Elm_Prefs_Data_Event;
 
+/* group values, detached from the live hashes so they can be written
+ * out by a worker thread */
+typedef struct _Elm_Prefs_Data_Snapshot
+{
+   const char     *key;
+   Eet_Data_Value  edv;
+} Elm_Prefs_Data_Snapshot;
+
+/* a write handed to a worker thread: a full snapshot to replace the
+ * file with, or records to append to its journal */
+typedef struct _Elm_Prefs_Data_Job
+{
+   Elm_Prefs_Data *prefs_data; /* NULL once the handle is gone */
+
+   const char     *file;
+   Eina_List      *snapshot;
+   Eina_Binbuf    *journal;
+
+   Eina_Lock       lock;
+   Eina_Condition  cond;
+
+   Eina_Bool       done : 1;
+   Eina_Bool       ok : 1;
+} Elm_Prefs_Data_Job;
+
+/* time changes are gathered for before they are written, counted from
+ * the last change, and at most from the first one */
+#define ELM_PREFS_DATA_SAVE_DELAY 0.3
+#define ELM_PREFS_DATA_SAVE_DELAY_MAX 2.0
+
+/* journal size past which it is folded back into the file */
+#define ELM_PREFS_DATA_JOURNAL_MAX (64 * 1024)
+
 struct _Elm_Prefs_Data
 {
    EINA_MAGIC;
@@ -132,6 +178,14 @@ struct _Elm_Prefs_Data
 
    Ecore_Poller *saving_poller;
 
+   Elm_Prefs_Data_Save_Mode save_mode;
+   Ecore_Timer  *save_timer;
+   double        save_first;
+
+   Elm_Prefs_Data_Job *job;
+   Eina_Hash    *changed; /* paths changed since the last journal write */
+   unsigned int  journal_size;
+
    int           walking;
 
    Eina_Inlist  *event_cbs;
@@ -140,6 +194,8 @@ struct _Elm_Prefs_Data
 
    Eina_Bool     autosave : 1;
    Eina_Bool     dirty : 1;
+   Eina_Bool     resave : 1;
+   Eina_Bool     journal_ok : 1; /* the file plus the journal hold the data */
 };
 
 static int _elm_prefs_data_init_count = 0;
@@ -152,6 +208,7 @@ static Eet_Data_Descriptor *_date_value_edd;
 static Eet_Data_Descriptor *_values_edd;
 static Eet_Data_Descriptor *_item_edd;
 static Eet_Data_Descriptor *_item_unified_edd;
+static Eet_Data_Descriptor *_journal_edd;
 
 static const char *
 _union_type_get(const void *data,
@@ -210,6 +267,99 @@ _data_values_hash_free_cb(void *data)
    free(it);
 }
 
+static void _eet_data_load(Elm_Prefs_Data *prefs_data,
+                           Eet_File *eet_file,
+                           const char *key);
+
+/* turns a serialized item into a run time one, NULL if it can't be
+ * used. Page items load their group from @a eet_file, if given. */
+static Elm_Prefs_Data_Item *
+_eet_data_item_new(Elm_Prefs_Data *prefs_data,
+                   Eet_File *eet_file,
+                   Eet_Data_Item *it)
+{
+   Elm_Prefs_Data_Item *item = malloc(sizeof(*item));
+   Eina_Bool set_err     = EINA_FALSE;
+   Eina_Bool setup_err   = EINA_FALSE;
+
+   if (!item) return NULL;
+   item->type = it->type;
+
+   switch (it->type)
+     {
+      case ELM_PREFS_TYPE_BOOL:
+        if (!eina_value_setup(&(item->value), EINA_VALUE_TYPE_UCHAR))
+          setup_err = EINA_TRUE;
+        else if (!eina_value_set(&(item->value), it->value.b.b))
+          set_err = EINA_TRUE;
+        break;
+
+      case ELM_PREFS_TYPE_INT:
+        if (!eina_value_setup(&(item->value), EINA_VALUE_TYPE_INT))
+          setup_err = EINA_TRUE;
+        else if (!eina_value_set(&(item->value), it->value.i.i))
+          set_err = EINA_TRUE;
+        break;
+
+      case ELM_PREFS_TYPE_FLOAT:
+        if (!eina_value_setup(&(item->value), EINA_VALUE_TYPE_FLOAT))
+          setup_err = EINA_TRUE;
+        else if (!eina_value_set(&(item->value), it->value.f.f))
+          set_err = EINA_TRUE;
+        break;
+
+      case ELM_PREFS_TYPE_DATE:
+      {
+         struct timeval val;
+         struct tm t;
+
+         memset(&val, 0, sizeof val);
+         memset(&t, 0, sizeof t);
+
+         t.tm_year = it->value.d.y - 1900;
+         t.tm_mon = it->value.d.m - 1;
+         t.tm_mday = it->value.d.d;
+         val.tv_sec = mktime(&t);
+
+         if (!eina_value_setup(&(item->value), EINA_VALUE_TYPE_TIMEVAL))
+           setup_err = EINA_TRUE;
+         else if (!eina_value_set(&(item->value), val))
+           set_err = EINA_TRUE;
+      }
+      break;
+
+      case ELM_PREFS_TYPE_PAGE:
+        if (eet_file) _eet_data_load(prefs_data, eet_file, it->value.s.s);
+
+      case ELM_PREFS_TYPE_TEXTAREA:
+      case ELM_PREFS_TYPE_TEXT: /* using text type for all
+                                 * text-like data */
+        if (!eina_value_setup(&(item->value), EINA_VALUE_TYPE_STRINGSHARE))
+          setup_err = EINA_TRUE;
+        else if (!eina_value_set(&(item->value), it->value.s.s))
+          set_err = EINA_TRUE;
+        eina_stringshare_del(it->value.s.s);
+        break;
+
+      default:
+        ERR("bad item (type = %d) fetched from data file %s, skipping it",
+            it->type, prefs_data->data_file);
+        free(item);
+        return NULL;
+     }
+
+   if (setup_err || set_err)
+     {
+        ERR("failed to set value for item %s, skipping it", it->name);
+
+        if (set_err) eina_value_flush(&(item->value));
+        free(item);
+        return NULL;
+     }
+
+   return item;
+}
+
 static void
 _eet_data_load(Elm_Prefs_Data *prefs_data,
                Eet_File *eet_file,
@@ -233,93 +383,95 @@ _eet_data_load(Elm_Prefs_Data *prefs_data,
 
    EINA_LIST_FREE(values->values, it)
      {
-        Elm_Prefs_Data_Item *item = malloc(sizeof(*item));
-        Eina_Bool skip        = EINA_FALSE;
-        Eina_Bool set_err     = EINA_FALSE;
-        Eina_Bool setup_err   = EINA_FALSE;
+        Elm_Prefs_Data_Item *item = _eet_data_item_new(prefs_data, eet_file, it);
 
-        item->type = it->type;
+        if (item) eina_hash_set(map, it->name, item);
 
-        switch (it->type)
-          {
-           case ELM_PREFS_TYPE_BOOL:
-             if (!eina_value_setup(&(item->value), EINA_VALUE_TYPE_UCHAR))
-               setup_err = EINA_TRUE;
-             else if (!eina_value_set(&(item->value), it->value.b.b))
-               set_err = EINA_TRUE;
-             break;
+        eina_stringshare_del(it->name);
+        free(it);
+     }
 
-           case ELM_PREFS_TYPE_INT:
-             if (!eina_value_setup(&(item->value), EINA_VALUE_TYPE_INT))
-               setup_err = EINA_TRUE;
-             else if (!eina_value_set(&(item->value), it->value.i.i))
-               set_err = EINA_TRUE;
-             break;
+   free(values);
+}
 
-           case ELM_PREFS_TYPE_FLOAT:
-             if (!eina_value_setup(&(item->value), EINA_VALUE_TYPE_FLOAT))
-               setup_err = EINA_TRUE;
-             else if (!eina_value_set(&(item->value), it->value.f.f))
-               set_err = EINA_TRUE;
-             break;
+/* Replays the journal written in ELM_PREFS_DATA_SAVE_MODE_JOURNAL on top
+ * of the values read from the file. A record cut short by a crash ends
+ * the replay, the ones before it are kept. */
+static void
+_elm_prefs_data_journal_load(Elm_Prefs_Data *prefs_data)
+{
+   char path[PATH_MAX];
+   Eina_File *f;
+   const unsigned char *map;
+   size_t size, pos = 0;
+
+   snprintf(path, sizeof(path), "%s.journal", prefs_data->data_file);
+   f = eina_file_open(path, EINA_FALSE);
+   if (!f) return;
+
+   size = eina_file_size_get(f);
+   map = eina_file_map_all(f, EINA_FILE_SEQUENTIAL);
+   if (!map)
+     {
+        eina_file_close(f);
+        return;
+     }
 
-           case ELM_PREFS_TYPE_DATE:
-           {
-              struct timeval val;
-              struct tm t;
-
-              memset(&val, 0, sizeof val);
-              memset(&t, 0, sizeof t);
-
-              t.tm_year = it->value.d.y - 1900;
-              t.tm_mon = it->value.d.m - 1;
-              t.tm_mday = it->value.d.d;
-              val.tv_sec = mktime(&t);
-
-              if (!eina_value_setup(&(item->value), EINA_VALUE_TYPE_TIMEVAL))
-                setup_err = EINA_TRUE;
-              else if (!eina_value_set(&(item->value), val))
-                set_err = EINA_TRUE;
-           }
-           break;
-
-           case ELM_PREFS_TYPE_PAGE:
-             _eet_data_load(prefs_data, eet_file, it->value.s.s);
-
-           case ELM_PREFS_TYPE_TEXTAREA:
-           case ELM_PREFS_TYPE_TEXT: /* using text type for all
-                                      * text-like data */
-             if (!eina_value_setup(&(item->value), EINA_VALUE_TYPE_STRINGSHARE))
-               setup_err = EINA_TRUE;
-             else if (!eina_value_set(&(item->value), it->value.s.s))
-               set_err = EINA_TRUE;
-             eina_stringshare_del(it->value.s.s);
-             break;
+   while (pos + sizeof(unsigned int) <= size)
+     {
+        Eet_Journal_Entry *entry;
+        Eina_Hash *values;
+        unsigned int len;
 
-           default:
-             ERR("bad item (type = %d) fetched from data file %s, skipping it",
-                 it->type, prefs_data->data_file);
-             ELM_SAFE_FREE(item, free);
-             skip = EINA_TRUE;
+        memcpy(&len, map + pos, sizeof(len));
+        pos += sizeof(len);
+        if (len > size - pos)
+          {
+             WRN("truncated record in %s, ignoring the rest of it", path);
              break;
           }
 
-        if (setup_err || set_err)
-          {
-             ERR("failed to set value for item %s, skipping it", it->name);
-             skip = EINA_TRUE;
+        entry = eet_data_descriptor_decode(_journal_edd, map + pos, len);
+        pos += len;
+        if (!entry) continue;
+        if (!entry->key) goto next;
 
-             if (set_err) eina_value_flush(&(item->value));
-             ELM_SAFE_FREE(item, free);
+        prefs_data->version = entry->version;
+        values = eina_hash_find(prefs_data->keys, entry->key);
+        if (!values)
+          {
+             values = eina_hash_string_superfast_new
+                 (_data_values_hash_free_cb);
+             eina_hash_set(prefs_data->keys, entry->key, values);
           }
 
-        if (!skip) eina_hash_set(map, it->name, item);
+        if (entry->deleted)
+          eina_hash_del_by_key(values, entry->deleted);
+        if (entry->item)
+          {
+             Elm_Prefs_Data_Item *item, *old;
+
+             item = _eet_data_item_new(prefs_data, NULL, entry->item);
+             if (item)
+               {
+                  old = eina_hash_set(values, entry->item->name, item);
+                  if (old) _data_values_hash_free_cb(old);
+               }
+          }
 
-        eina_stringshare_del(it->name);
-        free(it);
+next:
+        if (entry->item)
+          {
+             eina_stringshare_del(entry->item->name);
+             free(entry->item);
+          }
+        eina_stringshare_del(entry->key);
+        eina_stringshare_del(entry->deleted);
+        free(entry);
      }
 
-   free(values);
+   eina_file_map_free(f, (void *)map);
+   eina_file_close(f);
 }
 
 EAPI Elm_Prefs_Data *
@@ -329,6 +481,7 @@ elm_prefs_data_new(const char *data_file,
 {
    Eet_File       *eet_file;
    Elm_Prefs_Data *prefs_data;
+   Eina_Bool       from_bkp = EINA_FALSE;
 
    EINA_SAFETY_ON_TRUE_RETURN_VAL(mode <= EET_FILE_MODE_INVALID, NULL);
    EINA_SAFETY_ON_TRUE_RETURN_VAL(mode > EET_FILE_MODE_READ_WRITE, NULL);
@@ -352,6 +505,7 @@ elm_prefs_data_new(const char *data_file,
    prefs_data->key = eina_stringshare_add(key ? key : "main");
 
    prefs_data->keys = eina_hash_string_superfast_new(_data_keys_hash_free_cb);
+   prefs_data->changed = eina_hash_string_superfast_new(NULL);
 
    /* we can only start from scratch (ignore input) and (over)write on
     * save in this case, so skip input reading */
@@ -373,6 +527,7 @@ elm_prefs_data_new(const char *data_file,
             bkp);
 
         eet_file = eet_open(bkp, EET_FILE_MODE_READ);
+        from_bkp = !!eet_file;
      }
 
    if (eet_file)
@@ -381,6 +536,12 @@ elm_prefs_data_new(const char *data_file,
         eet_close(eet_file);
      }
 
+   /* changes which didn't make it to a full save yet. they were made
+    * on top of the main file, replaying them over the older backup
+    * would mix up two versions of the data */
+   if (!from_bkp)
+     _elm_prefs_data_journal_load(prefs_data);
+
    return prefs_data;
 }
 
@@ -392,113 +553,183 @@ elm_prefs_data_version_get(const Elm_Prefs_Data *prefs_data)
    return prefs_data->version;
 }
 
+/* fills @a it with the serializable form of @a item, referencing its
+ * strings (see _eet_data_item_flush()) */
+static Eina_Bool
+_eet_data_item_fill(Eet_Data_Item *it,
+                    const char *name,
+                    const Elm_Prefs_Data_Item *item)
+{
+   const Eina_Value_Type *t = eina_value_type_get(&(item->value));
+   Eina_Bool err = EINA_FALSE;
+
+   it->type = item->type;
+
+   if (t == EINA_VALUE_TYPE_UCHAR)
+     {
+        if (!eina_value_get(&(item->value), &(it->value.b.b)))
+          err = EINA_TRUE;
+     }
+   else if (t == EINA_VALUE_TYPE_INT)
+     {
+        if (!eina_value_get(&(item->value), &(it->value.i.i)))
+          err = EINA_TRUE;
+     }
+   else if (t == EINA_VALUE_TYPE_FLOAT)
+     {
+        if (!eina_value_get(&(item->value), &(it->value.f.f)))
+          err = EINA_TRUE;
+     }
+   else if ((t == EINA_VALUE_TYPE_STRINGSHARE) &&
+            ((it->type == ELM_PREFS_TYPE_TEXT) ||
+             (it->type == ELM_PREFS_TYPE_TEXTAREA) ||
+             (it->type == ELM_PREFS_TYPE_PAGE)))
+     {
+        if (!eina_value_get(&(item->value), &(it->value.s.s)))
+          err = EINA_TRUE;
+        else
+          eina_stringshare_ref(it->value.s.s);
+     }
+   else if (t == EINA_VALUE_TYPE_TIMEVAL)
+     {
+        struct timeval val;
+        struct tm *tm;
+
+        if (eina_value_get(&(item->value), &val))
+          {
+             time_t gmt = val.tv_sec;
+
+             tm = gmtime(&gmt);
+
+             it->value.d.y = tm->tm_year + 1900;
+             it->value.d.m = tm->tm_mon + 1;
+             it->value.d.d = tm->tm_mday;
+          }
+        else
+          err = EINA_TRUE;
+     }
+   else
+     {
+        ERR("bad value found on elm prefs data, skipping it");
+        return EINA_FALSE;
+     }
+
+   if (err)
+     {
+        ERR("failed to get value from %s, skipping it", name);
+        return EINA_FALSE;
+     }
+
+   it->name = eina_stringshare_add(name);
+   return EINA_TRUE;
+}
+
 static void
-_eet_data_save(const Elm_Prefs_Data *prefs_data,
-               Eet_File *eet_file,
-               const char *key)
+_eet_data_item_flush(Eet_Data_Item *it)
 {
-   Eet_Data_Value edv;
+   eina_stringshare_del(it->name);
+   if ((it->type == ELM_PREFS_TYPE_TEXT) ||
+       (it->type == ELM_PREFS_TYPE_TEXTAREA) ||
+       (it->type == ELM_PREFS_TYPE_PAGE))
+     eina_stringshare_del(it->value.s.s);
+}
 
-   Eet_Data_Item *it;
+/* now we have to translate our prefs_data->keys hash of
+ * Elm_Prefs_Data_Item values into Eet_Data_Value nodes, so that we
+ * can serialize the latter. Groups of page items are appended to
+ * @a snapshot after the one of @a key. */
+static void
+_eet_data_snapshot(const Elm_Prefs_Data *prefs_data,
+                   const char *key,
+                   Eina_List **snapshot)
+{
+   Elm_Prefs_Data_Snapshot *snap;
    Elm_Prefs_Data_Item *item;
+   Eet_Data_Item *it;
 
    Eina_Hash *values;
    Eina_Iterator *itr;
    Eina_Hash_Tuple *tuple;
 
-   /* now we have to translate our prefs_data->values hash of
-    * Elm_Prefs_Data_Item values into an Eet_Data_Value node, so that
-    * we can serialize the latter */
-
-   edv.version = prefs_data->version;
-   edv.values = NULL;
+   snap = calloc(1, sizeof(*snap));
+   if (!snap) return;
+   snap->key = eina_stringshare_add(key);
+   snap->edv.version = prefs_data->version;
+   *snapshot = eina_list_append(*snapshot, snap);
 
    values = eina_hash_find(prefs_data->keys, key);
+   if (!values) return;
 
    itr = eina_hash_iterator_tuple_new(values);
    EINA_ITERATOR_FOREACH(itr, tuple)
      {
-        Eina_Bool err = EINA_FALSE;
-
         item = (Elm_Prefs_Data_Item*) tuple->data;
 
         it = malloc(sizeof(*it));
-        it->name = tuple->key;
-        it->type = item->type;
-
-        if (it->type == ELM_PREFS_TYPE_PAGE)
+        if (!it) continue;
+        if (!_eet_data_item_fill(it, tuple->key, item))
           {
-             const char *n;
-             if (eina_value_get(&item->value, &n))
-               _eet_data_save(prefs_data, eet_file, n);
-             else
-               err = EINA_TRUE;
+             free(it);
+             continue;
           }
 
-        const Eina_Value_Type *t = eina_value_type_get(&(item->value));
-
-        if (t == EINA_VALUE_TYPE_UCHAR)
-          {
-             if (!eina_value_get(&(item->value), &(it->value.b.b)))
-               err = EINA_TRUE;
-          }
-        else if (t == EINA_VALUE_TYPE_INT)
-          {
-             if (!eina_value_get(&(item->value), &(it->value.i.i)))
-               err = EINA_TRUE;
-          }
-        else if (t == EINA_VALUE_TYPE_FLOAT)
-          {
-             if (!eina_value_get(&(item->value), &(it->value.f.f)))
-               err = EINA_TRUE;
-          }
-        else if (t == EINA_VALUE_TYPE_STRINGSHARE)
-          {
-             if (!eina_value_get(&(item->value), &(it->value.s.s)))
-               err = EINA_TRUE;
-          }
-        else if (t == EINA_VALUE_TYPE_TIMEVAL)
-          {
-             struct timeval val;
-             struct tm *tm;
+        if (it->type == ELM_PREFS_TYPE_PAGE)
+          _eet_data_snapshot(prefs_data, it->value.s.s, snapshot);
 
-             if (eina_value_get(&(item->value), &val))
-               {
-                  time_t gmt = val.tv_sec;
+        snap->edv.values = eina_list_append(snap->edv.values, it);
+     }
+   eina_iterator_free(itr);
+}
 
-                  tm = gmtime(&gmt);
+static Eina_Bool
+_eet_data_snapshot_write(Eina_List *snapshot,
+                         Eet_File *eet_file)
+{
+   Elm_Prefs_Data_Snapshot *snap;
+   Eina_Bool ok = EINA_TRUE;
+   Eina_List *l;
 
-                  it->value.d.y = tm->tm_year + 1900;
-                  it->value.d.m = tm->tm_mon + 1;
-                  it->value.d.d = tm->tm_mday;
-               }
-             else
-               err = EINA_TRUE;
-          }
-        else
+   EINA_LIST_FOREACH(snapshot, l, snap)
+     {
+        if (!(eet_data_write(eet_file, _values_edd, snap->key, &(snap->edv),
+                             EET_COMPRESSION_DEFAULT)))
           {
-             ERR("bad value found on elm prefs data, skipping it");
-             free(it);
-             continue;
+             ERR("failed to write elm prefs data!");
+             ok = EINA_FALSE;
           }
+     }
 
-        if (err)
+   return ok;
+}
+
+static void
+_eet_data_snapshot_free(Eina_List *snapshot)
+{
+   Elm_Prefs_Data_Snapshot *snap;
+   Eet_Data_Item *it;
+
+   EINA_LIST_FREE(snapshot, snap)
+     {
+        EINA_LIST_FREE(snap->edv.values, it)
           {
-             ERR("failed to get value from %s, skipping it", it->name);
+             _eet_data_item_flush(it);
              free(it);
-             continue;
           }
-
-        edv.values = eina_list_append(edv.values, it);
+        eina_stringshare_del(snap->key);
+        free(snap);
      }
-   eina_iterator_free(itr);
+}
 
-   if (!(eet_data_write(eet_file, _values_edd, key, &edv,
-                        EET_COMPRESSION_DEFAULT)))
-     ERR("failed to write elm prefs data!");
+static void
+_eet_data_save(const Elm_Prefs_Data *prefs_data,
+               Eet_File *eet_file,
+               const char *key)
+{
+   Eina_List *snapshot = NULL;
 
-   EINA_LIST_FREE(edv.values, it)
-      free(it);
+   _eet_data_snapshot(prefs_data, key, &snapshot);
+   _eet_data_snapshot_write(snapshot, eet_file);
+   _eet_data_snapshot_free(snapshot);
 }
 
 static void
@@ -518,6 +749,15 @@ _elm_prefs_data_save_do(const Elm_Prefs_Data *prefs_data,
      {
         _eet_data_save(prefs_data, eet_file, key);
         eet_close(eet_file);
+
+        /* everything the journal had is in the file now */
+        if (!strcmp(file, prefs_data->data_file))
+          {
+             char journal[PATH_MAX];
+
+             snprintf(journal, sizeof(journal), "%s.journal", file);
+             ecore_file_unlink(journal);
+          }
      }
    else
      {
@@ -526,6 +766,374 @@ _elm_prefs_data_save_do(const Elm_Prefs_Data *prefs_data,
      }
 }
 
+/* Appends the record for @a path (a NULL path is a version change)
+ * to @a buf, as its size followed by the encoded entry. */
+static Eina_Bool
+_elm_prefs_data_journal_record_append(const Elm_Prefs_Data *prefs_data,
+                                      Eina_Binbuf *buf,
+                                      const char *path)
+{
+   char key[PATH_MAX];
+   Eet_Journal_Entry entry;
+   Eet_Data_Item it;
+   unsigned int len;
+   void *blob;
+   int size;
+
+   memset(&entry, 0, sizeof(entry));
+   entry.key = prefs_data->key;
+   entry.version = prefs_data->version;
+
+   if (path)
+     {
+        Elm_Prefs_Data_Item *item = NULL;
+        const char *name = strrchr(path, ':');
+        Eina_Hash *values;
+        size_t n;
+
+        if (!name) return EINA_FALSE;
+        n = name - path;
+        strncpy(key, path, n);
+        key[n] = '\0';
+        name++;
+        entry.key = key;
+
+        values = eina_hash_find(prefs_data->keys, key);
+        if (values) item = eina_hash_find(values, name);
+        if (item)
+          {
+             if (!_eet_data_item_fill(&it, name, item)) return EINA_FALSE;
+             entry.item = &it;
+          }
+        else
+          entry.deleted = name;
+     }
+
+   blob = eet_data_descriptor_encode(_journal_edd, &entry, &size);
+   if (entry.item) _eet_data_item_flush(&it);
+   if ((!blob) || (size <= 0))
+     {
+        free(blob);
+        return EINA_FALSE;
+     }
+
+   len = size;
+   eina_binbuf_append_length(buf, (const unsigned char *)&len, sizeof(len));
+   eina_binbuf_append_length(buf, blob, size);
+   free(blob);
+
+   return EINA_TRUE;
+}
+
+/* the records of the values changed since the last journal write, NULL
+ * if one of them can't be made */
+static Eina_Binbuf *
+_elm_prefs_data_journal_records(const Elm_Prefs_Data *prefs_data)
+{
+   Eina_Binbuf *buf = eina_binbuf_new();
+   Eina_Iterator *itr;
+   const char *path;
+   Eina_Bool ok = EINA_TRUE;
+
+   if (!buf) return NULL;
+
+   itr = eina_hash_iterator_key_new(prefs_data->changed);
+   EINA_ITERATOR_FOREACH(itr, path)
+     {
+        if (!_elm_prefs_data_journal_record_append(prefs_data, buf, path))
+          {
+             ok = EINA_FALSE;
+             break;
+          }
+     }
+   eina_iterator_free(itr);
+
+   if ((ok) && (!eina_binbuf_length_get(buf)))
+     ok = _elm_prefs_data_journal_record_append(prefs_data, buf, NULL);
+
+   if (!ok)
+     {
+        eina_binbuf_free(buf);
+        return NULL;
+     }
+
+   return buf;
+}
+
+static Eina_Bool
+_elm_prefs_data_file_sync(const char *path)
+{
+   int fd, ret;
+
+   fd = open(path, O_RDONLY);
+   if (fd < 0) return EINA_FALSE;
+   ret = fsync(fd);
+   close(fd);
+
+   return ret == 0;
+}
+
+/* Worker side of a snapshot: it's written to a temporary file, synced
+ * and renamed over the data file, so the data file is always either
+ * the old or the new one in full. */
+static Eina_Bool
+_elm_prefs_data_job_snapshot_write(Elm_Prefs_Data_Job *job)
+{
+   char tmp[PATH_MAX], bkp[PATH_MAX], journal[PATH_MAX];
+   Eet_File *eet_file;
+   Eina_Bool ok;
+
+   snprintf(tmp, sizeof(tmp), "%s.tmp", job->file);
+   snprintf(bkp, sizeof(bkp), "%s.bkp", job->file);
+   snprintf(journal, sizeof(journal), "%s.journal", job->file);
+
+   eet_file = eet_open(tmp, EET_FILE_MODE_WRITE);
+   if (!eet_file)
+     {
+        ERR("failed to open elm prefs data file to write!");
+        return EINA_FALSE;
+     }
+   ok = _eet_data_snapshot_write(job->snapshot, eet_file);
+   if (eet_close(eet_file) != EET_ERROR_NONE) ok = EINA_FALSE;
+   if ((!ok) || (!_elm_prefs_data_file_sync(tmp)))
+     {
+        ERR("failed to write elm prefs data to %s", tmp);
+        unlink(tmp);
+        return EINA_FALSE;
+     }
+
+   unlink(bkp);
+#ifndef _WIN32
+   if ((link(job->file, bkp) < 0) && (errno != ENOENT))
+     WRN("failed to keep a backup of %s", job->file);
+#else
+   rename(job->file, bkp);
+#endif
+   if (rename(tmp, job->file) < 0)
+     {
+        ERR("failed to replace %s: %s", job->file, strerror(errno));
+        unlink(tmp);
+        return EINA_FALSE;
+     }
+
+   unlink(journal);
+   return EINA_TRUE;
+}
+
+static Eina_Bool
+_elm_prefs_data_job_journal_write(Elm_Prefs_Data_Job *job)
+{
+   char path[PATH_MAX];
+   const unsigned char *buf = eina_binbuf_string_get(job->journal);
+   size_t len = eina_binbuf_length_get(job->journal);
+   ssize_t w;
+   int fd;
+
+   snprintf(path, sizeof(path), "%s.journal", job->file);
+   fd = open(path, O_WRONLY | O_CREAT | O_APPEND, S_IRUSR | S_IWUSR);
+   if (fd < 0)
+     {
+        ERR("failed to open %s: %s", path, strerror(errno));
+        return EINA_FALSE;
+     }
+
+   while (len > 0)
+     {
+        w = write(fd, buf, len);
+        if (w < 0)
+          {
+             if (errno == EINTR) continue;
+             break;
+          }
+        buf += w;
+        len -= w;
+     }
+
+   if ((len > 0) || (fsync(fd) < 0))
+     {
+        ERR("failed to append to %s", path);
+        close(fd);
+        return EINA_FALSE;
+     }
+
+   close(fd);
+   return EINA_TRUE;
+}
+
+static void
+_elm_prefs_data_job_run(void *data, Ecore_Thread *thread EINA_UNUSED)
+{
+   Elm_Prefs_Data_Job *job = data;
+   Eina_Bool ok = EINA_TRUE;
+
+   if (job->snapshot) ok = _elm_prefs_data_job_snapshot_write(job);
+   if ((ok) && (job->journal)) ok = _elm_prefs_data_job_journal_write(job);
+
+   eina_lock_take(&job->lock);
+   job->ok = ok;
+   job->done = EINA_TRUE;
+   eina_condition_broadcast(&job->cond);
+   eina_lock_release(&job->lock);
+}
+
+static void
+_elm_prefs_data_job_free(Elm_Prefs_Data_Job *job)
+{
+   _eet_data_snapshot_free(job->snapshot);
+   if (job->journal) eina_binbuf_free(job->journal);
+   eina_stringshare_del(job->file);
+   eina_condition_free(&job->cond);
+   eina_lock_free(&job->lock);
+   free(job);
+}
+
+/* takes the pending changes of @a prefs_data: just the changed values
+ * if they can go to the journal, a snapshot of everything otherwise */
+static Elm_Prefs_Data_Job *
+_elm_prefs_data_job_new(Elm_Prefs_Data *prefs_data)
+{
+   Elm_Prefs_Data_Job *job;
+
+   job = calloc(1, sizeof(*job));
+   if (!job) return NULL;
+
+   job->prefs_data = prefs_data;
+   job->file = eina_stringshare_ref(prefs_data->data_file);
+   eina_lock_new(&job->lock);
+   eina_condition_new(&job->cond, &job->lock);
+
+   if ((prefs_data->save_mode == ELM_PREFS_DATA_SAVE_MODE_JOURNAL) &&
+       (prefs_data->journal_ok) &&
+       (prefs_data->journal_size < ELM_PREFS_DATA_JOURNAL_MAX))
+     {
+        job->journal = _elm_prefs_data_journal_records(prefs_data);
+        if (job->journal)
+          prefs_data->journal_size += eina_binbuf_length_get(job->journal);
+     }
+
+   if (!job->journal)
+     {
+        _eet_data_snapshot(prefs_data, prefs_data->key, &job->snapshot);
+        prefs_data->journal_size = 0;
+        prefs_data->journal_ok = EINA_TRUE;
+     }
+
+   eina_hash_free_buckets(prefs_data->changed);
+
+   return job;
+}
+
+/* Blocks until the write in flight, if any, is on the disk. */
+static void
+_elm_prefs_data_job_wait(Elm_Prefs_Data *prefs_data)
+{
+   Elm_Prefs_Data_Job *job = prefs_data->job;
+
+   if (!job) return;
+
+   eina_lock_take(&job->lock);
+   while (!job->done)
+     eina_condition_wait(&job->cond);
+   if (!job->ok)
+     {
+        prefs_data->journal_ok = EINA_FALSE;
+        prefs_data->dirty = EINA_TRUE;
+     }
+   eina_lock_release(&job->lock);
+
+   /* the end callback is still to come, it frees the job */
+   job->prefs_data = NULL;
+   prefs_data->job = NULL;
+}
+
+static void _elm_prefs_data_flush(Elm_Prefs_Data *prefs_data,
+                                  Eina_Bool sync);
+
+static void
+_elm_prefs_data_job_end(void *data, Ecore_Thread *thread EINA_UNUSED)
+{
+   Elm_Prefs_Data_Job *job = data;
+   Elm_Prefs_Data *prefs_data = job->prefs_data;
+
+   if (prefs_data)
+     {
+        prefs_data->job = NULL;
+        if (!job->ok)
+          {
+             /* no telling what made it to the disk, start over from a
+              * snapshot on the next write */
+             prefs_data->journal_ok = EINA_FALSE;
+             prefs_data->dirty = EINA_TRUE;
+          }
+        if (prefs_data->resave)
+          {
+             prefs_data->resave = EINA_FALSE;
+             _elm_prefs_data_flush(prefs_data, EINA_FALSE);
+          }
+     }
+
+   _elm_prefs_data_job_free(job);
+}
+
+static void
+_elm_prefs_data_job_cancel(void *data, Ecore_Thread *thread)
+{
+   Elm_Prefs_Data_Job *job = data;
+
+   eina_lock_take(&job->lock);
+   if (!job->done) job->ok = EINA_FALSE;
+   job->done = EINA_TRUE;
+   eina_condition_broadcast(&job->cond);
+   eina_lock_release(&job->lock);
+
+   _elm_prefs_data_job_end(job, thread);
+}
+
+/* Writes the pending changes, on a worker thread unless @a sync.
+ * Only one write is in flight at a time, changes made meanwhile go
+ * once it is done. */
+static void
+_elm_prefs_data_flush(Elm_Prefs_Data *prefs_data,
+                      Eina_Bool sync)
+{
+   Elm_Prefs_Data_Job *job;
+
+   if (prefs_data->job)
+     {
+        if (!sync)
+          {
+             prefs_data->resave = EINA_TRUE;
+             return;
+          }
+        _elm_prefs_data_job_wait(prefs_data);
+     }
+
+   if (!prefs_data->dirty) return;
+
+   job = _elm_prefs_data_job_new(prefs_data);
+   if (!job) return;
+
+   prefs_data->dirty = EINA_FALSE;
+   prefs_data->resave = EINA_FALSE;
+
+   if (sync)
+     {
+        _elm_prefs_data_job_run(job, NULL);
+        if (!job->ok)
+          {
+             prefs_data->journal_ok = EINA_FALSE;
+             prefs_data->dirty = EINA_TRUE;
+          }
+        _elm_prefs_data_job_free(job);
+        return;
+     }
+
+   /* the cancel callback may run (and free the job) right away */
+   prefs_data->job = job;
+   ecore_thread_run(_elm_prefs_data_job_run, _elm_prefs_data_job_end,
+                    _elm_prefs_data_job_cancel, job);
+}
+
 static void
 _event_cbs_clear(Elm_Prefs_Data *prefs_data)
 {
@@ -563,6 +1171,8 @@ _elm_prefs_data_save(void *d)
 {
    Elm_Prefs_Data *prefs_data = d;
 
+   _elm_prefs_data_job_wait(prefs_data);
+
    if (!prefs_data->dirty) goto end;
 
    if (prefs_data->saving_poller) /* only then we are auto-saving */
@@ -579,6 +1189,44 @@ end:
    return ECORE_CALLBACK_CANCEL;
 }
 
+static Eina_Bool
+_elm_prefs_data_save_timer_cb(void *data)
+{
+   Elm_Prefs_Data *prefs_data = data;
+
+   prefs_data->save_timer = NULL;
+
+   if (prefs_data->dirty)
+     _elm_prefs_data_event_callback_call
+       (prefs_data, ELM_PREFS_DATA_EVENT_GROUP_AUTOSAVED,
+       (char *)prefs_data->key);
+
+   _elm_prefs_data_flush(prefs_data, EINA_FALSE);
+
+   return ECORE_CALLBACK_CANCEL;
+}
+
+/* Coalesces a burst of changes into a single write, pushing it back
+ * on each change for at most ELM_PREFS_DATA_SAVE_DELAY_MAX seconds. */
+static void
+_elm_prefs_data_save_schedule(Elm_Prefs_Data *prefs_data)
+{
+   double now = ecore_time_get();
+
+   if (!prefs_data->save_timer)
+     {
+        prefs_data->save_first = now;
+        prefs_data->save_timer = ecore_timer_add
+            (ELM_PREFS_DATA_SAVE_DELAY, _elm_prefs_data_save_timer_cb,
+            prefs_data);
+        return;
+     }
+
+   if (now + ELM_PREFS_DATA_SAVE_DELAY - prefs_data->save_first <=
+       ELM_PREFS_DATA_SAVE_DELAY_MAX)
+     ecore_timer_reset(prefs_data->save_timer);
+}
+
 static void
 _elm_prefs_data_mark_as_dirty(Elm_Prefs_Data *prefs_data)
 {
@@ -586,6 +1234,12 @@ _elm_prefs_data_mark_as_dirty(Elm_Prefs_Data *prefs_data)
 
    if ((prefs_data->autosave) && (prefs_data->mode != EET_FILE_MODE_READ))
      {
+        if (prefs_data->save_mode != ELM_PREFS_DATA_SAVE_MODE_SYNC)
+          {
+             _elm_prefs_data_save_schedule(prefs_data);
+             return;
+          }
+
         if (prefs_data->saving_poller) return;
 
         prefs_data->saving_poller = ecore_poller_add
@@ -620,9 +1274,17 @@ static void
 _elm_prefs_data_del(Elm_Prefs_Data *prefs_data)
 {
    if (prefs_data->saving_poller) ecore_poller_del(prefs_data->saving_poller);
+   ELM_SAFE_FREE(prefs_data->save_timer, ecore_timer_del);
+
+   _elm_prefs_data_job_wait(prefs_data);
 
    if (prefs_data->mode != EET_FILE_MODE_READ)
-     _elm_prefs_data_save(prefs_data);
+     {
+        if (prefs_data->save_mode == ELM_PREFS_DATA_SAVE_MODE_SYNC)
+          _elm_prefs_data_save(prefs_data);
+        else
+          _elm_prefs_data_flush(prefs_data, EINA_TRUE);
+     }
 
    while (prefs_data->event_cbs)
      {
@@ -635,6 +1297,7 @@ _elm_prefs_data_del(Elm_Prefs_Data *prefs_data)
      }
 
    eina_hash_free(prefs_data->keys);
+   eina_hash_free(prefs_data->changed);
 
    eina_stringshare_del(prefs_data->data_file);
    eina_stringshare_del(prefs_data->key);
@@ -736,6 +1399,10 @@ elm_prefs_data_value_set(Elm_Prefs_Data *prefs_data,
    _elm_prefs_data_event_callback_call
      (prefs_data, ELM_PREFS_DATA_EVENT_ITEM_CHANGED, &evt_info);
 
+   if ((prefs_data->save_mode == ELM_PREFS_DATA_SAVE_MODE_JOURNAL) &&
+       (!eina_hash_find(prefs_data->changed, path)))
+     eina_hash_add(prefs_data->changed, path, prefs_data);
+
    _elm_prefs_data_mark_as_dirty(prefs_data);
 
    return EINA_TRUE;
@@ -861,16 +1528,12 @@ elm_prefs_data_autosave_set(Elm_Prefs_Data *prefs_data,
 
    if (prefs_data->mode == EET_FILE_MODE_READ) return;
 
-   prefs_data->autosave = !!autosave;
-
+   autosave = !!autosave;
    if (prefs_data->autosave == autosave) return;
-   if ((prefs_data->autosave) && (prefs_data->dirty))
-     {
-        if (prefs_data->saving_poller) return;
+   prefs_data->autosave = autosave;
 
-        prefs_data->saving_poller = ecore_poller_add
-            (ECORE_POLLER_CORE, 1, _elm_prefs_data_save, prefs_data);
-     }
+   if ((prefs_data->autosave) && (prefs_data->dirty))
+     _elm_prefs_data_mark_as_dirty(prefs_data);
    else if ((!prefs_data->autosave) && (prefs_data->saving_poller))
      {
         ecore_poller_del(prefs_data->saving_poller);
@@ -878,6 +1541,13 @@ elm_prefs_data_autosave_set(Elm_Prefs_Data *prefs_data,
 
         _elm_prefs_data_save(prefs_data);
      }
+   else if ((!prefs_data->autosave) && (prefs_data->save_timer))
+     {
+        /* write what was scheduled now, nothing is saved on its own
+         * from here on */
+        ELM_SAFE_FREE(prefs_data->save_timer, ecore_timer_del);
+        _elm_prefs_data_flush(prefs_data, EINA_FALSE);
+     }
 }
 
 EAPI Eina_Bool
@@ -907,22 +1577,75 @@ elm_prefs_data_save(const Elm_Prefs_Data *prefs_data,
              ERR("read only file %s, we can't save", prefs_data->data_file);
              return EINA_FALSE;
           }
-        if (prefs_data->saving_poller)
+        Elm_Prefs_Data *pd = (Elm_Prefs_Data *)prefs_data;
+
+        if (pd->saving_poller)
           {
-             ecore_poller_del(prefs_data->saving_poller);
-             ((Elm_Prefs_Data *)prefs_data)->saving_poller = NULL;
+             ecore_poller_del(pd->saving_poller);
+             pd->saving_poller = NULL;
           }
+        ELM_SAFE_FREE(pd->save_timer, ecore_timer_del);
+
+        if (pd->save_mode != ELM_PREFS_DATA_SAVE_MODE_SYNC)
+          {
+             /* an explicit save always folds the journal back in */
+             pd->journal_ok = EINA_FALSE;
+             pd->dirty = EINA_TRUE;
+             _elm_prefs_data_flush(pd, EINA_TRUE);
+
+             return !pd->dirty;
+          }
+
+        _elm_prefs_data_job_wait(pd);
         _elm_prefs_data_save_do
            (prefs_data, prefs_data->data_file, prefs_data->key);
 
         /* we only clean the dirty flag if we save to our original
          * file */
-        ((Elm_Prefs_Data *)prefs_data)->dirty = EINA_FALSE;
+        pd->dirty = EINA_FALSE;
      }
 
    return EINA_TRUE;
 }
 
+EAPI void
+elm_prefs_data_save_mode_set(Elm_Prefs_Data *prefs_data,
+                             Elm_Prefs_Data_Save_Mode mode)
+{
+   ELM_PREFS_DATA_CHECK(prefs_data);
+   EINA_SAFETY_ON_TRUE_RETURN(mode < ELM_PREFS_DATA_SAVE_MODE_SYNC);
+   EINA_SAFETY_ON_TRUE_RETURN(mode > ELM_PREFS_DATA_SAVE_MODE_JOURNAL);
+
+   if (prefs_data->save_mode == mode) return;
+
+   /* the journal only knows about changes made while it's in use, so
+    * its first write has to be a full snapshot */
+   if (mode == ELM_PREFS_DATA_SAVE_MODE_JOURNAL)
+     {
+        prefs_data->journal_ok = EINA_FALSE;
+        eina_hash_free_buckets(prefs_data->changed);
+     }
+
+   prefs_data->save_mode = mode;
+
+   /* a pending automatic save moves to the new mode's schedule */
+   if ((prefs_data->saving_poller) || (prefs_data->save_timer))
+     {
+        ELM_SAFE_FREE(prefs_data->saving_poller, ecore_poller_del);
+        ELM_SAFE_FREE(prefs_data->save_timer, ecore_timer_del);
+        _elm_prefs_data_mark_as_dirty(prefs_data);
+     }
+}
+
+EAPI Elm_Prefs_Data_Save_Mode
+elm_prefs_data_save_mode_get(const Elm_Prefs_Data *prefs_data)
+{
+   ELM_PREFS_DATA_CHECK_OR_RETURN_VAL(prefs_data,
+                                      ELM_PREFS_DATA_SAVE_MODE_SYNC);
+
+   return prefs_data->save_mode;
+}
+
 #define DESC_NEW(_type, _desc)                             \
   EET_EINA_STREAM_DATA_DESCRIPTOR_CLASS_SET(&eddc, _type); \
   _desc = eet_data_descriptor_stream_new(&eddc)
@@ -1032,6 +1755,16 @@ _elm_prefs_data_descriptors_init(void)
 
    EET_DATA_DESCRIPTOR_ADD_LIST
      (_values_edd, Eet_Data_Value, "values", values, _item_edd);
+
+   DESC_NEW(Eet_Journal_Entry, _journal_edd);
+   EET_DATA_DESCRIPTOR_ADD_BASIC
+     (_journal_edd, Eet_Journal_Entry, "key", key, EET_T_STRING);
+   EET_DATA_DESCRIPTOR_ADD_BASIC
+     (_journal_edd, Eet_Journal_Entry, "deleted", deleted, EET_T_STRING);
+   EET_DATA_DESCRIPTOR_ADD_BASIC
+     (_journal_edd, Eet_Journal_Entry, "version", version, EET_T_UINT);
+   EET_DATA_DESCRIPTOR_ADD_SUB
+     (_journal_edd, Eet_Journal_Entry, "item", item, _item_edd);
 }
 
 #undef DESC_NEW
@@ -1046,6 +1779,7 @@ _elm_prefs_data_descriptors_shutdown(void)
    eet_data_descriptor_free(_values_edd);
    eet_data_descriptor_free(_item_edd);
    eet_data_descriptor_free(_item_unified_edd);
+   eet_data_descriptor_free(_journal_edd);
 }
 
 void
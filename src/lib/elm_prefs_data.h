@@ -43,6 +43,19 @@ typedef enum {
    ELM_PREFS_DATA_EVENT_LAST /** sentinel value, don't use it */
 } Elm_Prefs_Data_Event_Type;
 
+/**
+ * How a prefs data handle writes its values back to its file.
+ *
+ * @see elm_prefs_data_save_mode_set()
+ *
+ * @since 1.18
+ */
+typedef enum {
+   ELM_PREFS_DATA_SAVE_MODE_SYNC, /** The whole file is rewritten on the main loop (default) */
+   ELM_PREFS_DATA_SAVE_MODE_ASYNC, /** A snapshot of the values is written to a new file by a worker thread, synced and renamed over the old one */
+   ELM_PREFS_DATA_SAVE_MODE_JOURNAL /** Changed values are appended to a journal file by a worker thread, the journal being folded back into the file once it grows */
+} Elm_Prefs_Data_Save_Mode;
+
 /**
  * @typedef Elm_Prefs_Data
  *
@@ -293,6 +306,40 @@ EAPI Eina_Bool elm_prefs_data_save(const Elm_Prefs_Data *prefs_data,
                                    const char *file,
                                    const char *key);
 
+/**
+ * Set how a given elm prefs data handle writes its values back.
+ *
+ * @param prefs_data A valid prefs data handle
+ * @param mode The save mode
+ *
+ * With #ELM_PREFS_DATA_SAVE_MODE_ASYNC and
+ * #ELM_PREFS_DATA_SAVE_MODE_JOURNAL, bursts of
+ * elm_prefs_data_value_set() calls are coalesced and the file is
+ * written by a worker thread, so the main loop never waits on the
+ * disk. In journal mode only the values that changed are written, to
+ * a @c .journal file next to the data file, which is read back by
+ * elm_prefs_data_new(). Explicit calls to elm_prefs_data_save() and
+ * the last unreference of the handle still write synchronously.
+ *
+ * @see elm_prefs_data_save_mode_get()
+ *
+ * @since 1.18
+ */
+EAPI void      elm_prefs_data_save_mode_set(Elm_Prefs_Data *prefs_data,
+                                            Elm_Prefs_Data_Save_Mode mode);
+
+/**
+ * Get how a given elm prefs data handle writes its values back.
+ *
+ * @param prefs_data A valid prefs data handle
+ * @return The save mode
+ *
+ * @see elm_prefs_data_save_mode_set()
+ *
+ * @since 1.18
+ */
+EAPI Elm_Prefs_Data_Save_Mode elm_prefs_data_save_mode_get(const Elm_Prefs_Data *prefs_data);
+
 /**
  * @}
  */
@@ -214,6 +214,7 @@ struct _Elm_Config
    double        zoom_friction;
    Eina_Bool     scroll_animation_disable;
    double        scroll_accel_factor;
+   unsigned char scroll_momentum_predict;
    unsigned char thumbscroll_bounce_enable;
    double        thumbscroll_border_friction;
    double        thumbscroll_sensitivity_friction;
@@ -260,6 +261,7 @@ struct _Elm_Config
    unsigned char effect_enable;
    unsigned char desktop_entry;
    unsigned char context_menu_disabled;
+   unsigned char frame_stats;
    unsigned char password_show_last;
    double        password_show_last_timeout;
    unsigned char glayer_zoom_finger_enable;
@@ -366,6 +368,15 @@ Eo                   *_elm_atspi_bridge_get(void);
 void                 _elm_atspi_bridge_init(void);
 void                 _elm_atspi_bridge_shutdown(void);
 
+void                 _elm_layout_size_memo_stats_get(const Evas_Object *obj, unsigned int *hits, unsigned int *misses);
+
+Eina_Bool            _elm_cnp_selection_data_stream(Evas_Object *obj, Elm_Selection_Data *ev, Elm_Sel_Format convert, Elm_Selection_Stream_Cb chunkcb, void *udata);
+Eina_Bool            _elm_cnp_selection_piece_stream(Evas_Object *obj, Elm_Selection_Data *ev, Elm_Sel_Format convert, Elm_Selection_Stream_Cb chunkcb, void *udata);
+void                 _elm_cnp_selection_pieces_end(const Evas_Object *obj);
+Eina_Bool            _elm_drop_target_hit(Evas *evas, Evas_Coord x, Evas_Coord y);
+Eina_Bool            _elm_drop_target_index_add(Evas_Object *obj);
+void                 _elm_drop_item_container_pos(Evas_Object *obj, Evas_Coord x, Evas_Coord y, Elm_Xdnd_Action action);
+
 void                 _elm_prefs_init(void);
 void                 _elm_prefs_shutdown(void);
 
@@ -382,11 +393,26 @@ void                 _elm_ews_wm_rescale(Elm_Theme *th,
                                          Eina_Bool use_theme);
 
 void                 _elm_win_shutdown(void);
+
+void                 _elm_quicklaunch_profile_add(const char *kind,
+                                                  const char *name);
+void                 _elm_quicklaunch_profile_save(void);
+void                 _elm_quicklaunch_warm(void);
+Eina_Bool            _elm_quicklaunch_first_frame_pending(void);
+void                 _elm_quicklaunch_first_frame(double t);
 void                 _elm_win_rescale(Elm_Theme *th,
                                       Eina_Bool use_theme);
 void                 _elm_win_access(Eina_Bool is_access);
 void                 _elm_win_translate(void);
 void                 _elm_win_focus_reconfigure(void);
+void                 _elm_win_focus_grid_object_dirty(Evas_Object *obj,
+                                                      Evas_Object *subobj);
+void                 _elm_win_focus_grid_object_del(Evas_Object *obj,
+                                                    Evas_Object *subobj);
+unsigned int         _elm_win_focus_grid_query(Evas_Object *obj,
+                                               const Evas_Object *base,
+                                               double degree,
+                                               double *limit);
 
 Ecore_X_Window       _elm_ee_xwin_get(const Ecore_Evas *ee);
 
@@ -9,11 +9,28 @@
 
 typedef struct _Elm_Store_Filesystem           Elm_Store_Filesystem;
 typedef struct _Elm_Store_Item_Filesystem      Elm_Store_Item_Filesystem;
+typedef struct _Elm_Store_Fetch_Pool           Elm_Store_Fetch_Pool;
+typedef struct _Elm_Store_Fetch_Batch          Elm_Store_Fetch_Batch;
 
 #define ELM_STORE_MAGIC            0x3f89ea56
 #define ELM_STORE_FILESYSTEM_MAGIC 0x3f89ea57
 #define ELM_STORE_ITEM_MAGIC       0x5afe8c1d
 
+#define ELM_STORE_FETCH_WORKERS    4   /* fetch threads per store, at most */
+#define ELM_STORE_FETCH_BATCH      8   /* items fetched per worker round */
+#define ELM_STORE_FETCH_IDLE       5.0 /* seconds before an idle worker quits */
+#define ELM_STORE_PREFETCH         8   /* neighbours of a realized item to prefetch, per side */
+#define ELM_STORE_PREFETCH_MAX     (4 * ELM_STORE_PREFETCH)
+#define ELM_STORE_LIST_BATCH       256 /* listed items handed to the mainloop at once, at most */
+#define ELM_STORE_LIST_INTERVAL    (1.0 / 30.0)
+
+enum
+{
+   ELM_STORE_FETCH_VISIBLE = 0,
+   ELM_STORE_FETCH_PREFETCH,
+   ELM_STORE_FETCH_LAST
+};
+
 struct _Elm_Store
 {
    EINA_MAGIC;
@@ -24,6 +41,7 @@ struct _Elm_Store
      } item;
    Evas_Object   *genlist;
    Ecore_Thread  *list_th;
+   Elm_Store_Fetch_Pool *pool;
    Eina_Inlist   *items;
    Eina_List     *realized;
    int            realized_count;
@@ -56,11 +74,14 @@ struct _Elm_Store_Item
    EINA_MAGIC;
    Elm_Store                    *store;
    Elm_Object_Item              *item;
-   Ecore_Thread                 *fetch_th;
    Ecore_Job                    *eval_job;
    const Elm_Store_Item_Mapping *mapping;
    void                         *data;
    Eina_Lock                     lock;
+   /* owned by the fetch pool, under its lock */
+   Eina_List                    *queued;
+   int                           prio;
+   Eina_Bool                     in_flight;
    Eina_Bool                     live : 1;
    Eina_Bool                     was_live : 1;
    Eina_Bool                     realized : 1;
@@ -80,28 +101,368 @@ struct _Elm_Store_Item_Filesystem
    const char *path;
 };
 
+/* fetches of all items of a store are run by a few long lived worker
+ * threads picking them from a queue, instead of a thread per item. The
+ * pool outlives its store until the last worker thread has ended */
+struct _Elm_Store_Fetch_Pool
+{
+   Elm_Store      *store; /* NULL once the store let go of it */
+   Eina_Lock       lock;
+   Eina_Condition  work; /* new items queued, or the pool is dying */
+   Eina_Condition  done; /* in_flight dropped to 0 */
+   Eina_List      *queue[ELM_STORE_FETCH_LAST];
+   int             queued;
+   int             in_flight;
+   int             workers; /* under lock, workers still picking items */
+   int             idle;
+   int             threads; /* mainloop only, threads not ended yet */
+   Eina_Bool       dead : 1;
+};
+
+struct _Elm_Store_Fetch_Batch
+{
+   int             count;
+   Elm_Store_Item *items[ELM_STORE_FETCH_BATCH];
+};
+
 static Elm_Genlist_Item_Class _store_item_class;
 
+static void _store_cache_trim(Elm_Store *st);
+
+////// **** WARNING ***********************************************************
+////   * This function runs inside a thread outside efl mainloop. Be careful! *
+//     ************************************************************************
+/* TODO: refactor lock part into core? this does not depend on filesystem part */
 static void
-_store_cache_trim(Elm_Store *st)
+_store_filesystem_fetch_do(void *data, Ecore_Thread *th EINA_UNUSED)
 {
-   while ((st->realized) &&
-          (((int)eina_list_count(st->realized) - st->realized_count)
-           > st->cache_max))
+   Elm_Store_Item *sti = data;
+   eina_lock_take(&sti->lock);
+   if (sti->data)
      {
-        Elm_Store_Item *sti = st->realized->data;
-        if (sti->realized)
+        eina_lock_release(&sti->lock);
+        return;
+     }
+   if (!sti->fetched)
+     {
+//// let fetch/unfetch do the locking
+//        eina_lock_release(&sti->lock);
+        if (sti->store->cb.fetch.func)
+          sti->store->cb.fetch.func(sti->store->cb.fetch.data, sti);
+//        eina_lock_take(&sti->lock);
+        sti->fetched = EINA_TRUE;
+     }
+   eina_lock_release(&sti->lock);
+}
+
+static void
+_store_fetch_worker(void *data, Ecore_Thread *th)
+{
+   Elm_Store_Fetch_Pool *pool = data;
+   Elm_Store_Fetch_Batch batch, *msg;
+   Elm_Store_Item *sti;
+   Eina_List *l;
+   int i, max;
+
+   eina_lock_take(&pool->lock);
+   for (;;)
+     {
+        while ((!pool->dead) && (!pool->queued))
           {
-             st->realized = eina_list_remove_list(st->realized, st->realized);
-             sti->realized = EINA_FALSE;
+             Eina_Bool woken;
+
+             pool->idle++;
+             woken = eina_condition_timedwait(&pool->work, ELM_STORE_FETCH_IDLE);
+             pool->idle--;
+             if ((!woken) && (!pool->queued)) goto end;
           }
-        eina_lock_take(&sti->lock);
-        if (!sti->fetched)
+        if ((pool->dead) || (ecore_thread_check(th))) break;
+
+        /* share the queue among the workers, but don't take the whole of
+         * it when it runs deep */
+        max = pool->queued / pool->workers;
+        if (max < 1) max = 1;
+        else if (max > ELM_STORE_FETCH_BATCH) max = ELM_STORE_FETCH_BATCH;
+
+        for (batch.count = 0; (batch.count < max) && (pool->queued); batch.count++)
           {
-             eina_lock_release(&sti->lock);
-             ELM_SAFE_FREE(sti->fetch_th, ecore_thread_cancel);
-             eina_lock_take(&sti->lock);
+             /* visible items in the order they showed up, prefetches
+              * newest first as they are the closest to where the user is */
+             if (pool->queue[ELM_STORE_FETCH_VISIBLE])
+               l = pool->queue[ELM_STORE_FETCH_VISIBLE];
+             else
+               l = eina_list_last(pool->queue[ELM_STORE_FETCH_PREFETCH]);
+             sti = eina_list_data_get(l);
+             pool->queue[sti->prio] =
+               eina_list_remove_list(pool->queue[sti->prio], l);
+             pool->queued--;
+             sti->queued = NULL;
+             sti->in_flight = EINA_TRUE;
+             batch.items[batch.count] = sti;
           }
+        pool->in_flight += batch.count;
+        eina_lock_release(&pool->lock);
+
+        for (i = 0; i < batch.count; i++)
+          _store_filesystem_fetch_do(batch.items[i], th);
+        msg = malloc(sizeof(Elm_Store_Fetch_Batch));
+        if (msg) memcpy(msg, &batch, sizeof(Elm_Store_Fetch_Batch));
+
+        eina_lock_take(&pool->lock);
+        for (i = 0; i < batch.count; i++)
+          batch.items[i]->in_flight = EINA_FALSE;
+        pool->in_flight -= batch.count;
+        if (!pool->in_flight) eina_condition_broadcast(&pool->done);
+        eina_lock_release(&pool->lock);
+
+        /* the mainloop ignores it if the store went away meanwhile */
+        if ((msg) && (!ecore_thread_feedback(th, msg))) free(msg);
+
+        eina_lock_take(&pool->lock);
+     }
+end:
+   pool->workers--;
+   eina_lock_release(&pool->lock);
+}
+//     ************************************************************************
+////   * End of separate thread function.                                     *
+////// ************************************************************************
+
+static void
+_store_fetch_pool_free(Elm_Store_Fetch_Pool *pool)
+{
+   eina_condition_free(&pool->work);
+   eina_condition_free(&pool->done);
+   eina_lock_free(&pool->lock);
+   free(pool);
+}
+
+/* TODO: refactor lock part into core? this does not depend on filesystem part */
+static void
+_store_filesystem_fetch_end(Elm_Store_Item *sti)
+{
+   eina_lock_take(&sti->lock);
+   if (sti->data) elm_genlist_item_update(sti->item);
+   eina_lock_release(&sti->lock);
+}
+
+static void
+_store_fetch_pool_feedback(void *data, Ecore_Thread *th EINA_UNUSED, void *msg)
+{
+   Elm_Store_Fetch_Pool *pool = data;
+   Elm_Store_Fetch_Batch *batch = msg;
+   Elm_Store *st = pool->store;
+   int i;
+
+   if (!st) goto end;
+   for (i = 0; i < batch->count; i++)
+     {
+        Elm_Store_Item *sti = batch->items[i];
+        Eina_Bool fetched;
+
+        _store_filesystem_fetch_end(sti);
+        if (sti->realized) continue;
+
+        /* prefetched: keep it in the cache like the realized ones */
+        eina_lock_take(&sti->lock);
+        fetched = sti->fetched;
+        eina_lock_release(&sti->lock);
+        if (!fetched) continue;
+        st->realized = eina_list_append(st->realized, sti);
+        sti->realized = EINA_TRUE;
+     }
+   _store_cache_trim(st);
+end:
+   free(batch);
+}
+
+static void
+_store_fetch_pool_end(void *data, Ecore_Thread *th EINA_UNUSED)
+{
+   Elm_Store_Fetch_Pool *pool = data;
+
+   pool->threads--;
+   if ((!pool->store) && (!pool->threads)) _store_fetch_pool_free(pool);
+}
+
+static Elm_Store_Fetch_Pool *
+_store_fetch_pool_get(Elm_Store *st)
+{
+   Elm_Store_Fetch_Pool *pool;
+
+   if (st->pool) return st->pool;
+
+   pool = calloc(1, sizeof(Elm_Store_Fetch_Pool));
+   if (!pool) return NULL;
+   if (!eina_lock_new(&pool->lock)) goto on_error;
+   if (!eina_condition_new(&pool->work, &pool->lock))
+     {
+        eina_lock_free(&pool->lock);
+        goto on_error;
+     }
+   if (!eina_condition_new(&pool->done, &pool->lock))
+     {
+        eina_condition_free(&pool->work);
+        eina_lock_free(&pool->lock);
+        goto on_error;
+     }
+   pool->store = st;
+   st->pool = pool;
+   return pool;
+
+on_error:
+   free(pool);
+   return NULL;
+}
+
+/* lets go of the pool, dropping whatever is still queued and waiting
+ * for the fetches under way, so the items can be freed right after */
+static void
+_store_fetch_pool_stop(Elm_Store *st)
+{
+   Elm_Store_Fetch_Pool *pool = st->pool;
+   Elm_Store_Item *sti;
+   int i;
+
+   if (!pool) return;
+   st->pool = NULL;
+
+   eina_lock_take(&pool->lock);
+   pool->dead = EINA_TRUE;
+   pool->store = NULL;
+   for (i = 0; i < ELM_STORE_FETCH_LAST; i++)
+     EINA_LIST_FREE(pool->queue[i], sti)
+       sti->queued = NULL;
+   pool->queued = 0;
+   eina_condition_broadcast(&pool->work);
+   while (pool->in_flight)
+     eina_condition_wait(&pool->done);
+   eina_lock_release(&pool->lock);
+
+   if (!pool->threads) _store_fetch_pool_free(pool);
+}
+
+static void
+_store_fetch_queue(Elm_Store_Item *sti, int prio)
+{
+   Elm_Store_Fetch_Pool *pool = _store_fetch_pool_get(sti->store);
+   Eina_Bool spawn = EINA_FALSE;
+   Ecore_Thread *th;
+
+   if (!pool)
+     {
+        _store_filesystem_fetch_do(sti, NULL);
+        _store_filesystem_fetch_end(sti);
+        return;
+     }
+
+   eina_lock_take(&pool->lock);
+   /* nobody else touches fetched while the item is neither queued nor
+    * in flight */
+   if ((sti->in_flight) || ((!sti->queued) && (sti->fetched)))
+     goto end;
+   if (sti->queued)
+     {
+        if (sti->prio <= prio) goto end;
+        pool->queue[sti->prio] =
+          eina_list_remove_list(pool->queue[sti->prio], sti->queued);
+        pool->queued--;
+     }
+
+   pool->queue[prio] = eina_list_append(pool->queue[prio], sti);
+   sti->queued = eina_list_last(pool->queue[prio]);
+   sti->prio = prio;
+   pool->queued++;
+
+   /* prefetches scrolled past long ago are not worth it anymore */
+   if ((prio == ELM_STORE_FETCH_PREFETCH) &&
+       (eina_list_count(pool->queue[prio]) > ELM_STORE_PREFETCH_MAX))
+     {
+        Elm_Store_Item *old = eina_list_data_get(pool->queue[prio]);
+
+        pool->queue[prio] = eina_list_remove_list(pool->queue[prio], old->queued);
+        old->queued = NULL;
+        pool->queued--;
+     }
+
+   if ((pool->queued > pool->idle) && (pool->workers < ELM_STORE_FETCH_WORKERS))
+     {
+        pool->workers++;
+        spawn = EINA_TRUE;
+     }
+   eina_condition_signal(&pool->work);
+end:
+   eina_lock_release(&pool->lock);
+
+   if (!spawn) return;
+   th = ecore_thread_feedback_run(_store_fetch_worker,
+                                  _store_fetch_pool_feedback,
+                                  _store_fetch_pool_end,
+                                  _store_fetch_pool_end,
+                                  pool, EINA_TRUE);
+   if (th) pool->threads++;
+   else
+     {
+        eina_lock_take(&pool->lock);
+        pool->workers--;
+        eina_lock_release(&pool->lock);
+     }
+}
+
+static void
+_store_fetch_cancel(Elm_Store_Item *sti)
+{
+   Elm_Store_Fetch_Pool *pool = sti->store->pool;
+
+   if (!pool) return;
+   eina_lock_take(&pool->lock);
+   if (sti->queued)
+     {
+        pool->queue[sti->prio] =
+          eina_list_remove_list(pool->queue[sti->prio], sti->queued);
+        sti->queued = NULL;
+        pool->queued--;
+     }
+   eina_lock_release(&pool->lock);
+}
+
+static void
+_store_prefetch(Elm_Store_Item *sti)
+{
+   Eina_Inlist *l;
+   int i;
+
+   for (l = EINA_INLIST_GET(sti)->next, i = 0;
+        (l) && (i < ELM_STORE_PREFETCH); l = l->next, i++)
+     _store_fetch_queue(EINA_INLIST_CONTAINER_GET(l, Elm_Store_Item),
+                        ELM_STORE_FETCH_PREFETCH);
+   for (l = EINA_INLIST_GET(sti)->prev, i = 0;
+        (l) && (i < ELM_STORE_PREFETCH); l = l->prev, i++)
+     _store_fetch_queue(EINA_INLIST_CONTAINER_GET(l, Elm_Store_Item),
+                        ELM_STORE_FETCH_PREFETCH);
+}
+
+static void
+_store_cache_trim(Elm_Store *st)
+{
+   Eina_List *l, *l_next;
+   Elm_Store_Item *sti;
+   int excess;
+
+   excess = (int)eina_list_count(st->realized) - st->realized_count
+     - st->cache_max;
+   /* oldest first, but leave whatever is on screen alone: prefetched
+    * items get appended after the visible ones, which then drift
+    * towards the head of the list while still being shown */
+   EINA_LIST_FOREACH_SAFE(st->realized, l, l_next, sti)
+     {
+        if (excess <= 0) break;
+        if (sti->live) continue;
+        st->realized = eina_list_remove_list(st->realized, l);
+        sti->realized = EINA_FALSE;
+        excess--;
+        _store_fetch_cancel(sti);
+        eina_lock_take(&sti->lock);
         sti->fetched = EINA_FALSE;
 //// let fetch/unfetch do the locking
 //        eina_lock_release(&sti->lock);
@@ -119,12 +480,12 @@ _store_genlist_del(void *data, Evas *e EINA_UNUSED, Evas_Object *obj EINA_UNUSED
    Elm_Store *st = data;
    st->genlist = NULL;
    ELM_SAFE_FREE(st->list_th, ecore_thread_cancel);
+   _store_fetch_pool_stop(st);
    st->realized = eina_list_free(st->realized);
    while (st->items)
      {
         Elm_Store_Item *sti = (Elm_Store_Item *)st->items;
         ELM_SAFE_FREE(sti->eval_job, ecore_job_del);
-        ELM_SAFE_FREE(sti->fetch_th, ecore_thread_cancel);
         if (sti->store->item.free) sti->store->item.free(sti);
         eina_lock_take(&sti->lock);
         if (sti->data)
@@ -141,56 +502,6 @@ _store_genlist_del(void *data, Evas *e EINA_UNUSED, Evas_Object *obj EINA_UNUSED
    // FIXME: kill threads and more
 }
 
-////// **** WARNING ***********************************************************
-////   * This function runs inside a thread outside efl mainloop. Be careful! *
-//     ************************************************************************
-/* TODO: refactor lock part into core? this does not depend on filesystem part */
-static void
-_store_filesystem_fetch_do(void *data, Ecore_Thread *th EINA_UNUSED)
-{
-   Elm_Store_Item *sti = data;
-   eina_lock_take(&sti->lock);
-   if (sti->data)
-     {
-        eina_lock_release(&sti->lock);
-        return;
-     }
-   if (!sti->fetched)
-     {
-//// let fetch/unfetch do the locking
-//        eina_lock_release(&sti->lock);
-        if (sti->store->cb.fetch.func)
-          sti->store->cb.fetch.func(sti->store->cb.fetch.data, sti);
-//        eina_lock_take(&sti->lock);
-        sti->fetched = EINA_TRUE;
-     }
-   eina_lock_release(&sti->lock);
-}
-//     ************************************************************************
-////   * End of separate thread function.                                     *
-////// ************************************************************************
-/* TODO: refactor lock part into core? this does not depend on filesystem part */
-static void
-_store_filesystem_fetch_end(void *data, Ecore_Thread *th)
-{
-   Elm_Store_Item *sti = data;
-   eina_lock_take(&sti->lock);
-   if (sti->data) elm_genlist_item_update(sti->item);
-   eina_lock_release(&sti->lock);
-   if (th == sti->fetch_th) sti->fetch_th = NULL;
-}
-
-/* TODO: refactor lock part into core? this does not depend on filesystem part */
-static void
-_store_filesystem_fetch_cancel(void *data, Ecore_Thread *th)
-{
-   Elm_Store_Item *sti = data;
-   eina_lock_take(&sti->lock);
-   if (th == sti->fetch_th) sti->fetch_th = NULL;
-   if (sti->data) elm_genlist_item_update(sti->item);
-   eina_lock_release(&sti->lock);
-}
-
 static void
 _store_item_eval(void *data)
 {
@@ -205,20 +516,20 @@ _store_item_eval(void *data)
           sti->store->realized = eina_list_remove(sti->store->realized, sti);
         sti->store->realized = eina_list_append(sti->store->realized, sti);
         sti->realized = EINA_TRUE;
-        if ((sti->store->fetch_thread) && (!sti->fetch_th))
-          sti->fetch_th = ecore_thread_run(_store_filesystem_fetch_do,
-                                           _store_filesystem_fetch_end,
-                                           _store_filesystem_fetch_cancel,
-                                           sti);
-        else if ((!sti->store->fetch_thread))
+        if (sti->store->fetch_thread)
+          {
+             _store_fetch_queue(sti, ELM_STORE_FETCH_VISIBLE);
+             _store_prefetch(sti);
+          }
+        else
           {
              _store_filesystem_fetch_do(sti, NULL);
-             _store_filesystem_fetch_end(sti, NULL);
+             _store_filesystem_fetch_end(sti);
           }
      }
    else
      {
-        ELM_SAFE_FREE(sti->fetch_th, ecore_thread_cancel);
+        _store_fetch_cancel(sti);
         _store_cache_trim(sti->store);
      }
 }
@@ -367,14 +678,37 @@ _store_filesystem_sort_cb(void *d1, void *d2)
    return strcoll(info1->sort_id, info2->sort_id);
 }
 
+/* listed items reach the mainloop in batches, flushed when big enough
+ * or when the previous one is getting old, so the first screen full
+ * still shows up quickly */
 static void
-_store_filesystem_list_do(void *data, Ecore_Thread *th EINA_UNUSED)
+_store_filesystem_list_flush(Ecore_Thread *th, Eina_List **batch, double *last)
+{
+   Elm_Store_Item_Info_Filesystem *info;
+
+   if (!*batch) return;
+   if ((ecore_thread_check(th)) || (!ecore_thread_feedback(th, *batch)))
+     {
+        EINA_LIST_FREE(*batch, info)
+          {
+             free(info->base.sort_id);
+             free(info);
+          }
+     }
+   *batch = NULL;
+   *last = ecore_time_get();
+}
+
+static void
+_store_filesystem_list_do(void *data, Ecore_Thread *th)
 {
    Elm_Store_Filesystem *st = data;
    Eina_Iterator *it;
    const Eina_File_Direct_Info *finf;
-   Eina_List *sorted = NULL;
+   Eina_List *sorted = NULL, *batch = NULL;
    Elm_Store_Item_Info_Filesystem *info;
+   unsigned int count = 0;
+   double last = ecore_time_get();
 
    // FIXME: need a way to abstract the open, list, feed items from list
    // and maybe get initial sortable key vals etc.
@@ -396,7 +730,16 @@ _store_filesystem_list_do(void *data, Ecore_Thread *th EINA_UNUSED)
           ok = st->base.cb.list.func(st->base.cb.list.data, &info->base);
         if (ok)
           {
-             if (!st->base.sorted) ecore_thread_feedback(th, info);
+             if (!st->base.sorted)
+               {
+                  batch = eina_list_append(batch, info);
+                  if ((++count >= ELM_STORE_LIST_BATCH) ||
+                      ((ecore_time_get() - last) >= ELM_STORE_LIST_INTERVAL))
+                    {
+                       _store_filesystem_list_flush(th, &batch, &last);
+                       count = 0;
+                    }
+               }
              else sorted = eina_list_append(sorted, info);
           }
         else
@@ -407,13 +750,21 @@ _store_filesystem_list_do(void *data, Ecore_Thread *th EINA_UNUSED)
         if (ecore_thread_check(th)) break;
      }
    eina_iterator_free(it);
+   _store_filesystem_list_flush(th, &batch, &last);
    if (sorted)
      {
         sorted = eina_list_sort(sorted, 0,
                                 EINA_COMPARE_CB(_store_filesystem_sort_cb));
-        EINA_LIST_FREE(sorted, info)
+        /* all known already, no point in trickling them */
+        while (sorted)
           {
-             if (!ecore_thread_check(th)) ecore_thread_feedback(th, info);
+             Eina_List *rest = NULL;
+             Eina_List *l = eina_list_nth_list(sorted, ELM_STORE_LIST_BATCH - 1);
+
+             if (l) batch = eina_list_split_list(sorted, l, &rest);
+             else batch = sorted;
+             sorted = rest;
+             _store_filesystem_list_flush(th, &batch, &last);
           }
      }
 }
@@ -436,15 +787,13 @@ _store_filesystem_list_cancel(void *data, Ecore_Thread *th)
 }
 
 static void
-_store_filesystem_list_update(void *data, Ecore_Thread *th EINA_UNUSED, void *msg)
+_store_filesystem_item_add(Elm_Store *st, Elm_Store_Item_Info_Filesystem *info)
 {
-   Elm_Store *st = data;
    Elm_Store_Item_Filesystem *sti;
    Elm_Genlist_Item_Class *itc;
-   Elm_Store_Item_Info_Filesystem *info = msg;
 
    sti = calloc(1, sizeof(Elm_Store_Item_Filesystem));
-   if (!sti) goto done;
+   if (!sti) return;
    eina_lock_new(&sti->base.lock);
    EINA_MAGIC_SET(&(sti->base), ELM_STORE_ITEM_MAGIC);
    sti->base.store = st;
@@ -470,9 +819,21 @@ _store_filesystem_list_update(void *data, Ecore_Thread *th EINA_UNUSED, void *ms
                                             NULL/* func */,
                                             NULL/* func data */);
    st->items = eina_inlist_append(st->items, (Eina_Inlist *)sti);
-done:
-   free(info->base.sort_id);
-   free(info);
+}
+
+static void
+_store_filesystem_list_update(void *data, Ecore_Thread *th EINA_UNUSED, void *msg)
+{
+   Elm_Store *st = data;
+   Eina_List *batch = msg;
+   Elm_Store_Item_Info_Filesystem *info;
+
+   EINA_LIST_FREE(batch, info)
+     {
+        _store_filesystem_item_add(st, info);
+        free(info->base.sort_id);
+        free(info);
+     }
 }
 
 // public api calls
@@ -534,13 +895,13 @@ elm_store_free(Elm_Store *st)
    void (*item_free)(Elm_Store_Item *);
    if (!EINA_MAGIC_CHECK(st, ELM_STORE_MAGIC)) return;
    ELM_SAFE_FREE(st->list_th, ecore_thread_cancel);
+   _store_fetch_pool_stop(st);
    st->realized = eina_list_free(st->realized);
    item_free = st->item.free;
    while (st->items)
      {
         Elm_Store_Item *sti = (Elm_Store_Item *)st->items;
         ELM_SAFE_FREE(sti->eval_job, ecore_job_del);
-        ELM_SAFE_FREE(sti->fetch_th, ecore_thread_cancel);
         if (item_free) item_free(sti);
         eina_lock_take(&sti->lock);
         if (sti->data)
@@ -17,6 +17,11 @@
  *
  * elm_store_fetch_thread_set(store, EINA_FALSE);
  *
+ * Threaded fetches are run by a small pool of worker threads per store.
+ * Items being realized in the genlist are fetched first, then a few of
+ * their neighbours ahead of time. Items that get unrealized before their
+ * turn are simply dropped from the queue.
+ *
  * Store works first by creating a store, setting up functions to list items
  * and fetch items. Currently the only store type supported is the
  * filesystem store, which will list the files inside a directory (not
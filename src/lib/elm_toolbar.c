@@ -75,24 +75,31 @@ _toolbar_item_prio_compare_cb(const void *i1,
    if (!eti2) return 1;
    if (!eti1) return -1;
 
-   if (eti2->prio.priority == eti1->prio.priority)
-     return -1;
-
    return eti2->prio.priority - eti1->prio.priority;
 }
 
+static inline Evas_Coord
+_item_extent_get(const Elm_Toolbar_Data *sd, const Elm_Toolbar_Item_Data *it)
+{
+   /* a homogeneous box gives every item the largest one's size */
+   if (sd->homogeneous) return sd->prio_cell;
+   return sd->vertical ? it->minh : it->minw;
+}
+
+/* rebuilds the priority order of the items and everything derived from
+ * it that doesn't depend on the toolbar's size. Items of equal priority
+ * keep their order in the toolbar */
 static void
-_items_visibility_fix(Elm_Toolbar_Data *sd,
-                      Evas_Coord *iw,
-                      Evas_Coord vw,
-                      Eina_Bool *more)
+_items_prio_update(Elm_Toolbar_Data *sd)
 {
    Elm_Toolbar_Item_Data *it, *prev;
-   Evas_Coord ciw = 0, cih = 0;
    Eina_List *sorted = NULL;
-   int count = 0, i = 0;
+   Evas_Coord sum = 0, cell = 0;
+   unsigned int n = 0, count = 0, i = 0;
 
-   *more = EINA_FALSE;
+   sd->prio_dirty = EINA_FALSE;
+   sd->layout_valid = EINA_FALSE;
+   sd->prio_count = sd->prio_eligible = sd->prio_shown = 0;
 
    EINA_INLIST_FOREACH(sd->items, it)
      {
@@ -101,29 +108,40 @@ _items_visibility_fix(Elm_Toolbar_Data *sd,
              prev = ELM_TOOLBAR_ITEM_FROM_INLIST(EINA_INLIST_GET(it)->prev);
              if (prev) it->prio.priority = prev->prio.priority;
           }
+        if (sd->vertical) cell = MAX(cell, it->minh);
+        else cell = MAX(cell, it->minw);
+        sorted = eina_list_append(sorted, it);
+        n++;
      }
+   sd->prio_cell = cell;
+   sorted = eina_list_sort(sorted, 0, _toolbar_item_prio_compare_cb);
 
-   EINA_INLIST_FOREACH(sd->items, it)
+   if (n > sd->prio_size)
      {
-        sorted = eina_list_sorted_insert
-            (sorted, _toolbar_item_prio_compare_cb, it);
-     }
-
-   if (sd->more_item)
-     {
-        evas_object_geometry_get(sd->VIEW(more_item), NULL, NULL, &ciw, &cih);
-        if (sd->vertical) *iw += cih;
-        else *iw += ciw;
+        Elm_Toolbar_Item_Data **items;
+        Evas_Coord *extents;
+
+        items = realloc(sd->prio_items, n * sizeof(Elm_Toolbar_Item_Data *));
+        if (items) sd->prio_items = items;
+        extents = realloc(sd->prio_extents, n * sizeof(Evas_Coord));
+        if (extents) sd->prio_extents = extents;
+        if ((!items) || (!extents))
+          {
+             ERR("Failed to allocate the toolbar priority index");
+             eina_list_free(sorted);
+             sd->prio_dirty = EINA_TRUE;
+             return;
+          }
+        sd->prio_size = n;
      }
 
    EINA_LIST_FREE(sorted, it)
      {
+        sd->prio_items[sd->prio_count++] = it;
         if (it->prio.priority > sd->standard_priority)
           {
-             evas_object_geometry_get(VIEW(it), NULL, NULL, &ciw, &cih);
-             if (sd->vertical) *iw += cih;
-             else *iw += ciw;
-             it->prio.visible = (*iw <= vw);
+             sum += _item_extent_get(sd, it);
+             sd->prio_extents[sd->prio_eligible++] = sum;
              it->in_box = sd->bx;
              if (!it->separator) count++;
           }
@@ -135,11 +153,63 @@ _items_visibility_fix(Elm_Toolbar_Data *sd,
                it->in_box = sd->bx_more;
              else
                it->in_box = sd->bx_more2;
-             *more = EINA_TRUE;
           }
      }
 }
 
+/* the items shown are a prefix of the priority ordered ones: find how
+ * many fit in @p vw with a search over their cumulative extents, and
+ * only touch the items whose visibility flips. Returns whether any
+ * did since the last call */
+static Eina_Bool
+_items_visibility_fix(Elm_Toolbar_Data *sd,
+                      Evas_Coord *iw,
+                      Evas_Coord vw,
+                      Eina_Bool *more)
+{
+   Evas_Coord ciw = 0, cih = 0;
+   unsigned int lo, hi, mid, shown, i;
+   Eina_Bool changed = EINA_FALSE;
+
+   *more = EINA_FALSE;
+
+   if (sd->prio_dirty)
+     {
+        _items_prio_update(sd);
+        for (i = 0; i < sd->prio_eligible; i++)
+          sd->prio_items[i]->prio.visible = EINA_FALSE;
+        changed = EINA_TRUE;
+     }
+
+   if (sd->more_item)
+     {
+        evas_object_geometry_get(sd->VIEW(more_item), NULL, NULL, &ciw, &cih);
+        if (sd->vertical) *iw += cih;
+        else *iw += ciw;
+     }
+
+   lo = 0;
+   hi = sd->prio_eligible;
+   while (lo < hi)
+     {
+        mid = lo + ((hi - lo) / 2);
+        if ((*iw + sd->prio_extents[mid]) <= vw) lo = mid + 1;
+        else hi = mid;
+     }
+   shown = lo;
+
+   for (i = MIN(shown, sd->prio_shown); i < MAX(shown, sd->prio_shown); i++)
+     sd->prio_items[i]->prio.visible = (i < shown);
+   if (shown != sd->prio_shown) changed = EINA_TRUE;
+   sd->prio_shown = shown;
+
+   if (sd->prio_eligible)
+     *iw += sd->prio_extents[sd->prio_eligible - 1];
+   *more = (sd->prio_eligible < sd->prio_count);
+
+   return changed;
+}
+
 static void
 _item_menu_destroy(Elm_Toolbar_Item_Data *item)
 {
@@ -261,25 +331,26 @@ _items_size_fit(Evas_Object *obj, Evas_Coord *bl, Evas_Coord view)
 
    ELM_TOOLBAR_DATA_GET(obj, sd);
 
+   /* sizes as measured by the items' last sizing evaluation */
    EINA_INLIST_FOREACH(sd->items, it)
      {
         mw = mh = -1;
         if (it->in_box && it->in_box == sd->bx)
           {
-             if (!it->separator && !it->object)
-               elm_coords_finger_size_adjust(1, &mw, 1, &mh);
-             edje_object_size_min_restricted_calc(elm_layout_edje_get(VIEW(it)), &mw, &mh, mw, mh);
+             mw = it->minw;
+             mh = it->minh;
           }
-        else if (!more)
+        else if ((!more) && (sd->more_item))
           {
              more = EINA_TRUE;
-             elm_coords_finger_size_adjust(1, &mw, 1, &mh);
-             edje_object_size_min_restricted_calc(elm_layout_edje_get(sd->VIEW(more_item)), &mw, &mh, mw, mh);
+             mw = sd->more_item->minw;
+             mh = sd->more_item->minh;
           }
 
         if (mw != -1 || mh != -1)
           {
-             if (sd->vertical) min = mh;
+             if (sd->homogeneous) min = sd->prio_cell;
+             else if (sd->vertical) min = mh;
              else min = mw;
 
              if ((!full) && ((sumf + min) > view))
@@ -362,7 +433,7 @@ _resize_job(void *data)
    Evas_Coord mw, mh, vw = 0, vh = 0, w = 0, h = 0;
    Elm_Toolbar_Item_Data *it;
    Eina_List *list;
-   Eina_Bool more;
+   Eina_Bool more, changed, overflow, relayout = EINA_FALSE;
 
    ELM_TOOLBAR_DATA_GET(obj, sd);
 
@@ -379,12 +450,12 @@ _resize_job(void *data)
         if (sd->vertical)
           {
              h = vh;
-             _items_visibility_fix(sd, &ih, vh, &more);
+             changed = _items_visibility_fix(sd, &ih, vh, &more);
           }
         else
           {
              w = vw;
-             _items_visibility_fix(sd, &iw, vw, &more);
+             changed = _items_visibility_fix(sd, &iw, vw, &more);
           }
         evas_object_geometry_get
           (sd->VIEW(more_item), NULL, NULL, &more_w, &more_h);
@@ -398,12 +469,18 @@ _resize_job(void *data)
              if ((iw - more_w) <= vw) iw -= more_w;
           }
 
+        overflow = ((sd->vertical) && (ih > vh)) ||
+          ((!sd->vertical) && (iw > vw)) || more;
+        /* the box and menu are only redone when other items fit now */
+        relayout = (changed) || (!sd->layout_valid) ||
+          (overflow != sd->overflow);
+
         /* All items are removed from the box object, since removing
          * individual items won't trigger a resize. Items are be
          * readded below. */
-        evas_object_box_remove_all(sd->bx, EINA_FALSE);
-        if (((sd->vertical) && (ih > vh)) ||
-            ((!sd->vertical) && (iw > vw)) || more)
+        if (relayout)
+          evas_object_box_remove_all(sd->bx, EINA_FALSE);
+        if ((relayout) && (overflow))
           {
              Evas_Object *menu;
 
@@ -440,7 +517,7 @@ _resize_job(void *data)
              evas_object_box_append(sd->bx, sd->VIEW(more_item));
              evas_object_show(sd->VIEW(more_item));
           }
-        else
+        else if (relayout)
           {
              /* All items are visible, show them all (except for the
               * "More" button, of course). */
@@ -451,6 +528,8 @@ _resize_job(void *data)
                }
              evas_object_hide(sd->VIEW(more_item));
           }
+        sd->overflow = overflow;
+        sd->layout_valid = EINA_TRUE;
      }
    else if (sd->shrink_mode == ELM_TOOLBAR_SHRINK_HIDE)
      {
@@ -459,16 +538,22 @@ _resize_job(void *data)
         if (sd->vertical)
           {
              h = vh;
-             _items_visibility_fix(sd, &ih, vh, &more);
+             changed = _items_visibility_fix(sd, &ih, vh, &more);
           }
         else
           {
              w = vw;
-             _items_visibility_fix(sd, &iw, vw, &more);
+             changed = _items_visibility_fix(sd, &iw, vw, &more);
           }
-        evas_object_box_remove_all(sd->bx, EINA_FALSE);
-        if (((sd->vertical) && (ih > vh)) ||
-            ((!sd->vertical) && (iw > vw)) || more)
+
+        overflow = ((sd->vertical) && (ih > vh)) ||
+          ((!sd->vertical) && (iw > vw)) || more;
+        relayout = (changed) || (!sd->layout_valid) ||
+          (overflow != sd->overflow);
+
+        if (relayout)
+          evas_object_box_remove_all(sd->bx, EINA_FALSE);
+        if ((relayout) && (overflow))
           {
              EINA_INLIST_FOREACH(sd->items, it)
                {
@@ -481,7 +566,7 @@ _resize_job(void *data)
                     }
                }
           }
-        else
+        else if (relayout)
           {
              /* All items are visible, show them all */
              EINA_INLIST_FOREACH(sd->items, it)
@@ -490,6 +575,8 @@ _resize_job(void *data)
                   evas_object_box_append(sd->bx, VIEW(it));
                }
           }
+        sd->overflow = overflow;
+        sd->layout_valid = EINA_TRUE;
      }
    else if (sd->shrink_mode == ELM_TOOLBAR_SHRINK_EXPAND)
      {
@@ -501,29 +588,35 @@ _resize_job(void *data)
           w = (vw >= mw) ? vw : mw;
 
         if (sd->vertical)
-          _items_visibility_fix(sd, &ih, vh, &more);
+          changed = _items_visibility_fix(sd, &ih, vh, &more);
         else
-          _items_visibility_fix(sd, &iw, vw, &more);
+          changed = _items_visibility_fix(sd, &iw, vw, &more);
 
-        evas_object_box_remove_all(sd->bx, EINA_FALSE);
-        evas_object_box_remove_all(sd->bx_more, EINA_FALSE);
-        evas_object_box_remove_all(sd->bx_more2, EINA_FALSE);
-
-        EINA_INLIST_FOREACH(sd->items, it)
+        /* which box an item goes to doesn't depend on the size */
+        relayout = (changed) || (!sd->layout_valid);
+        if (relayout)
           {
-             if (it->in_box)
+             evas_object_box_remove_all(sd->bx, EINA_FALSE);
+             evas_object_box_remove_all(sd->bx_more, EINA_FALSE);
+             evas_object_box_remove_all(sd->bx_more2, EINA_FALSE);
+
+             EINA_INLIST_FOREACH(sd->items, it)
                {
-                  evas_object_box_append(it->in_box, VIEW(it));
-                  evas_object_show(VIEW(it));
+                  if (it->in_box)
+                    {
+                       evas_object_box_append(it->in_box, VIEW(it));
+                       evas_object_show(VIEW(it));
+                    }
                }
+             if (more)
+               {
+                  evas_object_box_append(sd->bx, sd->VIEW(more_item));
+                  evas_object_show(sd->VIEW(more_item));
+               }
+             else
+               evas_object_hide(sd->VIEW(more_item));
+             sd->layout_valid = EINA_TRUE;
           }
-        if (more)
-          {
-             evas_object_box_append(sd->bx, sd->VIEW(more_item));
-             evas_object_show(sd->VIEW(more_item));
-          }
-        else
-          evas_object_hide(sd->VIEW(more_item));
 
         if (sd->vertical)
           {
@@ -552,6 +645,7 @@ _resize_job(void *data)
                _item_show(it);
              evas_object_show(VIEW(it));
           }
+        relayout = EINA_TRUE;
      }
 
    if (sd->transverse_expanded)
@@ -564,33 +658,36 @@ _resize_job(void *data)
 
    evas_object_resize(sd->bx, w, h);
 
-// Remove the first or last separator since it is not necessary
-   list = evas_object_box_children_get(sd->bx_more);
-   EINA_INLIST_FOREACH(sd->items, it)
+   // Remove the first or last separator since it is not necessary
+   if (relayout)
      {
-        if (it->separator &&
-            ((VIEW(it) == eina_list_data_get(list)) ||
-             (VIEW(it) == eina_list_nth(list, eina_list_count(list) - 1))))
+        list = evas_object_box_children_get(sd->bx_more);
+        EINA_INLIST_FOREACH(sd->items, it)
           {
-             evas_object_box_remove(sd->bx_more, VIEW(it));
-             evas_object_move(VIEW(it), -9999, -9999);
-             evas_object_hide(VIEW(it));
+             if (it->separator &&
+                 ((VIEW(it) == eina_list_data_get(list)) ||
+                  (VIEW(it) == eina_list_nth(list, eina_list_count(list) - 1))))
+               {
+                  evas_object_box_remove(sd->bx_more, VIEW(it));
+                  evas_object_move(VIEW(it), -9999, -9999);
+                  evas_object_hide(VIEW(it));
+               }
           }
-     }
-   eina_list_free(list);
-   list = evas_object_box_children_get(sd->bx_more2);
-   EINA_INLIST_FOREACH(sd->items, it)
-     {
-        if (it->separator &&
-            ((VIEW(it) == eina_list_data_get(list)) ||
-             (VIEW(it) == eina_list_nth(list, eina_list_count(list) - 1))))
+        eina_list_free(list);
+        list = evas_object_box_children_get(sd->bx_more2);
+        EINA_INLIST_FOREACH(sd->items, it)
           {
-             evas_object_box_remove(sd->bx_more2, VIEW(it));
-             evas_object_move(VIEW(it), -9999, -9999);
-             evas_object_hide(VIEW(it));
+             if (it->separator &&
+                 ((VIEW(it) == eina_list_data_get(list)) ||
+                  (VIEW(it) == eina_list_nth(list, eina_list_count(list) - 1))))
+               {
+                  evas_object_box_remove(sd->bx_more2, VIEW(it));
+                  evas_object_move(VIEW(it), -9999, -9999);
+                  evas_object_hide(VIEW(it));
+               }
           }
+        eina_list_free(list);
      }
-   eina_list_free(list);
 
    _mirrored_set(obj, elm_widget_mirrored_get(obj));
 }
@@ -986,6 +1083,9 @@ _resizing_eval_item(Elm_Toolbar_Item_Data *it)
      elm_coords_finger_size_adjust(1, &mw, 1, &mh);
    evas_object_size_hint_min_set(VIEW(it), mw, mh);
    evas_object_size_hint_max_set(VIEW(it), -1, -1);
+   it->minw = mw;
+   it->minh = mh;
+   sd->prio_dirty = EINA_TRUE;
 }
 
 static void
@@ -1011,6 +1111,9 @@ _elm_toolbar_item_elm_widget_item_disable(Eo *eo_toolbar, Elm_Toolbar_Item_Data
    if (toolbar_it->icon)
      elm_widget_signal_emit(toolbar_it->icon, emission, "elm");
 
+   /* the "more" menu mirrors the disabled state */
+   ELM_TOOLBAR_DATA_GET(WIDGET(toolbar_it), sd);
+   sd->prio_dirty = EINA_TRUE;
    _resize_cb(WIDGET(toolbar_it), NULL, NULL, NULL);
 }
 
@@ -1374,8 +1477,11 @@ _inform_item_number(Evas_Object *obj)
 
                   edje_object_size_min_restricted_calc(elm_layout_edje_get(VIEW(it)), &mw, &mh, mw, mh);
                   evas_object_size_hint_min_set(VIEW(it), mw, mh);
+                  it->minw = mw;
+                  it->minh = mh;
                }
           }
+        sd->prio_dirty = EINA_TRUE;
      }
 }
 
@@ -1816,6 +1922,7 @@ _items_change(Elm_Toolbar_Item_Data *reorder_from, Elm_Toolbar_Item_Data *reorde
         tmp = reorder_from->prio.priority;
         reorder_from->prio.priority = reorder_to->prio.priority;
         reorder_to->prio.priority = tmp;
+        sd->prio_dirty = EINA_TRUE;
 
         reorder_from->on_move = EINA_TRUE;
         reorder_to->on_move = EINA_TRUE;
@@ -2302,6 +2409,7 @@ _elm_toolbar_item_eo_base_destructor(Eo *eo_item, Elm_Toolbar_Item_Data *item)
           next = ELM_TOOLBAR_ITEM_FROM_INLIST(EINA_INLIST_GET(item)->next);
         sd->items = eina_inlist_remove(sd->items, EINA_INLIST_GET(item));
         sd->item_count--;
+        sd->prio_dirty = EINA_TRUE;
         if (!sd->delete_me)
           {
              if (!next) next = ELM_TOOLBAR_ITEM_FROM_INLIST(sd->items);
@@ -2830,6 +2938,8 @@ _elm_toolbar_evas_object_smart_del(Eo *obj, Elm_Toolbar_Data *sd)
      }
    if (sd->more_item) elm_wdg_item_del(EO_OBJ(sd->more_item));
    ecore_timer_del(sd->long_timer);
+   ELM_SAFE_FREE(sd->prio_items, free);
+   ELM_SAFE_FREE(sd->prio_extents, free);
 
    evas_obj_smart_del(eo_super(obj, MY_CLASS));
 }
@@ -3153,6 +3263,8 @@ _elm_toolbar_item_priority_set(Eo *eo_item EINA_UNUSED, Elm_Toolbar_Item_Data *i
 {
    if (item->prio.priority == priority) return;
    item->prio.priority = priority;
+   ELM_TOOLBAR_DATA_GET(WIDGET(item), sd);
+   sd->prio_dirty = EINA_TRUE;
    _resizing_eval(WIDGET(item));
 }
 
@@ -3331,6 +3443,7 @@ _elm_toolbar_item_separator_set(Eo *eo_item EINA_UNUSED, Elm_Toolbar_Item_Data *
 
    if (item->separator == separator) return;
    item->separator = separator;
+   sd->prio_dirty = EINA_TRUE;
    scale = (elm_widget_scale_get(obj) * elm_config_scale_get());
    _item_theme_hook(obj, item, scale, sd->icon_size);
    evas_object_size_hint_min_set(VIEW(item), -1, -1);
@@ -3354,6 +3467,7 @@ _elm_toolbar_shrink_mode_set(Eo *obj, Elm_Toolbar_Data *sd, Elm_Toolbar_Shrink_M
 
    if (sd->shrink_mode == shrink_mode) return;
    sd->shrink_mode = shrink_mode;
+   sd->prio_dirty = EINA_TRUE;
    bounce = (_elm_config->thumbscroll_bounce_enable) &&
      (shrink_mode == ELM_TOOLBAR_SHRINK_SCROLL);
    elm_interface_scrollable_bounce_allow_set(obj, bounce, EINA_FALSE);
@@ -3429,6 +3543,7 @@ _elm_toolbar_homogeneous_set(Eo *obj, Elm_Toolbar_Data *sd, Eina_Bool homogeneou
    homogeneous = !!homogeneous;
    if (homogeneous == sd->homogeneous) return;
    sd->homogeneous = homogeneous;
+   sd->prio_dirty = EINA_TRUE;
    if (homogeneous) elm_toolbar_shrink_mode_set(obj, ELM_TOOLBAR_SHRINK_NONE);
    evas_object_smart_calculate(sd->bx);
 }
@@ -3721,6 +3836,7 @@ _elm_toolbar_horizontal_set(Eo *obj, Elm_Toolbar_Data *sd, Eina_Bool horizontal)
    horizontal = !!horizontal;
    if (horizontal != sd->vertical) return;
    sd->vertical = !horizontal;
+   sd->prio_dirty = EINA_TRUE;
    if (sd->vertical)
      evas_object_box_align_set(sd->bx, 0.5, sd->align);
    else
@@ -3746,6 +3862,7 @@ _elm_toolbar_standard_priority_set(Eo *obj, Elm_Toolbar_Data *sd, int priority)
 {
    if (sd->standard_priority == priority) return;
    sd->standard_priority = priority;
+   sd->prio_dirty = EINA_TRUE;
    _resizing_eval(obj);
 }
 
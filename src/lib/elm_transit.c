@@ -29,7 +29,7 @@ struct _Elm_Transit
 #define ELM_TRANSIT_MAGIC 0xd27f190a
    EINA_MAGIC;
 
-   Ecore_Animator *animator;
+   Eina_List *scheduler_node; /**< Node on the scheduler's list while running */
    Ecore_Timer *go_in_timer; /**< Timer used by elm_transit_go_in() */
    Eina_Inlist *effect_list;
    Eina_List *objs;
@@ -109,6 +109,100 @@ static Eina_Bool _transit_animate_cb(void *data);
 
 static char *_transit_key= "_elm_transit_key";
 
+/* All the running transits are driven from a single animator, so
+ * screens with hundreds of them pay for one animator dispatch per
+ * frame instead of one per transit. */
+static struct
+{
+   Ecore_Animator *animator;
+   Eina_List *transits;
+   int walking;
+   Eina_Bool pending_del : 1;
+} _transit_scheduler = { NULL, NULL, 0, EINA_FALSE };
+
+static Eina_Bool
+_transit_scheduler_tick(void *data EINA_UNUSED)
+{
+   Eina_List *l, *l_next, *last;
+   Elm_Transit *transit;
+
+   /* transits started from this tick are run by elm_transit_go()
+    * already, stop at the ones running before it */
+   last = eina_list_last(_transit_scheduler.transits);
+
+   _transit_scheduler.walking++;
+   EINA_LIST_FOREACH(_transit_scheduler.transits, l, transit)
+     {
+        if (transit && !transit->time.paused)
+          _transit_animate_cb(transit);
+        if (l == last) break;
+     }
+   _transit_scheduler.walking--;
+
+   if (!_transit_scheduler.walking && _transit_scheduler.pending_del)
+     {
+        _transit_scheduler.pending_del = EINA_FALSE;
+        EINA_LIST_FOREACH_SAFE(_transit_scheduler.transits, l, l_next, transit)
+          if (!transit)
+            _transit_scheduler.transits =
+               eina_list_remove_list(_transit_scheduler.transits, l);
+     }
+
+   if (_transit_scheduler.transits) return ECORE_CALLBACK_RENEW;
+
+   _transit_scheduler.animator = NULL;
+   return ECORE_CALLBACK_CANCEL;
+}
+
+static void
+_transit_scheduler_add(Elm_Transit *transit)
+{
+   if (transit->scheduler_node) return;
+
+   _transit_scheduler.transits =
+      eina_list_append(_transit_scheduler.transits, transit);
+   transit->scheduler_node = eina_list_last(_transit_scheduler.transits);
+
+   if (!_transit_scheduler.animator)
+     _transit_scheduler.animator =
+        ecore_animator_add(_transit_scheduler_tick, NULL);
+}
+
+static void
+_transit_scheduler_del(Elm_Transit *transit)
+{
+   if (!transit->scheduler_node) return;
+
+   if (_transit_scheduler.walking)
+     {
+        eina_list_data_set(transit->scheduler_node, NULL);
+        _transit_scheduler.pending_del = EINA_TRUE;
+     }
+   else
+     _transit_scheduler.transits =
+        eina_list_remove_list(_transit_scheduler.transits,
+                              transit->scheduler_node);
+   transit->scheduler_node = NULL;
+
+   if (!_transit_scheduler.transits)
+     ELM_SAFE_FREE(_transit_scheduler.animator, ecore_animator_del);
+}
+
+/* Effects keep their map across ticks, evas_object_map_set() takes a
+ * copy of it anyway. */
+static Evas_Map *
+_transit_effect_map_get(Evas_Map **map)
+{
+   if (!*map)
+     {
+        *map = evas_map_new(4);
+        if (!*map) return NULL;
+        evas_map_util_object_move_sync_set(*map, EINA_TRUE);
+     }
+
+   return *map;
+}
+
 static void
 _transit_obj_data_save(Evas_Object *obj)
 {
@@ -259,7 +353,7 @@ _transit_del(Elm_Transit *transit)
 
    transit->deleted = EINA_TRUE;
 
-   ELM_SAFE_FREE(transit->animator, ecore_animator_del);
+   _transit_scheduler_del(transit);
 
    //remove effects
    while (transit->effect_list)
@@ -607,7 +701,7 @@ elm_transit_object_add(Elm_Transit *transit, Evas_Object *obj)
    ELM_TRANSIT_CHECK_OR_RETURN(transit);
    EINA_SAFETY_ON_NULL_RETURN(obj);
 
-   if (transit->animator)
+   if (transit->scheduler_node)
      {
         if (!evas_object_data_get(obj, _transit_key))
           {
@@ -664,7 +758,7 @@ elm_transit_event_enabled_set(Elm_Transit *transit, Eina_Bool enabled)
 
    if (transit->event_enabled == enabled) return;
    transit->event_enabled = !!enabled;
-   if (!transit->animator) return;
+   if (!transit->scheduler_node) return;
 
    EINA_LIST_FOREACH(transit->objs, list, obj)
      evas_object_freeze_events_set(obj, enabled);
@@ -758,7 +852,7 @@ EAPI void
 elm_transit_duration_set(Elm_Transit *transit, double duration)
 {
    ELM_TRANSIT_CHECK_OR_RETURN(transit);
-   if (transit->animator)
+   if (transit->scheduler_node)
      {
         WRN("elm_transit does not allow to set the duration time in operating! : transit=%p", transit);
         return;
@@ -778,7 +872,7 @@ elm_transit_revert(Elm_Transit *transit)
 {
    ELM_TRANSIT_CHECK_OR_RETURN(transit, EINA_FALSE);
 
-   if (!transit->animator) return EINA_FALSE;
+   if (!transit->scheduler_node) return EINA_FALSE;
 
    if (transit->revert_mode)
      {
@@ -805,8 +899,6 @@ elm_transit_go(Elm_Transit *transit)
    Eina_List *elist;
    Evas_Object *obj;
 
-   ELM_SAFE_FREE(transit->animator, ecore_animator_del);
-
    EINA_LIST_FOREACH(transit->objs, elist, obj)
      _transit_obj_data_save(obj);
 
@@ -821,7 +913,7 @@ elm_transit_go(Elm_Transit *transit)
    transit->total_revert_time = 0;
    transit->revert_mode = EINA_FALSE;
    transit->time.begin = ecore_loop_time_get();
-   transit->animator = ecore_animator_add(_transit_animate_cb, transit);
+   _transit_scheduler_add(transit);
 
    _transit_animate_cb(transit);
 }
@@ -840,20 +932,18 @@ elm_transit_paused_set(Elm_Transit *transit, Eina_Bool paused)
 {
    ELM_TRANSIT_CHECK_OR_RETURN(transit);
 
-   if (!transit->animator) return;
+   if (!transit->scheduler_node) return;
 
    if (paused)
      {
         if (transit->time.paused > 0)
           return;
-        ecore_animator_freeze(transit->animator);
         transit->time.paused = ecore_loop_time_get();
      }
    else
      {
         if (transit->time.paused == 0)
           return;
-        ecore_animator_thaw(transit->animator);
         transit->time.delayed += (ecore_loop_time_get() - transit->time.paused);
         transit->time.paused = 0;
      }
@@ -884,7 +974,7 @@ elm_transit_objects_final_state_keep_set(Elm_Transit *transit, Eina_Bool state_k
    ELM_TRANSIT_CHECK_OR_RETURN(transit);
 
    if (transit->state_keep == state_keep) return;
-   if (transit->animator)
+   if (transit->scheduler_node)
      {
         WRN("elm_transit does not allow to change final state keep mode in operating! : transit=%p", transit);
         return;
@@ -1158,12 +1248,14 @@ typedef struct _Elm_Transit_Effect_Zoom Elm_Transit_Effect_Zoom;
 struct _Elm_Transit_Effect_Zoom
 {
    float from, to;
+   Evas_Map *map;
 };
 
 static void
 _transit_effect_zoom_context_free(Elm_Transit_Effect *effect, Elm_Transit *transit EINA_UNUSED)
 {
    Elm_Transit_Effect_Zoom *zoom = effect;
+   if (zoom->map) evas_map_free(zoom->map);
    free(zoom);
 }
 
@@ -1189,23 +1281,23 @@ _transit_effect_zoom_op(Elm_Transit_Effect *effect, Elm_Transit *transit , doubl
              if (!base_map) return;
              map = evas_map_dup(base_map);
              if (!map) return;
+             evas_map_util_object_move_sync_set(map, EINA_TRUE);
           }
         else
           {
-             map = evas_map_new(4);
+             map = _transit_effect_map_get(&zoom->map);
              if (!map) return;
              evas_map_util_points_populate_from_object_full(map, obj, 0);
           }
-        evas_map_util_object_move_sync_set(map, EINA_TRUE);
 
         evas_object_geometry_get(obj, &x, &y, &w, &h);
         _recover_image_uv(obj, map, EINA_FALSE, EINA_FALSE);
         evas_map_util_zoom(map, zoom_rate, zoom_rate, x + (w / 2), y + (h / 2));
-        if (!transit->smooth) evas_map_smooth_set(map, EINA_FALSE);
+        evas_map_smooth_set(map, transit->smooth);
         evas_object_map_set(obj, map);
         evas_object_map_enable_set(obj, EINA_TRUE);
 
-        evas_map_free(map);
+        if (map != zoom->map) evas_map_free(map);
      }
 }
 
@@ -1248,6 +1340,7 @@ typedef struct _Elm_Transit_Effect_Flip Elm_Transit_Effect_Flip;
 struct _Elm_Transit_Effect_Flip
 {
    Elm_Transit_Effect_Flip_Axis axis;
+   Evas_Map *map;
    Eina_Bool cw : 1;
 };
 
@@ -1268,6 +1361,7 @@ _transit_effect_flip_context_free(Elm_Transit_Effect *effect, Elm_Transit *trans
         evas_object_map_enable_set(front, EINA_FALSE);
         evas_object_map_enable_set(back, EINA_FALSE);
      }
+   if (flip->map) evas_map_free(flip->map);
    free(flip);
 }
 
@@ -1283,11 +1377,9 @@ _transit_effect_flip_op(Elm_Transit_Effect *effect, Elm_Transit *transit, double
    float degree;
    Evas_Coord x, y, w, h;
 
-   map = evas_map_new(4);
+   map = _transit_effect_map_get(&flip->map);
    if (!map) return;
 
-   evas_map_util_object_move_sync_set(map, EINA_TRUE);
-
    if (flip->cw) degree = (float)(progress * 180);
    else degree = (float)(progress * -180);
 
@@ -1361,10 +1453,9 @@ _transit_effect_flip_op(Elm_Transit_Effect *effect, Elm_Transit *transit, double
         evas_map_util_3d_perspective(map, x + half_w, y + half_h, 0, _TRANSIT_FOCAL);
         evas_object_map_enable_set(front, EINA_TRUE);
         evas_object_map_enable_set(back, EINA_TRUE);
-        if (!transit->smooth) evas_map_smooth_set(map, EINA_FALSE);
+        evas_map_smooth_set(map, transit->smooth);
         evas_object_map_set(obj, map);
      }
-   evas_map_free(map);
 }
 
 static Elm_Transit_Effect *
@@ -1416,6 +1507,7 @@ struct _Elm_Transit_Effect_Resizable_Flip_Node
 struct _Elm_Transit_Effect_Resizable_Flip
 {
    Eina_List *nodes;
+   Evas_Map *map;
    Eina_Bool cw : 1;
    Elm_Transit_Effect_Flip_Axis axis;
 };
@@ -1566,6 +1658,7 @@ _transit_effect_resizable_flip_context_free(Elm_Transit_Effect *effect, Elm_Tran
                                        EVAS_CALLBACK_DEL, _resizable_flip_object_del_cb);
         free(resizable_flip_node);
      }
+   if (resizable_flip->map) evas_map_free(resizable_flip->map);
    free(resizable_flip);
 }
 
@@ -1582,11 +1675,9 @@ _transit_effect_resizable_flip_op(Elm_Transit_Effect *effect, Elm_Transit *trans
    Elm_Transit_Effect_ResizableFlip_Node *resizable_flip_node;
    Eina_List *elist;
 
-   map = evas_map_new(4);
+   map = _transit_effect_map_get(&resizable_flip->map);
    if (!map) return;
 
-   evas_map_util_object_move_sync_set(map, EINA_TRUE);
-
    if (resizable_flip->cw) degree = (float)(progress * 180);
    else degree = (float)(progress * -180);
 
@@ -1670,10 +1761,9 @@ _transit_effect_resizable_flip_op(Elm_Transit_Effect *effect, Elm_Transit *trans
                                      _TRANSIT_FOCAL);
         evas_object_map_enable_set(resizable_flip_node->front, EINA_TRUE);
         evas_object_map_enable_set(resizable_flip_node->back, EINA_TRUE);
-        if (!transit->smooth) evas_map_smooth_set(map, EINA_FALSE);
+        evas_map_smooth_set(map, transit->smooth);
         evas_object_map_set(obj, map);
      }
-   evas_map_free(map);
 }
 
 static Elm_Transit_Effect *
@@ -1716,6 +1806,7 @@ struct _Elm_Transit_Effect_Wipe
 {
    Elm_Transit_Effect_Wipe_Type type;
    Elm_Transit_Effect_Wipe_Dir dir;
+   Evas_Map *map;
 };
 
 static void
@@ -1859,6 +1950,7 @@ _transit_effect_wipe_context_free(Elm_Transit_Effect *effect, Elm_Transit *trans
         evas_object_map_enable_set(obj, EINA_FALSE);
      }
 
+   if (wipe->map) evas_map_free(wipe->map);
    free(wipe);
 }
 
@@ -1874,11 +1966,9 @@ _transit_effect_wipe_op(Elm_Transit_Effect *effect, Elm_Transit *transit, double
    Evas_Object *obj;
    const char *type;
 
-   map = evas_map_new(4);
+   map = _transit_effect_map_get(&wipe->map);
    if (!map) return;
 
-   evas_map_util_object_move_sync_set(map, EINA_TRUE);
-
    EINA_LIST_FOREACH(transit->objs, elist, obj)
      {
         type = evas_object_type_get(obj);
@@ -1895,11 +1985,10 @@ _transit_effect_wipe_op(Elm_Transit_Effect *effect, Elm_Transit *transit, double
           _elm_fx_wipe_show(map, wipe->dir, _x, _y, _w, _h, (float)progress);
         else
           _elm_fx_wipe_hide(map, wipe->dir, _x, _y, _w, _h, (float)progress);
-        if (!transit->smooth) evas_map_smooth_set(map, EINA_FALSE);
+        evas_map_smooth_set(map, transit->smooth);
         evas_object_map_enable_set(obj, EINA_TRUE);
         evas_object_map_set(obj, map);
      }
-   evas_map_free(map);
 }
 
 static Elm_Transit_Effect *
@@ -2379,12 +2468,14 @@ typedef struct _Elm_Transit_Effect_Rotation Elm_Transit_Effect_Rotation;
 struct _Elm_Transit_Effect_Rotation
 {
    float from, to;
+   Evas_Map *map;
 };
 
 static void
 _transit_effect_rotation_context_free(Elm_Transit_Effect *effect, Elm_Transit *transit EINA_UNUSED)
 {
    Elm_Transit_Effect_Rotation *rotation = effect;
+   if (rotation->map) evas_map_free(rotation->map);
    free(rotation);
 }
 
@@ -2411,14 +2502,14 @@ _transit_effect_rotation_op(Elm_Transit_Effect *effect, Elm_Transit *transit, do
              if (!base_map) return;
              map = evas_map_dup(base_map);
              if (!map) return;
+             evas_map_util_object_move_sync_set(map, EINA_TRUE);
           }
         else
           {
-             map = evas_map_new(4);
+             map = _transit_effect_map_get(&rotation->map);
              if (!map) return;
              evas_map_util_points_populate_from_object_full(map, obj, 0);
           }
-        evas_map_util_object_move_sync_set(map, EINA_TRUE);
 
         degree = rotation->from + (float)(progress * rotation->to);
 
@@ -2428,11 +2519,11 @@ _transit_effect_rotation_op(Elm_Transit_Effect *effect, Elm_Transit *transit, do
         half_h = (float)h * 0.5;
 
         evas_map_util_rotate(map, degree, x + half_w, y + half_h);
-        if (!transit->smooth) evas_map_smooth_set(map, EINA_FALSE);
+        evas_map_smooth_set(map, transit->smooth);
         evas_object_map_enable_set(obj, EINA_TRUE);
         evas_object_map_set(obj, map);
 
-        evas_map_free(map);
+        if (map != rotation->map) evas_map_free(map);
      }
 }
 
@@ -64,6 +64,19 @@ struct _Elm_Translate_String_Data
 /* local subsystem globals */
 static unsigned int focus_order = 0;
 
+/* directional focus query in progress, see _focus_grid_query_begin() */
+static struct
+{
+   const Evas_Object *win;
+   const Evas_Object *base;
+   double             degree;
+   double             limit;
+   unsigned int       stamp;
+} focus_grid_query = { NULL, NULL, 0.0, 0.0, 0 };
+
+static Eina_Bool _focus_grid_query_begin(const Evas_Object *obj, const Evas_Object *base, double degree, Eina_Bool full);
+static Eina_Bool _focus_grid_query_end(double weight);
+
 static inline Eina_Bool
 _elm_widget_is(const Evas_Object *obj)
 {
@@ -463,10 +476,29 @@ _elm_widget_evas_object_smart_del(Eo *obj, Elm_Widget_Smart_Data *sd)
    if (sd->theme) elm_theme_free(sd->theme);
    _if_focused_revert(obj, EINA_TRUE);
    elm_widget_focus_custom_chain_unset(obj);
+   if (sd->focus_grid.win)
+     _elm_win_focus_grid_object_del(sd->focus_grid.win, obj);
    eina_stringshare_del(sd->access_info);
    evas_object_smart_data_set(obj, NULL);
 }
 
+/* keep the window's directional focus index in sync with focusable
+ * widgets' geometry, moving them to their new window's index when
+ * they got reparented */
+static void
+_focus_grid_update(Evas_Object *obj, Elm_Widget_Smart_Data *sd)
+{
+   Evas_Object *top;
+
+   if (!sd->can_focus) return;
+
+   top = elm_widget_top_get(obj);
+   if (sd->focus_grid.win && (sd->focus_grid.win != top))
+     _elm_win_focus_grid_object_del(sd->focus_grid.win, obj);
+   if (!top || (top == obj) || !eo_isa(top, ELM_WIN_CLASS)) return;
+   _elm_win_focus_grid_object_dirty(top, obj);
+}
+
 static void
 _smart_reconfigure(Elm_Widget_Smart_Data *sd)
 {
@@ -483,21 +515,23 @@ _smart_reconfigure(Elm_Widget_Smart_Data *sd)
 }
 
 EOLIAN static void
-_elm_widget_evas_object_smart_move(Eo *obj EINA_UNUSED, Elm_Widget_Smart_Data *sd, Evas_Coord x, Evas_Coord y)
+_elm_widget_evas_object_smart_move(Eo *obj, Elm_Widget_Smart_Data *sd, Evas_Coord x, Evas_Coord y)
 {
    sd->x = x;
    sd->y = y;
 
    _smart_reconfigure(sd);
+   _focus_grid_update(obj, sd);
 }
 
 EOLIAN static void
-_elm_widget_evas_object_smart_resize(Eo *obj EINA_UNUSED, Elm_Widget_Smart_Data *sd, Evas_Coord w, Evas_Coord h)
+_elm_widget_evas_object_smart_resize(Eo *obj, Elm_Widget_Smart_Data *sd, Evas_Coord w, Evas_Coord h)
 {
    sd->w = w;
    sd->h = h;
 
    _smart_reconfigure(sd);
+   _focus_grid_update(obj, sd);
 }
 
 EOLIAN static void
@@ -1372,14 +1406,17 @@ _elm_widget_can_focus_set(Eo *obj, Elm_Widget_Smart_Data *sd, Eina_Bool can_focu
 
         for (;;)
           {
+             Elm_Widget_Smart_Data *sdp;
+
              o = elm_widget_parent_get(o);
              if (!o) break;
-             sd = eo_data_scope_get(o, MY_CLASS);
-             if (!sd || sd->child_can_focus) break;
-             sd->child_can_focus = EINA_TRUE;
+             sdp = eo_data_scope_get(o, MY_CLASS);
+             if (!sdp || sdp->child_can_focus) break;
+             sdp->child_can_focus = EINA_TRUE;
           }
 
         eo_event_callback_array_add(obj, focus_callbacks(), NULL);
+        _focus_grid_update(obj, sd);
      }
    else
      {
@@ -1903,14 +1940,29 @@ _elm_widget_focus_direction_go(Eo *obj, Elm_Widget_Smart_Data *_pd EINA_UNUSED,
    Elm_Object_Item *target_item = NULL;
    Evas_Object *current_focused = NULL;
    double weight = 0.0;
+   Eina_Bool query, found;
 
    if (!_elm_widget_is(obj)) return EINA_FALSE;
    if (!elm_widget_focus_get(obj)) return EINA_FALSE;
 
    current_focused = elm_widget_focused_object_get(obj);
 
-   if (elm_widget_focus_direction_get
-         (obj, current_focused, degree, &target, &target_item, &weight))
+   query = _focus_grid_query_begin(obj, current_focused, degree, EINA_FALSE);
+   found = elm_widget_focus_direction_get
+         (obj, current_focused, degree, &target, &target_item, &weight);
+   if (query && !_focus_grid_query_end(weight))
+     {
+        /* the grid's best guess was not picked, look at everything */
+        target = NULL;
+        target_item = NULL;
+        weight = 0.0;
+        query = _focus_grid_query_begin(obj, current_focused, degree, EINA_TRUE);
+        found = elm_widget_focus_direction_get
+              (obj, current_focused, degree, &target, &target_item, &weight);
+        if (query) _focus_grid_query_end(weight);
+     }
+
+   if (found)
      {
         elm_widget_focus_steal(target, NULL);
         return EINA_TRUE;
@@ -1919,6 +1971,68 @@ _elm_widget_focus_direction_go(Eo *obj, Elm_Widget_Smart_Data *_pd EINA_UNUSED,
    return EINA_FALSE;
 }
 
+/* Let the top window mark which of its indexed widgets lie in the
+ * requested direction, near enough to matter unless @p full is set,
+ * so the weight of the others is never computed while walking the
+ * tree. Returns EINA_TRUE if the caller started the query and has to
+ * end it. */
+static Eina_Bool
+_focus_grid_query_begin(const Evas_Object *obj,
+                        const Evas_Object *base,
+                        double degree,
+                        Eina_Bool full)
+{
+   Evas_Object *top;
+   unsigned int stamp;
+   double limit = 0.0;
+
+   if (focus_grid_query.stamp) return EINA_FALSE;
+
+   top = elm_widget_top_get(obj);
+   if (!top || !eo_isa(top, ELM_WIN_CLASS)) return EINA_FALSE;
+
+   stamp = _elm_win_focus_grid_query(top, base, degree, full ? NULL : &limit);
+   if (!stamp) return EINA_FALSE;
+
+   focus_grid_query.win = top;
+   focus_grid_query.base = base;
+   focus_grid_query.degree = degree;
+   focus_grid_query.limit = limit;
+   focus_grid_query.stamp = stamp;
+
+   return EINA_TRUE;
+}
+
+/* Ends the current query, @p weight being the one of the widget the
+ * walk settled on. Returns EINA_FALSE if a widget left out by the
+ * query could still outweigh it, in which case the walk has to be
+ * done again with a full query. */
+static Eina_Bool
+_focus_grid_query_end(double weight)
+{
+   double limit = focus_grid_query.limit;
+
+   memset(&focus_grid_query, 0, sizeof(focus_grid_query));
+
+   if ((limit <= 0.0) || (weight == -1.0)) return EINA_TRUE;
+   return (int)(weight * 1000000) > (int)(limit * 1000000);
+}
+
+/* Whether a focusable leaf can be skipped by the current query.
+ * Widgets not indexed by the query's window are always evaluated. */
+static inline Eina_Bool
+_focus_grid_query_skip(const Elm_Widget_Smart_Data *sd,
+                       const Evas_Object *base,
+                       double degree)
+{
+   return (focus_grid_query.stamp) &&
+     (sd->focus_grid.indexed) && (!sd->focus_grid.dirty_node) &&
+     (sd->focus_grid.win == focus_grid_query.win) &&
+     (base == focus_grid_query.base) &&
+     (degree == focus_grid_query.degree) &&
+     (sd->focus_grid.stamp != focus_grid_query.stamp);
+}
+
 double
 _elm_widget_focus_direction_weight_get(const Evas_Object *obj1,
                       const Evas_Object *obj2,
@@ -2287,6 +2401,10 @@ _elm_widget_focus_direction_get(const Eo *obj, Elm_Widget_Smart_Data *sd, const
    if (!elm_widget_can_focus_get(obj) || elm_widget_focus_get(obj))
      return EINA_FALSE;
 
+   /* Not in the requested half-plane, don't bother weighting it */
+   if (_focus_grid_query_skip(sd, base, degree))
+     return EINA_FALSE;
+
    c_weight = _elm_widget_focus_direction_weight_get(base, obj, degree);
    if ((c_weight == -1.0) ||
        ((c_weight != 0.0) && (*weight != -1.0) &&
@@ -2335,19 +2453,34 @@ _elm_widget_focus_direction_get(const Eo *obj, Elm_Widget_Smart_Data *sd, const
  * @ingroup Widget
  */
 EOLIAN static Eina_Bool
-_elm_widget_focus_list_direction_get(const Eo *obj EINA_UNUSED, Elm_Widget_Smart_Data *_pd EINA_UNUSED, const Evas_Object *base, const Eina_List *items, list_data_get_func_type list_data_get, double degree, Evas_Object **direction, Elm_Object_Item **direction_item, double *weight)
+_elm_widget_focus_list_direction_get(const Eo *obj, Elm_Widget_Smart_Data *_pd EINA_UNUSED, const Evas_Object *base, const Eina_List *items, list_data_get_func_type list_data_get, double degree, Evas_Object **direction, Elm_Object_Item **direction_item, double *weight)
 {
    if (!direction || !weight || !base || !items)
      return EINA_FALSE;
 
    const Eina_List *l = items;
    Evas_Object *current_best = *direction;
+   Elm_Object_Item *current_best_item = direction_item ? *direction_item : NULL;
+   double current_weight = *weight;
+   Eina_Bool query = _focus_grid_query_begin(obj, base, degree, EINA_FALSE);
+   Eina_Bool full = EINA_FALSE;
 
-   for (; l; l = eina_list_next(l))
+   for (;;)
      {
-        Evas_Object *cur = list_data_get(l);
-        if (cur && _elm_widget_is(cur))
-          elm_widget_focus_direction_get(cur, base, degree, direction, direction_item, weight);
+        for (l = items; l; l = eina_list_next(l))
+          {
+             Evas_Object *cur = list_data_get(l);
+             if (cur && _elm_widget_is(cur))
+               elm_widget_focus_direction_get(cur, base, degree, direction, direction_item, weight);
+          }
+        if (!query || _focus_grid_query_end(*weight) || full) break;
+
+        /* the grid's best guess was not picked, look at everything */
+        *direction = current_best;
+        if (direction_item) *direction_item = current_best_item;
+        *weight = current_weight;
+        full = EINA_TRUE;
+        query = _focus_grid_query_begin(obj, base, degree, EINA_TRUE);
      }
    if (current_best != *direction) return EINA_TRUE;
 
@@ -5749,6 +5882,8 @@ _elm_widget_eo_base_constructor(Eo *obj, Elm_Widget_Smart_Data *sd EINA_UNUSED)
    elm_obj_widget_parent_set(obj, parent);
    sd->on_create = EINA_FALSE;
 
+   _elm_quicklaunch_profile_add("class", eo_class_name_get(eo_class_get(obj)));
+
    elm_interface_atspi_accessible_role_set(obj, ELM_ATSPI_ROLE_UNKNOWN);
    return obj;
 }
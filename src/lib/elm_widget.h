@@ -428,6 +428,20 @@ typedef struct _Elm_Widget_Smart_Data
                                                  Evas_Object *obj);
 
    int                           orient_mode; /* -1 is disabled */
+
+   /* spatial index bookkeeping, used by the window to narrow down
+    * directional focus queries to the candidates lying in the
+    * requested half-plane */
+   struct
+   {
+      Evas_Object               *win; /**< window whose focus grid indexes this widget */
+      Eina_List                 *node; /**< node on the window's indexed widgets list */
+      Eina_List                 *dirty_node; /**< node on the window's dirty widgets list */
+      Eina_Rectangle             geom; /**< geometry this widget is currently indexed with */
+      unsigned int               stamp; /**< serial of the last directional query this widget was a candidate of */
+      Eina_Bool                  indexed : 1;
+   } focus_grid;
+
    Elm_Focus_Move_Policy         focus_move_policy;
    Elm_Focus_Region_Show_Mode    focus_region_show_mode;
 
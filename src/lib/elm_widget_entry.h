@@ -26,6 +26,7 @@ typedef struct _Mod_Api                     Mod_Api;
 /**
  * Base widget smart data extended with entry instance data.
  */
+typedef struct _Elm_Entry_Doc         Elm_Entry_Doc;
 typedef struct _Elm_Entry_Data        Elm_Entry_Data;
 struct _Elm_Entry_Data
 {
@@ -37,7 +38,6 @@ struct _Elm_Entry_Data
    Evas_Object                          *mgf_proxy;
    Evas_Object                          *start_handler;
    Evas_Object                          *end_handler;
-   Ecore_Job                            *deferred_recalc_job;
    Ecore_Timer                          *longpress_timer;
    Ecore_Timer                          *delay_write;
    /* for deferred appending */
@@ -45,12 +45,40 @@ struct _Elm_Entry_Data
    char                                 *append_text_left;
    int                                   append_text_position;
    int                                   append_text_len;
+   /* text kept aside in windowed mode */
+   Elm_Entry_Doc                        *doc;
+   /* image path of a paste, until its last chunk */
+   Eina_Strbuf                          *paste_image;
+   /* streamed text paste: where its next chunk goes, until the last
+    * one, and its user inserts, told as one once their signals came */
+   struct {
+      Evas_Textblock_Cursor             *cur;
+      Eina_List                         *queued; /* contents of chunk inserts whose signal is to come */
+      Eina_Strbuf                       *content;
+      int                                pos, plain_length;
+      Eina_Bool                          ended : 1; /* last chunk in */
+   } paste;
    /* Only for clipboard */
    const char                           *cut_sel;
    const char                           *text;
    const char                           *file;
    Elm_Text_Format                       format;
    Evas_Coord                            last_w, ent_mw, ent_mh;
+   /* min size of the scroller chrome, valid until a non-text change */
+   Evas_Coord                            scr_mw, scr_mh;
+   /* restricted calcs done on entry_edje, for profiling */
+   struct {
+      unsigned int                       count, win_count;
+      double                             win_start, rate;
+   } recalc;
+   /* length of the text for the limit size filters, kept up to date
+    * as inserts get through the filters and from the user deletions,
+    * measured again after any other change */
+   struct {
+      int                                chars, bytes;
+      int                                pending; /* changes waiting for their user part */
+      Eina_Bool                          valid : 1;
+   } len;
    Evas_Coord                            downx, downy;
    Evas_Coord                            ox, oy;
    Eina_List                            *items; /** context menu item list */
@@ -94,7 +122,6 @@ struct _Elm_Entry_Data
    Eina_Bool                             selection_asked : 1;
    Eina_Bool                             auto_return_key : 1;
    Eina_Bool                             have_selection : 1;
-   Eina_Bool                             deferred_cur : 1;
    Eina_Bool                             context_menu : 1;
    Eina_Bool                             long_pressed : 1;
    Eina_Bool                             cur_changed : 1;
@@ -110,6 +137,8 @@ struct _Elm_Entry_Data
    Eina_Bool                             use_down : 1;
    Eina_Bool                             sel_mode : 1;
    Eina_Bool                             changed : 1;
+   Eina_Bool                             needs_size_calc : 1;
+   Eina_Bool                             scr_min_valid : 1;
    Eina_Bool                             scroll : 1;
    Eina_Bool                             input_panel_show_on_demand : 1;
 };
@@ -134,11 +163,78 @@ struct _Elm_Entry_Item_Provider
    void        *data;
 };
 
+typedef enum _Elm_Entry_Filter_Kind
+{
+   ELM_ENTRY_FILTER_USER,
+   ELM_ENTRY_FILTER_LIMIT_SIZE,
+   ELM_ENTRY_FILTER_ACCEPT_SET,
+   ELM_ENTRY_FILTER_NEW_LINE
+} Elm_Entry_Filter_Kind;
+
+/* Consecutive built-in filters are not called one by one but applied
+ * together in a single scan of the inserted markup. An accept set is
+ * compiled at creation into a bitmap of its ascii members and an array
+ * of the others. */
 struct _Elm_Entry_Markup_Filter
 {
-   Elm_Entry_Filter_Cb func;
-   void               *data;
-   void               *orig_data;
+   Elm_Entry_Filter_Cb   func;
+   void                 *data;
+   void                 *orig_data;
+   Elm_Entry_Filter_Kind kind;
+   unsigned char         ascii[16];
+   Eina_Unicode         *set;
+   unsigned int          set_len;
+   Eina_Bool             goes_in : 1;
+};
+
+typedef struct _Elm_Entry_Doc_Piece         Elm_Entry_Doc_Piece;
+typedef struct _Elm_Entry_Doc_Para          Elm_Entry_Doc_Para;
+
+/* In windowed mode the text is kept as a piece table over the text that
+ * was set and an append buffer, split into paragraphs at line and
+ * paragraph breaks. Only the paragraphs around the viewport are given
+ * to the textblock, the others are replaced by spacers of their
+ * (measured or estimated) height. */
+struct _Elm_Entry_Doc_Piece
+{
+   size_t     start; /* offset in the document */
+   size_t     off, len; /* span of the buffer */
+   Eina_Bool  add : 1; /* in the append buffer, else in the original */
+};
+
+struct _Elm_Entry_Doc_Para
+{
+   size_t     start, len; /* offset in the document, break included */
+   Evas_Coord h;
+   Eina_Bool  measured : 1;
+   Eina_Bool  closed : 1; /* ends with a break */
+};
+
+struct _Elm_Entry_Doc
+{
+   char          *orig;
+   size_t         orig_len;
+   Eina_Strbuf   *add;
+   Eina_Inarray  *pieces;
+   Eina_Inarray  *paras;
+   Eina_Inarray  *blocks; /* height sums of ELM_ENTRY_DOC_BLOCK paragraphs */
+   Evas_Coord     total_h;
+   size_t         tag_at; /* unfinished tag ending the text, -1 if none */
+
+   unsigned int   first, last; /* paragraphs in the textblock */
+   Evas_Coord     win_y, win_h; /* and where they are */
+   Evas_Coord     top_pad; /* what the top spacer line adds to its item */
+   Evas_Coord     last_vw;
+
+   /* for the estimates, learned from the measured paragraphs */
+   double         line_h, bytes_per_line;
+   unsigned long  stat_lines, stat_bytes;
+   double         stat_h;
+
+   Ecore_Job     *job;
+   Eina_Bool      laid : 1;
+   Eina_Bool      updating : 1;
+   Eina_Bool      follow : 1; /* stay at the end when text is appended */
 };
 
 typedef enum _Length_Unit
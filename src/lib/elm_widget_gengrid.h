@@ -91,6 +91,19 @@ struct _Elm_Gengrid_Data
       Eina_Bool                             running : 1; /**< animation is happening */
    } reorder;
 
+   /* Drag to reorder on a grid without groups: the cells an item moves
+    * across are worked out from the pointer, instead of laying out all
+    * items on each move */
+   struct
+   {
+      Eina_List                             *items; /**< Displaced items still animating */
+      Ecore_Animator                        *animator; /**< Moves all of them */
+      Evas_Coord                            x, y; /**< Position of the first cell */
+      int                                   index; /**< Cell of reorder_it */
+      int                                   dir; /**< 1, or -1 when mirrored */
+      Eina_Bool                             on : 1; /**< reorder_it is handled here */
+   } reorder_move;
+
    Eina_Bool                             reorder_item_changed : 1;
    Eina_Bool                             move_effect_enabled : 1;
 
@@ -145,7 +158,7 @@ struct Elm_Gen_Item_Type
 
    Ecore_Animator         *item_reorder_move_animator;
    Evas_Coord              gx, gy, ox, oy, tx, ty, rx, ry;
-   unsigned int            moving_effect_start_time;
+   double                  moving_effect_start_time;
    int                     prev_group;
 
    Eina_Bool               group_realized : 1;
@@ -10,6 +10,9 @@
  */
 
 typedef struct _Async_Open_Data Async_Open_Data;
+
+/* how many upcoming frames of a playing animation get decoded ahead */
+#define ELM_IMAGE_ANIM_PRELOAD_FRAMES 2
 typedef enum
   {
      ELM_IMAGE_PRELOAD_ENABLED,
@@ -46,7 +49,6 @@ struct _Elm_Image_Data
    Evas_Object          *hit_rect;
    Evas_Object          *img;
    Evas_Object          *prev_img;
-   Ecore_Timer          *anim_timer;
 
    Elm_Url              *remote;
    const char           *key;
@@ -63,6 +65,17 @@ struct _Elm_Image_Data
 
    Efl_Gfx_Orientation   orient;
 
+   /* state for the shared animated image scheduler */
+   struct {
+      Eina_List         *node; // in the scheduler list while playing
+      double            *durations; // per frame, cached when starting
+      double             next; // loop time the current frame ends at
+      unsigned int       shown, dropped;
+      Evas_Object       *ring[ELM_IMAGE_ANIM_PRELOAD_FRAMES]; // hidden, preloading upcoming frames
+      int                ring_frame[ELM_IMAGE_ANIM_PRELOAD_FRAMES]; // frame each ring object holds
+      Eina_Bool          paused : 1; // off-screen on the last tick
+   } sched;
+
    struct {
       Ecore_Thread      *th;
       Async_Open_Data   *todo, *done;
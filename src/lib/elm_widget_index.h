@@ -24,6 +24,8 @@
  * Base layout smart data extended with index instance data.
  */
 typedef struct _Elm_Index_Data Elm_Index_Data;
+typedef struct _Elm_Index_Item_Data       Elm_Index_Item_Data;
+
 struct _Elm_Index_Data
 {
    Evas_Object          *event_rect[2]; /**< rectangle objects for event handling */
@@ -32,6 +34,12 @@ struct _Elm_Index_Data
                                   * for now and # of items will be
                                   * small */
    Eina_List            *omit;
+   Elm_Index_Item_Data **shown[2]; /**< items displayed in each box, in box
+                                     order. lets a pointer position be
+                                     mapped to its item without walking
+                                     every item. */
+   unsigned int          shown_count[2], shown_size[2];
+   Elm_Index_Item_Data  *selected[2]; /**< the selected item of each level */
 
    int                   level;
    Evas_Coord            dx, dy;
@@ -42,15 +50,25 @@ struct _Elm_Index_Data
                                             filled with contents. */
    int                   group_num, default_num;
    int                   show_group, next_group;
+   unsigned int          theme_gen; /**< bumped on each theme apply. item
+                                      views themed in an older generation
+                                      are themed again when shown. */
+   Evas_Coord            omit_item_h; /**< height of one item, measured once
+                                        per theme. -1 if unknown. */
+   /* the input the current omit list was calculated for */
+   int                   omit_level, omit_num, omit_max, omit_start;
 
    Eina_Bool             mouse_down : 1;
    Eina_Bool             horizontal : 1;
    Eina_Bool             autohide_disabled : 1;
    Eina_Bool             indicator_disabled : 1;
    Eina_Bool             omit_enabled : 1;
+   Eina_Bool             omit_valid : 1;
+   Eina_Bool             items_changed : 1; /**< items were added or removed
+                                              or a priority changed since
+                                              level 0 was last filled */
 };
 
-typedef struct _Elm_Index_Item_Data       Elm_Index_Item_Data;
 struct _Elm_Index_Item_Data
 {
    Elm_Widget_Item_Data *base;
@@ -63,6 +81,11 @@ struct _Elm_Index_Item_Data
    Elm_Index_Item_Data  *head;
 
    int              priority;
+   Evas_Coord       minw, minh; /**< size of the view when last shown */
+   unsigned int     theme_gen;
+   unsigned char    theme_group; /**< item group the view is themed with,
+                                   0 if none */
+   Eina_Bool        star : 1; /**< the view shows "*" (an omission head) */
    Eina_Bool        selected : 1; /**< a flag that remembers an item is selected. this is set true when mouse down/move occur above an item and when elm_index_item_selected_set() API is called. */
 };
 
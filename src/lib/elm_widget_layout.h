@@ -44,6 +44,17 @@
  * explained in detail.
  */
 
+#define ELM_LAYOUT_SIZE_MEMO_SLOTS 4
+
+/**
+ * One remembered result of the layout's edje min size calculation.
+ */
+typedef struct _Elm_Layout_Size_Memo
+{
+   unsigned long long sig; /**< Signature of the layout state this size was calculated for, 0 for an unused slot. */
+   Evas_Coord         minw, minh; /**< The calculated minimum size. */
+} Elm_Layout_Size_Memo;
+
 /**
  * Base widget smart data extended with layout instance data.
  */
@@ -57,6 +68,14 @@ typedef struct _Elm_Layout_Smart_Data
    const char           *group; /**< 2nd identifier of an edje object group which is used in theme_set. klass and group are used together. */
    int                   frozen; /**< Layout freeze counter */
 
+   Elm_Layout_Size_Memo  size_memo[ELM_LAYOUT_SIZE_MEMO_SLOTS]; /**< Recent min size calculations, looked up by state signature before asking edje again. */
+   unsigned int          size_memo_next; /**< Slot to be recycled by the next calculation. */
+   unsigned int          size_memo_hits; /**< Number of sizing evaluations answered from size_memo. */
+   unsigned int          size_memo_misses; /**< Number of sizing evaluations that had to ask edje. */
+   unsigned int          signal_epoch; /**< Bumped for every "elm,state,*" signal whose effect on the theme's state can't be tracked. */
+   unsigned long long    signal_states_sig; /**< Running signature of signal_states. */
+   Eina_Hash            *signal_states; /**< Last value of each visible/hidden and enabled/disabled signal pair seen on the edje object. */
+
    Eina_Bool             needs_size_calc : 1; /**< This flas is set true when the layout sizing eval is already requested. This defers sizing evaluation until smart calculation to avoid unnecessary calculation. */
    Eina_Bool             restricted_calc_w : 1; /**< This is a flag to support edje restricted_calc in w axis. */
    Eina_Bool             restricted_calc_h : 1; /**< This is a flag to support edje restricted_calc in y axis. */
@@ -43,6 +43,13 @@ struct _Elm_List_Data
    int                                   walking;
    Elm_List_Mode                         h_mode;
    Elm_List_Mode                         mode;
+   int                                   parity_mode; /**< whether the item theme switches odd/even styles by signal or needs the _odd group */
+
+   struct
+   {
+      Evas_Coord   w, h;
+      unsigned int w_count, h_count;
+   } part_min[2]; /**< largest min size hints of the icon [0] and end [1] contents, and how many items hold them */
 
    struct
    {
@@ -52,6 +59,7 @@ struct _Elm_List_Data
    Eina_Bool                             focus_on_selection_enabled : 1;
    Eina_Bool                             was_selected : 1;
    Eina_Bool                             fix_pending : 1;
+   Eina_Bool                             items_dirty : 1; /**< items were added, removed or need restyling since the last fix */
    Eina_Bool                             longpressed : 1;
    Eina_Bool                             scr_minw : 1;
    Eina_Bool                             scr_minh : 1;
@@ -76,6 +84,9 @@ struct _Elm_List_Item_Data
    const char          *label;
    Eina_List           *node;
 
+   Evas_Coord           part_minw[2], part_minh[2]; /**< icon and end min size hints, as accounted in the list part_min */
+   int                  position;
+
    Eina_Bool            is_separator : 1;
    Eina_Bool            highlighted : 1;
    Eina_Bool            dummy_icon : 1;
@@ -85,6 +96,7 @@ struct _Elm_List_Item_Data
    Eina_Bool            is_even : 1;
    Eina_Bool            fixed : 1;
    Eina_Bool            even : 1;
+   Eina_Bool            parts_dirty : 1;
 };
 
 /**
@@ -32,6 +32,9 @@ struct _Elm_Naviframe_Data
    Eina_List            *ops;
    Evas_Object          *dummy_edje;
    Evas_Display_Mode     dispmode;
+   Eina_List            *builds; /* items with a content still being built,
+                                   * oldest first */
+   double                build_budget; /* seconds per frame, 0 for default */
 
    Eina_Bool             preserve : 1;
    Eina_Bool             on_deletion : 1;
@@ -55,6 +58,12 @@ struct _Elm_Naviframe_Item_Data
    Evas_Display_Mode dispmode;
    Elm_Naviframe_Item_Pop_Cb pop_cb;
    void        *pop_data;
+   Elm_Naviframe_Item_Content_Build_Cb build_cb;
+   void        *build_data;
+   Evas_Object *build_content; /* content being built, not shown yet */
+   double       build_start; /* push time of a deferred push */
+   double       build_first_frame; /* seconds from push to first frame */
+   double       build_complete; /* seconds from push to content swap */
    const char  *style;
    const char  *title_label;
    const char  *subtitle_label;
@@ -29,6 +29,8 @@ typedef struct _Elm_Prefs_Page_Node
    Evas_Object                *parent;
    Evas_Object                *w_obj;
    const Elm_Prefs_Page_Iface *w_impl;
+   struct _Elm_Prefs_Item_Node *owner; /* page item of a subpage */
+   Eina_Bool                   built; /* item widgets created */
 
    const char                 *name;
    const char                 *title;
@@ -53,6 +55,7 @@ typedef struct _Elm_Prefs_Item_Node
    Evas_Object                *w_obj;
    const Elm_Prefs_Item_Iface *w_impl;
    Eina_Bool                   available;
+   Eina_Value                 *pending; /* set before its page was built */
 
    const char                 *name;
    const char                 *label;
@@ -80,8 +83,12 @@ struct _Elm_Prefs_Data
 
    Ecore_Poller         *saving_poller;
 
+   Eina_Hash            *items; /* full item path -> item node */
+   Ecore_Job            *build_job;
+
    Eina_Bool             changing_from_ui : 1;
    Eina_Bool             values_fetching : 1;
+   Eina_Bool             page_building : 1;
    Eina_Bool             delete_me : 1;
    Eina_Bool             autosave : 1;
    Eina_Bool             dirty : 1;
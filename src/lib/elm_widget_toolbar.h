@@ -49,6 +49,12 @@ struct _Elm_Toolbar_Data
    Elm_Object_Select_Mode                select_mode;
    Ecore_Timer                          *long_timer;
    Ecore_Job                            *resize_job;
+   Elm_Toolbar_Item_Data               **prio_items; /**< Items ordered by priority, highest first, rebuilt only when prio_dirty is set. */
+   Evas_Coord                           *prio_extents; /**< Cumulative measured extent along the toolbar axis of the items above standard_priority, in prio_items order. */
+   unsigned int                          prio_count, prio_size;
+   unsigned int                          prio_eligible; /**< Number of leading prio_items above standard_priority. */
+   unsigned int                          prio_shown; /**< Number of leading prio_items currently visible in shrink modes. */
+   Evas_Coord                            prio_cell; /**< Largest measured extent along the toolbar axis, every item's one when homogeneous. */
 
    Eina_Bool                             vertical : 1;
    Eina_Bool                             long_press : 1;
@@ -57,6 +63,9 @@ struct _Elm_Toolbar_Data
    Eina_Bool                             reorder_mode : 1;
    Eina_Bool                             transverse_expanded : 1;
    Eina_Bool                             mouse_down : 1; /**< a flag that mouse is down on the toolbar at the moment. This flag is set to true on mouse and reset to false on mouse up. */
+   Eina_Bool                             prio_dirty : 1; /**< Items, their priorities or measured sizes changed since prio_items was built. */
+   Eina_Bool                             overflow : 1; /**< The last shrink layout didn't fit all items. */
+   Eina_Bool                             layout_valid : 1; /**< The box and "more" menu reflect the current prio_shown and overflow. */
 };
 
 struct _Elm_Toolbar_Item_Data
@@ -79,6 +88,7 @@ struct _Elm_Toolbar_Item_Data
       int       priority;
       Eina_Bool visible : 1;
    } prio;
+   Evas_Coord    minw, minh; /**< Size measured by the last item sizing evaluation, finger size included. */
 
    Eina_List    *states;
    Eina_List    *current_state;
@@ -181,6 +181,24 @@ struct _Elm_Win_Data
       Eina_Bool    auto_animate : 1;
    } focus_highlight;
 
+   struct
+   {
+      Eina_List  **cells; /* cols * rows lists of widgets overlapping each cell */
+      Eina_List   *objs; /* every widget indexed by the grid */
+      Eina_List   *dirty; /* widgets moved or resized since the last query */
+      int          cols, rows;
+      unsigned int stamp;
+   } focus_grid;
+
+   struct
+   {
+      Elm_Win_Frame_Stats *ring; /* last frames, NULL while disabled */
+      unsigned int         head, count, frames;
+      Elm_Win_Frame_Stats  cur; /* the frame being rendered */
+      double               calc_start, calc_end, flush_start, flush_end;
+      Eina_Bool            in_frame : 1;
+   } frame_stats;
+
    Evas_Object *icon;
    const char  *title;
    const char  *icon_name;
@@ -324,6 +342,258 @@ _elm_win_first_frame_do(void *data, Evas *e EINA_UNUSED, void *event_info EINA_U
    evas_event_callback_del_full(e, EVAS_CALLBACK_RENDER_POST, _elm_win_first_frame_do, data);
 }
 
+static void
+_elm_win_first_frame_report(void *data EINA_UNUSED, Evas *e, void *event_info EINA_UNUSED)
+{
+   evas_event_callback_del_full(e, EVAS_CALLBACK_RENDER_POST, _elm_win_first_frame_report, NULL);
+   _elm_quicklaunch_first_frame(ecore_time_unix_get() - _elm_startup_time);
+}
+
+#define ELM_WIN_FRAME_STATS_RING 256
+
+/* upper bounds of the histogram buckets, the last bucket is unbounded */
+static const double _frame_stats_bounds[] =
+{
+   0.001, 0.002, 0.004, 0.008, 0.016, 0.033, 0.066, 0.133, 0.266
+};
+#define ELM_WIN_FRAME_STATS_BUCKETS \
+   ((sizeof(_frame_stats_bounds) / sizeof(_frame_stats_bounds[0])) + 1)
+
+enum
+{
+   ELM_WIN_FRAME_STATS_FRAME,
+   ELM_WIN_FRAME_STATS_CALC,
+   ELM_WIN_FRAME_STATS_RENDER,
+   ELM_WIN_FRAME_STATS_FLUSH,
+   ELM_WIN_FRAME_STATS_LAST
+};
+
+/* process wide totals, dumped at shutdown with ELM_FRAME_STATS */
+static unsigned int _frame_stats_hist[ELM_WIN_FRAME_STATS_LAST][ELM_WIN_FRAME_STATS_BUCKETS];
+static double _frame_stats_sum[ELM_WIN_FRAME_STATS_LAST];
+static double _frame_stats_max[ELM_WIN_FRAME_STATS_LAST];
+static unsigned int _frame_stats_frames = 0;
+
+static Ecore_Idle_Enterer *_frame_stats_enterer = NULL;
+static Ecore_Idle_Exiter *_frame_stats_exiter = NULL;
+static double _frame_stats_idle_start = 0.0;
+static int _frame_stats_wins = 0;
+
+static Eina_Bool
+_elm_win_frame_stats_idle_enter(void *data EINA_UNUSED)
+{
+   _frame_stats_idle_start = ecore_time_get();
+   return ECORE_CALLBACK_RENEW;
+}
+
+static Eina_Bool
+_elm_win_frame_stats_idle_exit(void *data EINA_UNUSED)
+{
+   _frame_stats_idle_start = 0.0;
+   return ECORE_CALLBACK_RENEW;
+}
+
+static void
+_elm_win_frame_stats_account(const Elm_Win_Frame_Stats *fs)
+{
+   double t[ELM_WIN_FRAME_STATS_LAST];
+   unsigned int i, b;
+
+   t[ELM_WIN_FRAME_STATS_FRAME] = fs->end - fs->start;
+   t[ELM_WIN_FRAME_STATS_CALC] = fs->calc;
+   t[ELM_WIN_FRAME_STATS_RENDER] = fs->render;
+   t[ELM_WIN_FRAME_STATS_FLUSH] = fs->flush;
+
+   for (i = 0; i < ELM_WIN_FRAME_STATS_LAST; i++)
+     {
+        for (b = 0; b < ELM_WIN_FRAME_STATS_BUCKETS - 1; b++)
+          if (t[i] < _frame_stats_bounds[b]) break;
+        _frame_stats_hist[i][b]++;
+        _frame_stats_sum[i] += t[i];
+        if (t[i] > _frame_stats_max[i]) _frame_stats_max[i] = t[i];
+     }
+   _frame_stats_frames++;
+}
+
+static void
+_elm_win_frame_stats_dump(void)
+{
+   static const char *names[ELM_WIN_FRAME_STATS_LAST] =
+     {
+        "frame", "calc", "render", "flush"
+     };
+   char buf[32];
+   unsigned int i, b;
+
+   if (!_frame_stats_frames) return;
+
+   fprintf(stderr, "ELM_FRAME_STATS: %u frames\n%-8s", _frame_stats_frames, "");
+   for (b = 0; b < ELM_WIN_FRAME_STATS_BUCKETS - 1; b++)
+     {
+        snprintf(buf, sizeof(buf), "<%gms", _frame_stats_bounds[b] * 1000.0);
+        fprintf(stderr, " %8s", buf);
+     }
+   snprintf(buf, sizeof(buf), ">=%gms", _frame_stats_bounds[b - 1] * 1000.0);
+   fprintf(stderr, " %8s %9s %9s\n", buf, "mean(ms)", "max(ms)");
+
+   for (i = 0; i < ELM_WIN_FRAME_STATS_LAST; i++)
+     {
+        fprintf(stderr, "%-8s", names[i]);
+        for (b = 0; b < ELM_WIN_FRAME_STATS_BUCKETS; b++)
+          fprintf(stderr, " %8u", _frame_stats_hist[i][b]);
+        fprintf(stderr, " %9.3f %9.3f\n",
+                (_frame_stats_sum[i] * 1000.0) / _frame_stats_frames,
+                _frame_stats_max[i] * 1000.0);
+     }
+
+   memset(_frame_stats_hist, 0, sizeof(_frame_stats_hist));
+   memset(_frame_stats_sum, 0, sizeof(_frame_stats_sum));
+   memset(_frame_stats_max, 0, sizeof(_frame_stats_max));
+   _frame_stats_frames = 0;
+}
+
+/* called from the ecore_evas pre render callback, the window's turn in
+ * the idle enterers has come */
+static void
+_elm_win_frame_stats_begin(Elm_Win_Data *sd)
+{
+   Elm_Win_Frame_Stats *fs = &sd->frame_stats.cur;
+   double now = ecore_time_get();
+
+   memset(fs, 0, sizeof(Elm_Win_Frame_Stats));
+   fs->frame = sd->frame_stats.frames;
+   if ((_frame_stats_idle_start > 0.0) && (_frame_stats_idle_start <= now))
+     fs->start = _frame_stats_idle_start;
+   else
+     fs->start = now;
+   fs->idle = now - fs->start;
+
+   sd->frame_stats.calc_start = now;
+   sd->frame_stats.flush_start = 0.0;
+   sd->frame_stats.flush_end = 0.0;
+   sd->frame_stats.in_frame = EINA_TRUE;
+}
+
+/* evas_render() calculates smart objects first thing, doing it here
+ * instead lets the calculation be timed apart from the rendering */
+static void
+_elm_win_frame_stats_calc(Elm_Win_Data *sd)
+{
+   evas_smart_objects_calculate(sd->evas);
+   sd->frame_stats.calc_end = ecore_time_get();
+   sd->frame_stats.cur.calc =
+     sd->frame_stats.calc_end - sd->frame_stats.calc_start;
+}
+
+static void
+_elm_win_frame_stats_flush_pre(void *data,
+                               Evas *e EINA_UNUSED,
+                               void *event_info EINA_UNUSED)
+{
+   Elm_Win_Data *sd = data;
+
+   if (sd->frame_stats.in_frame)
+     sd->frame_stats.flush_start = ecore_time_get();
+}
+
+static void
+_elm_win_frame_stats_flush_post(void *data,
+                                Evas *e EINA_UNUSED,
+                                void *event_info EINA_UNUSED)
+{
+   Elm_Win_Data *sd = data;
+
+   if (sd->frame_stats.in_frame)
+     sd->frame_stats.flush_end = ecore_time_get();
+}
+
+static void
+_elm_win_frame_stats_render_post(void *data,
+                                 Evas *e EINA_UNUSED,
+                                 void *event_info EINA_UNUSED)
+{
+   Elm_Win_Data *sd = data;
+   Elm_Win_Frame_Stats *fs = &sd->frame_stats.cur;
+   double now = ecore_time_get();
+
+   if (!sd->frame_stats.in_frame) return;
+   sd->frame_stats.in_frame = EINA_FALSE;
+
+   fs->end = now;
+   if (sd->frame_stats.flush_start > 0.0)
+     {
+        fs->render = sd->frame_stats.flush_start - sd->frame_stats.calc_end;
+        if (sd->frame_stats.flush_end >= sd->frame_stats.flush_start)
+          fs->flush = sd->frame_stats.flush_end - sd->frame_stats.flush_start;
+        else
+          fs->flush = now - sd->frame_stats.flush_start;
+     }
+   else
+     fs->render = now - sd->frame_stats.calc_end;
+
+   sd->frame_stats.ring[sd->frame_stats.head] = *fs;
+   sd->frame_stats.head = (sd->frame_stats.head + 1) % ELM_WIN_FRAME_STATS_RING;
+   if (sd->frame_stats.count < ELM_WIN_FRAME_STATS_RING)
+     sd->frame_stats.count++;
+   sd->frame_stats.frames++;
+
+   _elm_win_frame_stats_account(fs);
+
+   eo_event_callback_call(sd->obj, ELM_WIN_EVENT_FRAME_STATS, fs);
+}
+
+static void
+_elm_win_frame_stats_enable(Elm_Win_Data *sd, Eina_Bool enabled)
+{
+   if (!!sd->frame_stats.ring == !!enabled) return;
+
+   if (enabled)
+     {
+        sd->frame_stats.ring =
+          calloc(ELM_WIN_FRAME_STATS_RING, sizeof(Elm_Win_Frame_Stats));
+        if (!sd->frame_stats.ring)
+          {
+             ERR("failed to allocate memory!");
+             return;
+          }
+        sd->frame_stats.head = 0;
+        sd->frame_stats.count = 0;
+
+        evas_event_callback_add(sd->evas, EVAS_CALLBACK_RENDER_FLUSH_PRE,
+                                _elm_win_frame_stats_flush_pre, sd);
+        evas_event_callback_add(sd->evas, EVAS_CALLBACK_RENDER_FLUSH_POST,
+                                _elm_win_frame_stats_flush_post, sd);
+        evas_event_callback_add(sd->evas, EVAS_CALLBACK_RENDER_POST,
+                                _elm_win_frame_stats_render_post, sd);
+
+        if (!_frame_stats_wins++)
+          {
+             _frame_stats_enterer = ecore_idle_enterer_before_add
+                 (_elm_win_frame_stats_idle_enter, NULL);
+             _frame_stats_exiter = ecore_idle_exiter_add
+                 (_elm_win_frame_stats_idle_exit, NULL);
+          }
+     }
+   else
+     {
+        evas_event_callback_del_full(sd->evas, EVAS_CALLBACK_RENDER_FLUSH_PRE,
+                                     _elm_win_frame_stats_flush_pre, sd);
+        evas_event_callback_del_full(sd->evas, EVAS_CALLBACK_RENDER_FLUSH_POST,
+                                     _elm_win_frame_stats_flush_post, sd);
+        evas_event_callback_del_full(sd->evas, EVAS_CALLBACK_RENDER_POST,
+                                     _elm_win_frame_stats_render_post, sd);
+        ELM_SAFE_FREE(sd->frame_stats.ring, free);
+        sd->frame_stats.in_frame = EINA_FALSE;
+
+        if (!--_frame_stats_wins)
+          {
+             ELM_SAFE_FREE(_frame_stats_enterer, ecore_idle_enterer_del);
+             ELM_SAFE_FREE(_frame_stats_exiter, ecore_idle_exiter_del);
+             _frame_stats_idle_start = 0.0;
+          }
+     }
+}
+
 static void
 _win_noblank_eval(void)
 {
@@ -845,8 +1115,14 @@ _elm_win_pre_render(Ecore_Evas *ee)
    Elm_Win_Data *sd = _elm_win_associate_get(ee);
    if (!sd) return;
 
+   if (sd->frame_stats.ring)
+     _elm_win_frame_stats_begin(sd);
+
    if (sd->deferred_resize_job)
      _elm_win_resize_job(sd->obj);
+
+   if (sd->frame_stats.ring)
+     _elm_win_frame_stats_calc(sd);
 }
 
 static void
@@ -1844,6 +2120,333 @@ _elm_win_focus_highlight_shutdown(Elm_Win_Data *sd)
      _elm_win_object_focus_out, sd->obj);
 }
 
+#define ELM_WIN_FOCUS_GRID_CELL_SIZE 128
+
+static void
+_elm_win_focus_grid_cells_apply(Elm_Win_Data *sd,
+                                Evas_Object *subobj,
+                                const Eina_Rectangle *r,
+                                Eina_Bool add)
+{
+   int c, row, c1, r1, c2, r2;
+   Eina_List **cell;
+
+   if (!sd->focus_grid.cells) return;
+
+   /* geometry out of the window is clamped to the border cells, so
+    * those are unbounded when testing against a half-plane */
+   c1 = MAX(r->x, 0) / ELM_WIN_FOCUS_GRID_CELL_SIZE;
+   r1 = MAX(r->y, 0) / ELM_WIN_FOCUS_GRID_CELL_SIZE;
+   c2 = MAX(r->x + r->w - 1, 0) / ELM_WIN_FOCUS_GRID_CELL_SIZE;
+   r2 = MAX(r->y + r->h - 1, 0) / ELM_WIN_FOCUS_GRID_CELL_SIZE;
+   c1 = MIN(c1, sd->focus_grid.cols - 1);
+   r1 = MIN(r1, sd->focus_grid.rows - 1);
+   c2 = MAX(MIN(c2, sd->focus_grid.cols - 1), c1);
+   r2 = MAX(MIN(r2, sd->focus_grid.rows - 1), r1);
+
+   for (row = r1; row <= r2; row++)
+     for (c = c1; c <= c2; c++)
+       {
+          cell = &(sd->focus_grid.cells[(row * sd->focus_grid.cols) + c]);
+          if (add) *cell = eina_list_prepend(*cell, subobj);
+          else *cell = eina_list_remove(*cell, subobj);
+       }
+}
+
+static void
+_elm_win_focus_grid_cells_free(Elm_Win_Data *sd)
+{
+   int i;
+
+   if (!sd->focus_grid.cells) return;
+
+   for (i = 0; i < (sd->focus_grid.cols * sd->focus_grid.rows); i++)
+     eina_list_free(sd->focus_grid.cells[i]);
+   ELM_SAFE_FREE(sd->focus_grid.cells, free);
+   sd->focus_grid.cols = sd->focus_grid.rows = 0;
+}
+
+static void
+_elm_win_focus_grid_shutdown(Elm_Win_Data *sd)
+{
+   Evas_Object *subobj;
+
+   _elm_win_focus_grid_cells_free(sd);
+   sd->focus_grid.dirty = eina_list_free(sd->focus_grid.dirty);
+   EINA_LIST_FREE(sd->focus_grid.objs, subobj)
+     {
+        Elm_Widget_Smart_Data *wd =
+          eo_data_scope_get(subobj, ELM_WIDGET_CLASS);
+
+        if (wd) memset(&wd->focus_grid, 0, sizeof(wd->focus_grid));
+     }
+}
+
+/* bring the grid up to date with the window size and the widgets
+ * which moved since the last query */
+static void
+_elm_win_focus_grid_flush(Elm_Win_Data *sd)
+{
+   Evas_Object *subobj;
+   Evas_Coord w, h;
+   Eina_List *l;
+   int cols, rows;
+
+   evas_object_geometry_get(sd->obj, NULL, NULL, &w, &h);
+   cols = MAX((w + ELM_WIN_FOCUS_GRID_CELL_SIZE - 1) /
+              ELM_WIN_FOCUS_GRID_CELL_SIZE, 1);
+   rows = MAX((h + ELM_WIN_FOCUS_GRID_CELL_SIZE - 1) /
+              ELM_WIN_FOCUS_GRID_CELL_SIZE, 1);
+
+   if ((!sd->focus_grid.cells) || (cols != sd->focus_grid.cols) ||
+       (rows != sd->focus_grid.rows))
+     {
+        _elm_win_focus_grid_cells_free(sd);
+        sd->focus_grid.cells = calloc(cols * rows, sizeof(Eina_List *));
+        if (!sd->focus_grid.cells) return;
+        sd->focus_grid.cols = cols;
+        sd->focus_grid.rows = rows;
+
+        /* window resized: index everything again */
+        EINA_LIST_FOREACH(sd->focus_grid.objs, l, subobj)
+          {
+             Elm_Widget_Smart_Data *wd =
+               eo_data_scope_get(subobj, ELM_WIDGET_CLASS);
+
+             wd->focus_grid.indexed = EINA_FALSE;
+             if (wd->focus_grid.dirty_node) continue;
+             sd->focus_grid.dirty =
+               eina_list_prepend(sd->focus_grid.dirty, subobj);
+             wd->focus_grid.dirty_node = sd->focus_grid.dirty;
+          }
+     }
+
+   EINA_LIST_FREE(sd->focus_grid.dirty, subobj)
+     {
+        Elm_Widget_Smart_Data *wd =
+          eo_data_scope_get(subobj, ELM_WIDGET_CLASS);
+
+        wd->focus_grid.dirty_node = NULL;
+        if (wd->focus_grid.indexed)
+          _elm_win_focus_grid_cells_apply
+            (sd, subobj, &wd->focus_grid.geom, EINA_FALSE);
+        EINA_RECTANGLE_SET(&wd->focus_grid.geom, wd->x, wd->y, wd->w, wd->h);
+        _elm_win_focus_grid_cells_apply
+          (sd, subobj, &wd->focus_grid.geom, EINA_TRUE);
+        wd->focus_grid.indexed = EINA_TRUE;
+     }
+}
+
+void
+_elm_win_focus_grid_object_dirty(Evas_Object *obj,
+                                 Evas_Object *subobj)
+{
+   Elm_Widget_Smart_Data *wd;
+
+   ELM_WIN_DATA_GET(obj, sd);
+   if (!sd) return;
+   wd = eo_data_scope_get(subobj, ELM_WIDGET_CLASS);
+   if (!wd) return;
+
+   if (!wd->focus_grid.node)
+     {
+        sd->focus_grid.objs = eina_list_prepend(sd->focus_grid.objs, subobj);
+        wd->focus_grid.node = sd->focus_grid.objs;
+        wd->focus_grid.win = obj;
+     }
+   if (wd->focus_grid.dirty_node) return;
+
+   sd->focus_grid.dirty = eina_list_prepend(sd->focus_grid.dirty, subobj);
+   wd->focus_grid.dirty_node = sd->focus_grid.dirty;
+}
+
+void
+_elm_win_focus_grid_object_del(Evas_Object *obj,
+                               Evas_Object *subobj)
+{
+   Elm_Widget_Smart_Data *wd;
+
+   ELM_WIN_DATA_GET(obj, sd);
+   if (!sd) return;
+   wd = eo_data_scope_get(subobj, ELM_WIDGET_CLASS);
+   if (!wd || (wd->focus_grid.win != obj)) return;
+
+   if (wd->focus_grid.indexed)
+     _elm_win_focus_grid_cells_apply
+       (sd, subobj, &wd->focus_grid.geom, EINA_FALSE);
+   if (wd->focus_grid.dirty_node)
+     sd->focus_grid.dirty = eina_list_remove_list
+         (sd->focus_grid.dirty, wd->focus_grid.dirty_node);
+   if (wd->focus_grid.node)
+     sd->focus_grid.objs = eina_list_remove_list
+         (sd->focus_grid.objs, wd->focus_grid.node);
+   memset(&wd->focus_grid, 0, sizeof(wd->focus_grid));
+}
+
+/* Upper bound of the directional weight of the widgets lying more
+ * than @p d cells away from the base's ones, -1.0 if there is none:
+ * they are at least d cells worth of pixels away and the weight is
+ * about 1 / distance^2 (see _elm_widget_focus_direction_weight_get()),
+ * a pixel of slack covering its rounding. */
+static double
+_elm_win_focus_grid_ring_limit(int d)
+{
+   double dist = (double)d * ELM_WIN_FOCUS_GRID_CELL_SIZE;
+
+   if ((dist * dist) <= 2.0) return -1.0;
+   return 1.0 / ((dist * dist) - 1.0);
+}
+
+/**
+ * @internal
+ *
+ * Mark the indexed widgets which may be found in the @p degree
+ * direction of @p base, i.e. the ones having some part in the
+ * half-plane in front of base's center.
+ *
+ * Cells are walked ring by ring, outwards from the ones under
+ * @p base, skipping whole cells behind it. If @p limit is given,
+ * the walk stops as soon as no farther widget can outweigh the best
+ * candidate seen so far, and @p limit gets the weight no unmarked
+ * widget can exceed, or 0.0 if every cell was walked. The caller
+ * has to query again without @p limit if the widget it finally
+ * picks does not outweigh it, e.g. because that best candidate is
+ * not reachable through the widget tree.
+ *
+ * @return The stamp set on candidate widgets, 0 if nothing is indexed.
+ */
+unsigned int
+_elm_win_focus_grid_query(Evas_Object *obj,
+                          const Evas_Object *base,
+                          double degree,
+                          double *limit)
+{
+   Evas_Coord bx, by, bw, bh;
+   double cx, cy, dx, dy, px, py, best = 0.0, bound;
+   int c1, r1, c2, r2, cmin, cmax, rmin, rmax, c, row, d, dmax;
+   Evas_Object *subobj;
+   Eina_List *l;
+
+   if (limit) *limit = 0.0;
+
+   ELM_WIN_DATA_GET(obj, sd);
+   if (!sd || !sd->focus_grid.objs) return 0;
+
+   _elm_win_focus_grid_flush(sd);
+   if (!sd->focus_grid.cells) return 0;
+
+   if (!++sd->focus_grid.stamp) sd->focus_grid.stamp++;
+
+   evas_object_geometry_get(base, &bx, &by, &bw, &bh);
+   cx = bx + (bw / 2.0);
+   cy = by + (bh / 2.0);
+
+   /* 0-degree is up, going clockwise */
+   dx = sin(degree * (M_PI / 180.0));
+   dy = -cos(degree * (M_PI / 180.0));
+   if (fabs(dx) < 1e-6) dx = 0.0;
+   if (fabs(dy) < 1e-6) dy = 0.0;
+
+   /* cells under base, clamped to the grid like indexed widgets */
+   c1 = MIN(MAX(bx, 0) / ELM_WIN_FOCUS_GRID_CELL_SIZE,
+            sd->focus_grid.cols - 1);
+   r1 = MIN(MAX(by, 0) / ELM_WIN_FOCUS_GRID_CELL_SIZE,
+            sd->focus_grid.rows - 1);
+   c2 = MAX(MIN(MAX(bx + bw - 1, 0) / ELM_WIN_FOCUS_GRID_CELL_SIZE,
+                sd->focus_grid.cols - 1), c1);
+   r2 = MAX(MIN(MAX(by + bh - 1, 0) / ELM_WIN_FOCUS_GRID_CELL_SIZE,
+                sd->focus_grid.rows - 1), r1);
+
+   /* straight directions never look at the columns (rows) behind
+    * base's ones */
+   cmin = ((dy == 0.0) && (dx > 0.0)) ? c1 : 0;
+   cmax = ((dy == 0.0) && (dx < 0.0)) ? c2 : sd->focus_grid.cols - 1;
+   rmin = ((dx == 0.0) && (dy > 0.0)) ? r1 : 0;
+   rmax = ((dx == 0.0) && (dy < 0.0)) ? r2 : sd->focus_grid.rows - 1;
+
+   dmax = MAX(MAX(c1 - cmin, cmax - c2), MAX(r1 - rmin, rmax - r2));
+
+   for (d = 0; d <= dmax; d++)
+     {
+        for (row = MAX(r1 - d, rmin); row <= MIN(r2 + d, rmax); row++)
+          for (c = MAX(c1 - d, cmin); c <= MIN(c2 + d, cmax); c++)
+            {
+               Eina_Bool unbounded;
+
+               /* only the ring d cells away from base's ones, so
+                * inner rows are walked by their two end cells */
+               if ((d > 0) && (row != r1 - d) && (row != r2 + d) &&
+                   (c != c1 - d) && (c != c2 + d))
+                 {
+                    if (c < c2 + d) c = c2 + d - 1;
+                    continue;
+                 }
+
+               unbounded =
+                 ((dx > 0.0) && (c == sd->focus_grid.cols - 1)) ||
+                 ((dx < 0.0) && (c == 0)) ||
+                 ((dy > 0.0) && (row == sd->focus_grid.rows - 1)) ||
+                 ((dy < 0.0) && (row == 0));
+               if (!unbounded)
+                 {
+                    px = (c + (dx > 0.0)) * ELM_WIN_FOCUS_GRID_CELL_SIZE;
+                    py = (row + (dy > 0.0)) * ELM_WIN_FOCUS_GRID_CELL_SIZE;
+                    if ((((px - cx) * dx) + ((py - cy) * dy)) < -1.0)
+                      continue;
+                 }
+
+               EINA_LIST_FOREACH
+                 (sd->focus_grid.cells[(row * sd->focus_grid.cols) + c],
+                 l, subobj)
+                 {
+                    Elm_Widget_Smart_Data *wd =
+                      eo_data_scope_get(subobj, ELM_WIDGET_CLASS);
+                    const Eina_Rectangle *r = &wd->focus_grid.geom;
+                    double weight;
+
+                    if (wd->focus_grid.stamp == sd->focus_grid.stamp)
+                      continue;
+
+                    /* farthest corner along the direction, with a
+                     * pixel of slack against the weight function's
+                     * rounding */
+                    px = r->x + ((dx > 0.0) ? r->w : 0);
+                    py = r->y + ((dy > 0.0) ? r->h : 0);
+                    if ((((px - cx) * dx) + ((py - cy) * dy)) < -1.0)
+                      continue;
+
+                    wd->focus_grid.stamp = sd->focus_grid.stamp;
+
+                    if (!limit || (best == -1.0) || (subobj == base) ||
+                        (wd->focused) || (wd->disabled) ||
+                        (!evas_object_visible_get(subobj)))
+                      continue;
+
+                    weight = _elm_widget_focus_direction_weight_get
+                        (base, subobj, degree);
+                    if ((weight == -1.0) ||
+                        ((int)(weight * 1000000) > (int)(best * 1000000)))
+                      best = weight;
+                 }
+            }
+
+        if (!limit || (best == 0.0)) continue;
+
+        /* ties on the rounded weight are broken by focus order, so a
+         * farther widget has to weigh strictly less */
+        bound = _elm_win_focus_grid_ring_limit(d);
+        if ((bound > 0.0) && ((best == -1.0) ||
+                              ((int)(bound * 1000000) <
+                               (int)(best * 1000000))))
+          {
+             if (d < dmax) *limit = bound;
+             break;
+          }
+     }
+
+   return sd->focus_grid.stamp;
+}
+
 static void
 _win_img_hide(void *data,
               Evas *e EINA_UNUSED,
@@ -1981,6 +2584,8 @@ _elm_win_evas_object_smart_del(Eo *obj, Elm_Win_Data *sd)
 
    _elm_win_focus_highlight_shutdown(sd);
    eina_stringshare_del(sd->focus_highlight.style);
+   _elm_win_focus_grid_shutdown(sd);
+   _elm_win_frame_stats_enable(sd, EINA_FALSE);
 
    eina_stringshare_del(sd->title);
    eina_stringshare_del(sd->icon_name);
@@ -2475,6 +3080,8 @@ _elm_win_shutdown(void)
           }
      }
    ELM_SAFE_FREE(_elm_win_state_eval_timer, ecore_timer_del);
+
+   if (_elm_config->frame_stats) _elm_win_frame_stats_dump();
 }
 
 void
@@ -3705,6 +4312,9 @@ _elm_win_finalize_internal(Eo *obj, Elm_Win_Data *sd, const char *name, Elm_Win_
    if (getenv("ELM_FIRST_FRAME"))
      evas_event_callback_add(ecore_evas_get(tmp_sd.ee), EVAS_CALLBACK_RENDER_POST,
                              _elm_win_first_frame_do, getenv("ELM_FIRST_FRAME"));
+   if (_elm_quicklaunch_first_frame_pending())
+     evas_event_callback_add(ecore_evas_get(tmp_sd.ee), EVAS_CALLBACK_RENDER_POST,
+                             _elm_win_first_frame_report, NULL);
 
    /* copying possibly altered fields back */
 #define SD_CPY(_field)             \
@@ -3823,6 +4433,8 @@ _elm_win_finalize_internal(Eo *obj, Elm_Win_Data *sd, const char *name, Elm_Win_
    ecore_evas_callback_resize_set(sd->ee, _elm_win_resize);
    ecore_evas_callback_move_set(sd->ee, _elm_win_move);
    ecore_evas_callback_pre_render_set(sd->ee, _elm_win_pre_render);
+   if (_elm_config->frame_stats)
+     _elm_win_frame_stats_enable(sd, EINA_TRUE);
    if (type != ELM_WIN_FAKE)
      ecore_evas_callback_mouse_in_set(sd->ee, _elm_win_mouse_in);
    evas_object_event_callback_add(obj, EVAS_CALLBACK_HIDE, _elm_win_cb_hide, NULL);
@@ -5248,6 +5860,41 @@ _elm_win_illume_command_send(Eo *obj EINA_UNUSED, Elm_Win_Data *sd, Elm_Illume_C
 #endif
 }
 
+EOLIAN static void
+_elm_win_frame_stats_enabled_set(Eo *obj EINA_UNUSED, Elm_Win_Data *sd, Eina_Bool enabled)
+{
+   _elm_win_frame_stats_enable(sd, enabled);
+}
+
+EOLIAN static Eina_Bool
+_elm_win_frame_stats_enabled_get(Eo *obj EINA_UNUSED, Elm_Win_Data *sd)
+{
+   return !!sd->frame_stats.ring;
+}
+
+EOLIAN static unsigned int
+_elm_win_frame_stats_get(const Eo *obj EINA_UNUSED, Elm_Win_Data *sd, Elm_Win_Frame_Stats *stats, unsigned int count)
+{
+   unsigned int i, n, first;
+
+   if ((!stats) || (!sd->frame_stats.ring)) return 0;
+
+   n = MIN(count, sd->frame_stats.count);
+   first = (sd->frame_stats.head + ELM_WIN_FRAME_STATS_RING - n) %
+     ELM_WIN_FRAME_STATS_RING;
+   for (i = 0; i < n; i++)
+     stats[i] = sd->frame_stats.ring[(first + i) % ELM_WIN_FRAME_STATS_RING];
+
+   return n;
+}
+
+EOLIAN static void
+_elm_win_frame_stats_clear(Eo *obj EINA_UNUSED, Elm_Win_Data *sd)
+{
+   sd->frame_stats.head = 0;
+   sd->frame_stats.count = 0;
+}
+
 EOLIAN static Eina_Bool
 _elm_win_keygrab_set(Eo *obj EINA_UNUSED, Elm_Win_Data *sd, const char *key, Evas_Modifier_Mask modifiers EINA_UNUSED, Evas_Modifier_Mask not_modifiers EINA_UNUSED, int priority EINA_UNUSED, Elm_Win_Keygrab_Mode grab_mode)
 {
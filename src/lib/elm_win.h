@@ -91,6 +91,9 @@
  * @li "focused" : When the win has received focus. (since 1.8)
  * @li "unfocused" : When the win has lost focus. (since 1.8)
  * @li "theme,changed" - The theme was changed. (since 1.13)
+ * @li "frame,stats" - A frame was rendered while frame statistics are
+ *                     enabled. The event info is the frame's
+ *                     #Elm_Win_Frame_Stats. (since 1.18)
  *
  * Note that calling evas_object_show() after window contents creation is
  * recommended. It will trigger evas_smart_objects_calculate() and some backend
@@ -57,6 +57,32 @@ struct _Elm_Win_Trap
    Eina_Bool (*withdrawn_set)(void *data, Evas_Object *o, Eina_Bool withdrawn);
 };
 
+/**
+ * @typedef Elm_Win_Frame_Stats
+ *
+ * Timing of one frame of a window, as recorded once frame statistics are
+ * enabled with elm_win_frame_stats_enabled_set(). Times are in seconds,
+ * from ecore_time_get().
+ *
+ * A frame starts when the main loop goes idle and runs its idle enterers,
+ * the window's rendering being one of them. The phases follow each other:
+ * idle enterers that ran before the window's turn, the smart object
+ * calculation, the rendering and the flush to the screen.
+ *
+ * @since 1.18
+ */
+typedef struct _Elm_Win_Frame_Stats Elm_Win_Frame_Stats;
+struct _Elm_Win_Frame_Stats
+{
+   unsigned int frame; /**< sequence number of the frame in its window */
+   double       start; /**< when the main loop went idle for the frame */
+   double       end; /**< when the frame was done */
+   double       idle; /**< time spent in idle enterers before the window rendered */
+   double       calc; /**< time spent calculating smart objects */
+   double       render; /**< time spent rendering */
+   double       flush; /**< time spent flushing the frame to the screen */
+};
+
 /**
  * Sets the trap to be used for internal @c Ecore_Evas management.
  *
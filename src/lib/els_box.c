@@ -7,6 +7,233 @@
 #include "elm_priv.h"
 #include "els_box.h"
 
+static const char _box_cache_key[] = "_els_box_cache";
+
+typedef struct _Els_Box_Cache Els_Box_Cache;
+typedef struct _Els_Box_Item Els_Box_Item;
+
+/* size hints of a box child, refreshed only after the child reported
+ * a hint change; min and max include the padding hints */
+struct _Els_Box_Item
+{
+   Els_Box_Cache      *cache;
+   Evas_Object        *obj;
+   Evas_Coord          minw, minh, maxw, maxh;
+   Evas_Coord          pad_l, pad_r, pad_t, pad_b;
+   double              wx, wy, ax, ay;
+   Evas_Aspect_Control aspect;
+   int                 asx, asy;
+   unsigned int        stamp;
+   Eina_Bool           dirty : 1;
+};
+
+struct _Els_Box_Cache
+{
+   Eina_Hash     *items;
+   Els_Box_Item **order;
+   unsigned int   count, size;
+   unsigned int   stamp;
+   struct
+   {
+      Evas_Coord w, h, pad_h, pad_v;
+      Evas_Coord minw, minh, maxw, maxh;
+      Eina_Bool  horizontal : 1;
+      Eina_Bool  homogeneous : 1;
+      Eina_Bool  valid : 1;
+   } extents;
+   Eina_Bool      aspected : 1;
+};
+
+static void
+_box_item_hints_get(Els_Box_Item *it)
+{
+   Evas_Object *obj = it->obj;
+
+   evas_object_size_hint_padding_get
+     (obj, &it->pad_l, &it->pad_r, &it->pad_t, &it->pad_b);
+   evas_object_size_hint_min_get(obj, &it->minw, &it->minh);
+   it->minw += it->pad_l + it->pad_r;
+   it->minh += it->pad_t + it->pad_b;
+   evas_object_size_hint_max_get(obj, &it->maxw, &it->maxh);
+   if (it->maxw >= 0) it->maxw += it->pad_l + it->pad_r;
+   if (it->maxh >= 0) it->maxh += it->pad_t + it->pad_b;
+   evas_object_size_hint_weight_get(obj, &it->wx, &it->wy);
+   evas_object_size_hint_align_get(obj, &it->ax, &it->ay);
+   evas_object_size_hint_aspect_get(obj, &it->aspect, &it->asx, &it->asy);
+   if (it->aspect && ((it->asx < 1) || (it->asy < 1)))
+     {
+        it->aspect = EVAS_ASPECT_CONTROL_NONE;
+        ERR("Invalid aspect specified!");
+     }
+   it->dirty = EINA_FALSE;
+}
+
+static void
+_box_item_hints_changed_cb(void *data,
+                           Evas *e EINA_UNUSED,
+                           Evas_Object *obj EINA_UNUSED,
+                           void *event_info EINA_UNUSED)
+{
+   Els_Box_Item *it = data;
+
+   it->dirty = EINA_TRUE;
+}
+
+static void _box_item_del_cb(void *data, Evas *e, Evas_Object *obj, void *event_info);
+
+static void
+_box_item_free(Els_Box_Item *it)
+{
+   evas_object_event_callback_del_full
+     (it->obj, EVAS_CALLBACK_CHANGED_SIZE_HINTS, _box_item_hints_changed_cb, it);
+   evas_object_event_callback_del_full
+     (it->obj, EVAS_CALLBACK_DEL, _box_item_del_cb, it);
+   eina_hash_del_by_key(it->cache->items, &it->obj);
+   it->cache->extents.valid = EINA_FALSE;
+   free(it);
+}
+
+static void
+_box_item_del_cb(void *data,
+                 Evas *e EINA_UNUSED,
+                 Evas_Object *obj EINA_UNUSED,
+                 void *event_info EINA_UNUSED)
+{
+   _box_item_free(data);
+}
+
+static Eina_Bool
+_box_cache_stale_collect_cb(const Eina_Hash *hash EINA_UNUSED,
+                            const void *key EINA_UNUSED,
+                            void *data,
+                            void *fdata)
+{
+   Els_Box_Item *it = data;
+   Eina_List **stale = fdata;
+
+   if (it->stamp != it->cache->stamp)
+     *stale = eina_list_append(*stale, it);
+   return EINA_TRUE;
+}
+
+static Eina_Bool
+_box_cache_all_collect_cb(const Eina_Hash *hash EINA_UNUSED,
+                          const void *key EINA_UNUSED,
+                          void *data,
+                          void *fdata)
+{
+   Eina_List **all = fdata;
+
+   *all = eina_list_append(*all, data);
+   return EINA_TRUE;
+}
+
+static void
+_box_cache_del_cb(void *data,
+                  Evas *e EINA_UNUSED,
+                  Evas_Object *obj EINA_UNUSED,
+                  void *event_info EINA_UNUSED)
+{
+   Els_Box_Cache *cache = data;
+   Eina_List *all = NULL;
+   Els_Box_Item *it;
+
+   eina_hash_foreach(cache->items, _box_cache_all_collect_cb, &all);
+   EINA_LIST_FREE(all, it)
+     _box_item_free(it);
+   eina_hash_free(cache->items);
+   free(cache->order);
+   free(cache);
+}
+
+static Els_Box_Cache *
+_box_cache_get(Evas_Object *o)
+{
+   Els_Box_Cache *cache;
+
+   cache = evas_object_data_get(o, _box_cache_key);
+   if (cache) return cache;
+
+   cache = calloc(1, sizeof(Els_Box_Cache));
+   if (!cache) return NULL;
+   cache->items = eina_hash_pointer_new(NULL);
+   evas_object_data_set(o, _box_cache_key, cache);
+   evas_object_event_callback_add(o, EVAS_CALLBACK_DEL, _box_cache_del_cb, cache);
+
+   return cache;
+}
+
+/* refresh hints of the children which changed since the last layout and
+ * lay their cached entries out in packing order */
+static Eina_Bool
+_box_cache_sync(Els_Box_Cache *cache, Evas_Object_Box_Data *priv)
+{
+   const Eina_List *l;
+   Evas_Object_Box_Option *opt;
+   Els_Box_Item *it;
+   unsigned int i = 0, count;
+   Eina_Bool changed = EINA_FALSE;
+
+   count = eina_list_count(priv->children);
+   if (count > cache->size)
+     {
+        Els_Box_Item **order;
+
+        order = realloc(cache->order, count * sizeof(Els_Box_Item *));
+        if (!order) return EINA_FALSE;
+        memset(order + cache->size, 0,
+               (count - cache->size) * sizeof(Els_Box_Item *));
+        cache->order = order;
+        cache->size = count;
+     }
+
+   cache->stamp++;
+   cache->aspected = EINA_FALSE;
+   EINA_LIST_FOREACH(priv->children, l, opt)
+     {
+        it = eina_hash_find(cache->items, &opt->obj);
+        if (!it)
+          {
+             it = calloc(1, sizeof(Els_Box_Item));
+             if (!it) return EINA_FALSE;
+             it->cache = cache;
+             it->obj = opt->obj;
+             it->dirty = EINA_TRUE;
+             eina_hash_add(cache->items, &it->obj, it);
+             evas_object_event_callback_add
+               (it->obj, EVAS_CALLBACK_CHANGED_SIZE_HINTS,
+               _box_item_hints_changed_cb, it);
+             evas_object_event_callback_add
+               (it->obj, EVAS_CALLBACK_DEL, _box_item_del_cb, it);
+          }
+        if (it->dirty)
+          {
+             _box_item_hints_get(it);
+             changed = EINA_TRUE;
+          }
+        if (cache->order[i] != it) changed = EINA_TRUE;
+        if (it->aspect) cache->aspected = EINA_TRUE;
+        it->stamp = cache->stamp;
+        cache->order[i++] = it;
+     }
+   if (cache->count != count) changed = EINA_TRUE;
+   cache->count = count;
+
+   /* drop children unpacked since the last layout */
+   if (eina_hash_population(cache->items) > (int)count)
+     {
+        Eina_List *stale = NULL;
+
+        eina_hash_foreach(cache->items, _box_cache_stale_collect_cb, &stale);
+        EINA_LIST_FREE(stale, it)
+          _box_item_free(it);
+     }
+
+   if (changed) cache->extents.valid = EINA_FALSE;
+
+   return EINA_TRUE;
+}
+
 /* calculate an object's aspected size */
 static Eina_Bool
 _box_object_aspect_calc(int *ow, int *oh, int minw, int minh, int maxw, int maxh,
@@ -74,13 +301,13 @@ _box_object_aspect_calc(int *ow, int *oh, int minw, int minh, int maxw, int maxh
 
 /* add box w/h padding to min/max totals */
 static void
-_smart_extents_padding_calc(Evas_Object_Box_Data *priv, int *minw, int *minh, int *maxw, int *maxh, Eina_Bool horizontal)
+_smart_extents_padding_calc(Evas_Object_Box_Data *priv, Els_Box_Cache *cache, int *minw, int *minh, int *maxw, int *maxh, Eina_Bool horizontal)
 {
    int c;
 
    if ((*maxw >= 0) && (*minw > *maxw)) *maxw = *minw;
    if ((*maxh >= 0) && (*minh > *maxh)) *maxh = *minh;
-   c = eina_list_count(priv->children) - 1;
+   c = cache->count - 1;
    if (c > 0)
      {
         if (horizontal)
@@ -100,12 +327,11 @@ _smart_extents_padding_calc(Evas_Object_Box_Data *priv, int *minw, int *minh, in
  * called twice if aspected items exist
  */
 static Eina_Bool
-_smart_extents_non_homogeneous_calc(Evas_Object_Box_Data *priv, int w, int h, int *minw, int *minh, int *maxw, int *maxh, double expand, Eina_Bool horizontal, Eina_Bool do_aspect)
+_smart_extents_non_homogeneous_calc(Els_Box_Cache *cache, int w, int h, int *minw, int *minh, int *maxw, int *maxh, double expand, Eina_Bool horizontal, Eina_Bool do_aspect)
 {
-   const Eina_List *l;
-   Evas_Object_Box_Option *opt;
+   Els_Box_Item *it;
+   unsigned int i;
    int mnw, mnh, mxw, mxh, cminw, cminh;
-   Evas_Coord pad_l, pad_r, pad_t, pad_b;
    Evas_Coord *rw, *rh, *rxw, *rxh, *rminw, *rminh, *rmaxw, *rmaxh;
    Eina_Bool max = EINA_TRUE, asp = EINA_FALSE;
 
@@ -137,35 +363,30 @@ _smart_extents_non_homogeneous_calc(Evas_Object_Box_Data *priv, int w, int h, in
         rmaxw = maxh;
         rmaxh = maxw;
      }
-   EINA_LIST_FOREACH(priv->children, l, opt)
+   for (i = 0; i < cache->count; i++)
      {
-        Evas_Aspect_Control aspect = EVAS_ASPECT_CONTROL_NONE;
+        Evas_Aspect_Control aspect;
         int asx, asy, ow = 0, oh = 0, *rrw, *rrh;
 
+        it = cache->order[i];
         if (!horizontal)
           rrw = &ow, rrh = &oh;
         else
           rrw = &oh, rrh = &ow;
 
-        evas_object_size_hint_padding_get(opt->obj, &pad_l, &pad_r, &pad_t, &pad_b);
-        evas_object_size_hint_min_get(opt->obj, &mnw, &mnh);
-        mnw += pad_l + pad_r;
-        mnh += pad_t + pad_b;
+        mnw = it->minw;
+        mnh = it->minh;
         if (*rminw < *rw) *rminw = *rw;
         *rminh += *rh;
 
-        evas_object_size_hint_aspect_get(opt->obj, &aspect, &asx, &asy);
-        if (aspect && ((asx < 1) || (asy < 1)))
-          {
-             aspect = EVAS_ASPECT_CONTROL_NONE;
-             ERR("Invalid aspect specified!");
-          }
+        aspect = it->aspect;
+        asx = it->asx;
+        asy = it->asy;
         /* return whether any aspected items exist */
         asp |= !!aspect;
 
-        evas_object_size_hint_max_get(opt->obj, &mxw, &mxh);
-        if (mxw >= 0) mxw += pad_l + pad_r;
-        if (mxh >= 0) mxh += pad_t + pad_b;
+        mxw = it->maxw;
+        mxh = it->maxh;
         if (*rxh < 0)
           {
              *rmaxh = -1;
@@ -176,9 +397,7 @@ _smart_extents_non_homogeneous_calc(Evas_Object_Box_Data *priv, int w, int h, in
         if (do_aspect && aspect)
           {
              int ww, hh, fw = 0, fh = 0;
-             double wx, wy, ax, ay;
-
-             evas_object_size_hint_weight_get(opt->obj, &wx, &wy);
+             double wx = it->wx, wy = it->wy;
 
              if (horizontal)
                {
@@ -202,9 +421,8 @@ _smart_extents_non_homogeneous_calc(Evas_Object_Box_Data *priv, int w, int h, in
                     }
                   ww = w;
                }
-             evas_object_size_hint_align_get(opt->obj, &ax, &ay);
-             if (ax < 0) fw = 1;
-             if (ay < 0) fh = 1;
+             if (it->ax < 0) fw = 1;
+             if (it->ay < 0) fh = 1;
 
              /* if aspecting succeeds, use aspected size for min size */
              if (_box_object_aspect_calc(&ow, &oh, mnw, mnh, mxw, mxh,
@@ -224,47 +442,57 @@ _smart_extents_non_homogeneous_calc(Evas_Object_Box_Data *priv, int w, int h, in
 }
 
 static void
-_smart_extents_calculate(Evas_Object *box, Evas_Object_Box_Data *priv, int w, int h, double expand, Eina_Bool horizontal, Eina_Bool homogeneous)
+_smart_extents_calculate(Evas_Object *box, Evas_Object_Box_Data *priv, Els_Box_Cache *cache, int w, int h, double expand, Eina_Bool horizontal, Eina_Bool homogeneous)
 {
    Evas_Coord minw, minh, mnw, mnh, maxw, maxh;
-   Evas_Coord pad_l, pad_r, pad_t, pad_b;
-   const Eina_List *l;
-   Evas_Object_Box_Option *opt;
+   Els_Box_Item *it;
+   unsigned int i;
    int c;
 
+   /* children hints, box padding and flags did not change: the box size
+    * only matters when aspected children exist */
+   if ((cache->extents.valid) &&
+       (cache->extents.horizontal == !!horizontal) &&
+       (cache->extents.homogeneous == !!homogeneous) &&
+       (cache->extents.pad_h == priv->pad.h) &&
+       (cache->extents.pad_v == priv->pad.v) &&
+       ((!cache->aspected) ||
+        ((cache->extents.w == w) && (cache->extents.h == h))))
+     {
+        evas_object_size_hint_min_set
+          (box, cache->extents.minw, cache->extents.minh);
+        evas_object_size_hint_max_set
+          (box, cache->extents.maxw, cache->extents.maxh);
+        return;
+     }
+
    minw = 0;
    minh = 0;
    maxw = -1;
    maxh = -1;
-   c = eina_list_count(priv->children);
+   c = cache->count;
    if (homogeneous)
      {
         Evas_Aspect_Control paspect = -1; //causes overflow
         int pasx = -1, pasy = -1;
 
-        EINA_LIST_FOREACH(priv->children, l, opt)
+        for (i = 0; i < cache->count; i++)
           {
-             Evas_Aspect_Control aspect = EVAS_ASPECT_CONTROL_NONE;
-             int asx, asy, ow = 0, oh = 0, fw, fh, ww, hh;
-             double ax, ay;
-
-             evas_object_size_hint_align_get(opt->obj, &ax, &ay);
-             if (ax < 0) fw = 1;
-             if (ay < 0) fh = 1;
-
-             evas_object_size_hint_padding_get(opt->obj, &pad_l, &pad_r, &pad_t, &pad_b);
-             evas_object_size_hint_min_get(opt->obj, &mnw, &mnh);
-             mnw += pad_l + pad_r;
-             mnh += pad_t + pad_b;
+             Evas_Aspect_Control aspect;
+             int asx, asy, ow = 0, oh = 0, fw = 0, fh = 0, ww, hh;
+
+             it = cache->order[i];
+             if (it->ax < 0) fw = 1;
+             if (it->ay < 0) fh = 1;
+
+             mnw = it->minw;
+             mnh = it->minh;
              if (minh < mnh) minh = mnh;
              if (minw < mnw) minw = mnw;
 
-             evas_object_size_hint_aspect_get(opt->obj, &aspect, &asx, &asy);
-             if (aspect && ((asx < 1) || (asy < 1)))
-               {
-                  aspect = EVAS_ASPECT_CONTROL_NONE;
-                  ERR("Invalid aspect specified!");
-               }
+             aspect = it->aspect;
+             asx = it->asx;
+             asy = it->asy;
              if (paspect < 100) //value starts overflowed as UINT_MAX
                {
                   /* this condition can cause some items to not be the same size,
@@ -274,16 +502,15 @@ _smart_extents_calculate(Evas_Object *box, Evas_Object_Box_Data *priv, int w, in
                     ERR("Homogeneous box with differently-aspected items!");
                }
 
-             evas_object_size_hint_max_get(opt->obj, &mnw, &mnh);
+             mnw = it->maxw;
+             mnh = it->maxh;
              if (mnh >= 0)
                {
-                  if (mnh >= 0) mnh += pad_t + pad_b;
                   if (maxh == -1) maxh = mnh;
                   else if (maxh > mnh) maxh = mnh;
                }
              if (mnw >= 0)
                {
-                  if (mnw >= 0) mnw += pad_l + pad_r;
                   if (maxw == -1) maxw = mnw;
                   else if (maxw > mnw) maxw = mnw;
                }
@@ -328,46 +555,58 @@ _smart_extents_calculate(Evas_Object *box, Evas_Object_Box_Data *priv, int w, in
    else
      {
         /* returns true if at least one item has aspect hint */
-        if (_smart_extents_non_homogeneous_calc(priv, w, h, &minw, &minh, &maxw, &maxh, expand, horizontal, 0))
+        if (_smart_extents_non_homogeneous_calc(cache, w, h, &minw, &minh, &maxw, &maxh, expand, horizontal, 0))
           {
              /* aspect can only be accurately calculated after the full (non-aspected) min size of the box has
               * been calculated due to the use of this min size during aspect calculations
               */
-             _smart_extents_padding_calc(priv, &minw, &minh, &maxw, &maxh, horizontal);
-             _smart_extents_non_homogeneous_calc(priv, w, h, &minw, &minh, &maxw, &maxh, expand, horizontal, 1);
+             _smart_extents_padding_calc(priv, cache, &minw, &minh, &maxw, &maxh, horizontal);
+             _smart_extents_non_homogeneous_calc(cache, w, h, &minw, &minh, &maxw, &maxh, expand, horizontal, 1);
           }
      }
-   _smart_extents_padding_calc(priv, &minw, &minh, &maxw, &maxh, horizontal);
+   _smart_extents_padding_calc(priv, cache, &minw, &minh, &maxw, &maxh, horizontal);
    evas_object_size_hint_min_set(box, minw, minh);
    evas_object_size_hint_max_set(box, maxw, maxh);
+
+   cache->extents.w = w;
+   cache->extents.h = h;
+   cache->extents.pad_h = priv->pad.h;
+   cache->extents.pad_v = priv->pad.v;
+   cache->extents.horizontal = !!horizontal;
+   cache->extents.homogeneous = !!homogeneous;
+   cache->extents.minw = minw;
+   cache->extents.minh = minh;
+   cache->extents.maxw = maxw;
+   cache->extents.maxh = maxh;
+   cache->extents.valid = EINA_TRUE;
 }
 
 void
 _els_box_layout(Evas_Object *o, Evas_Object_Box_Data *priv, Eina_Bool horizontal, Eina_Bool homogeneous, Eina_Bool rtl)
 {
    Evas_Coord x, y, w, h, xx, yy;
-   const Eina_List *l;
    Evas_Object *obj;
    Evas_Coord minw, minh;
    int count = 0;
    double expand = 0.0;
    double ax, ay;
    double wx, wy;
-   double *rwy;
-   Evas_Object_Box_Option *opt;
+   Els_Box_Cache *cache;
+   Els_Box_Item *it;
+   unsigned int i;
+
+   cache = _box_cache_get(o);
+   if ((!cache) || (!_box_cache_sync(cache, priv))) return;
 
    evas_object_geometry_get(o, &x, &y, &w, &h);
    /* accummulate expand after switched x and y for horizontal mode */
-   if (!horizontal)
-     rwy = &wy;
-   else
-     rwy = &wx;
-   EINA_LIST_FOREACH(priv->children, l, opt)
+   for (i = 0; i < cache->count; i++)
      {
-        evas_object_size_hint_weight_get(opt->obj, &wx, &wy);
-        if (*rwy > 0.0) expand += *rwy;
+        it = cache->order[i];
+        wy = horizontal ? it->wx : it->wy;
+        if (wy > 0.0) expand += wy;
      }
-   _smart_extents_calculate(o, priv, w, h, expand, horizontal, homogeneous);
+   _smart_extents_calculate(o, priv, cache, w, h, expand, horizontal, homogeneous);
    evas_object_geometry_get(o, &x, &y, &w, &h);
 
    evas_object_size_hint_min_get(o, &minw, &minh);
@@ -383,7 +622,7 @@ _els_box_layout(Evas_Object *o, Evas_Object_Box_Data *priv, Eina_Bool horizontal
         y = y + ((h - minh) * (1.0 - ay));
         h = minh;
      }
-   count = eina_list_count(priv->children);
+   count = cache->count;
 
    if (!expand)
      {
@@ -401,27 +640,31 @@ _els_box_layout(Evas_Object *o, Evas_Object_Box_Data *priv, Eina_Bool horizontal
      }
    xx = x;
    yy = y;
-   EINA_LIST_FOREACH(priv->children, l, opt)
+   for (i = 0; i < cache->count; i++)
      {
         Evas_Coord mnw, mnh, mxw, mxh;
         Evas_Coord pad_l, pad_r, pad_t, pad_b;
         int fw, fh, xw, xh;//fillw, fillw, expandw, expandh
-        Evas_Aspect_Control aspect = EVAS_ASPECT_CONTROL_NONE;
+        Evas_Aspect_Control aspect;
         int asx, asy;
 
-        obj = opt->obj;
-        evas_object_size_hint_align_get(obj, &ax, &ay);
-        evas_object_size_hint_weight_get(obj, &wx, &wy);
-        evas_object_size_hint_padding_get(obj, &pad_l, &pad_r, &pad_t, &pad_b);
-        evas_object_size_hint_min_get(obj, &mnw, &mnh);
-        mnw += pad_l + pad_r;
-        mnh += pad_t + pad_b;
-        evas_object_size_hint_max_get(obj, &mxw, &mxh);
-        if (mxw >= 0) mxw += pad_l + pad_r;
-        if (mxh >= 0) mxh += pad_t + pad_b;
-        evas_object_size_hint_aspect_get(obj, &aspect, &asx, &asy);
-        if (aspect && ((asx < 1) || (asy < 1)))
-          aspect = EVAS_ASPECT_CONTROL_NONE;
+        it = cache->order[i];
+        obj = it->obj;
+        ax = it->ax;
+        ay = it->ay;
+        wx = it->wx;
+        wy = it->wy;
+        pad_l = it->pad_l;
+        pad_r = it->pad_r;
+        pad_t = it->pad_t;
+        pad_b = it->pad_b;
+        mnw = it->minw;
+        mnh = it->minh;
+        mxw = it->maxw;
+        mxh = it->maxh;
+        aspect = it->aspect;
+        asx = it->asx;
+        asy = it->asy;
         fw = fh = 0;
         xw = xh = 0;
         /* align(-1) means fill to maximum apportioned size */
@@ -78,6 +78,7 @@ static const Elementary_Test_Case etc[] = {
   { "elm_slideshow", elm_test_slideshow},
   { "elm_spinner", elm_test_spinner},
   { "elm_plug", elm_test_plug},
+  { "elm_cnp", elm_test_cnp},
   { NULL, NULL }
 };
 
@@ -0,0 +1,318 @@
+#ifdef HAVE_CONFIG_H
+# include "elementary_config.h"
+#endif
+
+#define ELM_INTERNAL_API_ARGESFSDFEFC
+
+#include <Elementary.h>
+#include "elm_priv.h"
+#include "elm_suite.h"
+
+typedef struct _Stream_Test Stream_Test;
+
+struct _Stream_Test
+{
+   Eina_Strbuf *buf;
+   unsigned int chunks;
+   Eina_Bool    done : 1;
+   Eina_Bool    stop : 1;
+};
+
+static Eina_Bool
+_stream_cb(void *data, Evas_Object *obj EINA_UNUSED,
+           Elm_Selection_Data *ev, Eina_Bool last)
+{
+   Stream_Test *t = data;
+
+   if (last)
+     {
+        t->done = EINA_TRUE;
+        ecore_main_loop_quit();
+        return EINA_TRUE;
+     }
+   ck_assert_int_eq(ev->format, ELM_SEL_FORMAT_MARKUP);
+   eina_strbuf_append_length(t->buf, ev->data, strlen(ev->data));
+   t->chunks++;
+   return !t->stop;
+}
+
+static Eina_Bool
+_quit_cb(void *data EINA_UNUSED)
+{
+   ecore_main_loop_quit();
+   return ECORE_CALLBACK_CANCEL;
+}
+
+static char *
+_big_text_new(size_t *len)
+{
+   Eina_Strbuf *buf = eina_strbuf_new();
+   char *text;
+   int i;
+
+   for (i = 0; i < 8000; i++)
+     eina_strbuf_append_printf(buf, "line %d: a<b & c>d \xc3\xa9t\xc3\xa9\t\n", i);
+   *len = eina_strbuf_length_get(buf);
+   text = eina_strbuf_string_steal(buf);
+   eina_strbuf_free(buf);
+   return text;
+}
+
+START_TEST (elm_cnp_stream_chunks)
+{
+   Evas_Object *win;
+   Stream_Test t = { NULL, 0, EINA_FALSE, EINA_FALSE };
+   char *text, *markup;
+   size_t len;
+
+   elm_init(1, NULL);
+   win = elm_win_add(NULL, "cnp", ELM_WIN_BASIC);
+
+   text = _big_text_new(&len);
+   ck_assert(elm_cnp_selection_set(win, ELM_SEL_TYPE_CLIPBOARD,
+                                   ELM_SEL_FORMAT_TEXT, text, len));
+
+   t.buf = eina_strbuf_new();
+   ck_assert(elm_cnp_selection_stream_get(win, ELM_SEL_TYPE_CLIPBOARD,
+                                          ELM_SEL_FORMAT_TEXT,
+                                          ELM_SEL_FORMAT_MARKUP,
+                                          _stream_cb, &t));
+   ecore_timer_add(10.0, _quit_cb, NULL);
+   elm_run();
+
+   ck_assert(t.done);
+   ck_assert(t.chunks > 1);
+   markup = elm_entry_utf8_to_markup(text);
+   ck_assert_str_eq(eina_strbuf_string_get(t.buf), markup);
+
+   free(markup);
+   free(text);
+   eina_strbuf_free(t.buf);
+   elm_shutdown();
+}
+END_TEST
+
+START_TEST (elm_cnp_stream_stop)
+{
+   Evas_Object *win;
+   Stream_Test t = { NULL, 0, EINA_FALSE, EINA_TRUE };
+   char *text;
+   size_t len;
+
+   elm_init(1, NULL);
+   win = elm_win_add(NULL, "cnp", ELM_WIN_BASIC);
+
+   text = _big_text_new(&len);
+   elm_cnp_selection_set(win, ELM_SEL_TYPE_CLIPBOARD,
+                         ELM_SEL_FORMAT_TEXT, text, len);
+
+   t.buf = eina_strbuf_new();
+   elm_cnp_selection_stream_get(win, ELM_SEL_TYPE_CLIPBOARD,
+                                ELM_SEL_FORMAT_TEXT, ELM_SEL_FORMAT_MARKUP,
+                                _stream_cb, &t);
+   ecore_timer_add(0.5, _quit_cb, NULL);
+   elm_run();
+
+   ck_assert_int_eq(t.chunks, 1);
+   ck_assert(!t.done);
+
+   free(text);
+   eina_strbuf_free(t.buf);
+   elm_shutdown();
+}
+END_TEST
+
+START_TEST (elm_cnp_stream_pieces)
+{
+   Evas_Object *win;
+   Stream_Test t = { NULL, 0, EINA_FALSE, EINA_FALSE };
+   Elm_Selection_Data ev;
+   char *text, *markup;
+   size_t len, pos, piece;
+
+   elm_init(1, NULL);
+   win = elm_win_add(NULL, "cnp", ELM_WIN_BASIC);
+
+   text = _big_text_new(&len);
+   t.buf = eina_strbuf_new();
+
+   /* pieces of odd sizes, as they are read: characters and lines get
+    * cut in two between pieces */
+   memset(&ev, 0, sizeof(ev));
+   ev.format = ELM_SEL_FORMAT_TEXT;
+   for (pos = 0; pos < len; pos += piece)
+     {
+        piece = MIN((size_t)7777, len - pos);
+        ev.data = text + pos;
+        ev.len = piece;
+        ck_assert(_elm_cnp_selection_piece_stream(win, &ev,
+                                                  ELM_SEL_FORMAT_MARKUP,
+                                                  _stream_cb, &t));
+        /* some of them while streaming already */
+        if ((pos / 7777) % 8 == 0) ecore_main_loop_iterate();
+     }
+   ck_assert(!t.done);
+   _elm_cnp_selection_pieces_end(win);
+   ecore_timer_add(10.0, _quit_cb, NULL);
+   elm_run();
+
+   ck_assert(t.done);
+   ck_assert(t.chunks > 1);
+   markup = elm_entry_utf8_to_markup(text);
+   ck_assert_str_eq(eina_strbuf_string_get(t.buf), markup);
+
+   free(markup);
+   free(text);
+   eina_strbuf_free(t.buf);
+   elm_shutdown();
+}
+END_TEST
+
+static Evas_Object *
+_drop_rect_add(Evas_Object *win, Evas_Coord x, Evas_Coord y,
+               Evas_Coord w, Evas_Coord h, Eina_Bool visible)
+{
+   Evas_Object *rect = evas_object_rectangle_add(evas_object_evas_get(win));
+
+   evas_object_geometry_set(rect, x, y, w, h);
+   if (visible) evas_object_show(rect);
+   ck_assert(_elm_drop_target_index_add(rect));
+   return rect;
+}
+
+START_TEST (elm_cnp_drop_index)
+{
+   Evas_Object *win, *tall, *small, *hidden, *low;
+   Evas *evas;
+
+   elm_init(1, NULL);
+   win = elm_win_add(NULL, "cnp", ELM_WIN_BASIC);
+   evas = evas_object_evas_get(win);
+
+   tall = _drop_rect_add(win, 0, 0, 50, 300, EINA_TRUE);
+   small = _drop_rect_add(win, 100, 100, 50, 50, EINA_TRUE);
+   hidden = _drop_rect_add(win, 200, 200, 50, 50, EINA_FALSE);
+   low = _drop_rect_add(win, 300, 350, 50, 20, EINA_TRUE);
+
+   /* reached past the top of small, as tall is taller than the gap */
+   ck_assert(_elm_drop_target_hit(evas, 10, 250));
+   ck_assert(_elm_drop_target_hit(evas, 120, 120));
+   ck_assert(!_elm_drop_target_hit(evas, 120, 160));
+   ck_assert(!_elm_drop_target_hit(evas, 210, 210));
+   ck_assert(!_elm_drop_target_hit(evas, 10, 310));
+   ck_assert(_elm_drop_target_hit(evas, 310, 360));
+   ck_assert(!_elm_drop_target_hit(evas, 310, 340));
+
+   evas_object_show(hidden);
+   ck_assert(_elm_drop_target_hit(evas, 210, 210));
+
+   evas_object_move(small, 100, 10);
+   ck_assert(!_elm_drop_target_hit(evas, 120, 120));
+   ck_assert(_elm_drop_target_hit(evas, 120, 30));
+
+   /* the tallest height bounds the walk back */
+   evas_object_resize(tall, 50, 100);
+   ck_assert(!_elm_drop_target_hit(evas, 10, 250));
+   ck_assert(_elm_drop_target_hit(evas, 10, 50));
+
+   evas_object_del(low);
+   ck_assert(!_elm_drop_target_hit(evas, 310, 360));
+
+   elm_shutdown();
+}
+END_TEST
+
+typedef struct _Item_Hit_Test Item_Hit_Test;
+
+struct _Item_Hit_Test
+{
+   Elm_Object_Item *item; /* what the pointer is over */
+   Elm_Object_Item *got; /* what the position callback was given */
+   unsigned int     lookups;
+};
+
+static Elm_Object_Item *
+_item_get_cb(Evas_Object *obj, Evas_Coord x EINA_UNUSED,
+             Evas_Coord y EINA_UNUSED, int *xposret, int *yposret)
+{
+   Item_Hit_Test *t = evas_object_data_get(obj, "item_hit_test");
+
+   t->lookups++;
+   if (xposret) *xposret = 0;
+   if (yposret) *yposret = 0;
+   return t->item;
+}
+
+static void
+_item_pos_cb(void *data, Evas_Object *cont EINA_UNUSED, Elm_Object_Item *it,
+             Evas_Coord x EINA_UNUSED, Evas_Coord y EINA_UNUSED,
+             int xposret EINA_UNUSED, int yposret EINA_UNUSED,
+             Elm_Xdnd_Action action EINA_UNUSED)
+{
+   Item_Hit_Test *t = data;
+
+   t->got = it;
+}
+
+START_TEST (elm_cnp_drop_item_hit_cache)
+{
+   Evas_Object *win, *list, *cont;
+   Item_Hit_Test t = { NULL, NULL, 0 };
+   Evas *evas;
+
+   elm_init(1, NULL);
+   win = elm_win_add(NULL, "cnp", ELM_WIN_BASIC);
+   evas = evas_object_evas_get(win);
+
+   list = elm_list_add(win);
+   t.item = elm_list_item_append(list, "item", NULL, NULL, NULL, NULL);
+
+   cont = evas_object_rectangle_add(evas);
+   evas_object_geometry_set(cont, 10, 10, 100, 100);
+   evas_object_show(cont);
+   evas_object_data_set(cont, "item_hit_test", &t);
+   ck_assert(elm_drop_item_container_add(cont, ELM_SEL_FORMAT_TEXT,
+                                         _item_get_cb, NULL, NULL, NULL, NULL,
+                                         _item_pos_cb, &t, NULL, NULL));
+
+   /* same spot within a frame, looked up once */
+   _elm_drop_item_container_pos(cont, 30, 30, ELM_XDND_ACTION_MOVE);
+   _elm_drop_item_container_pos(cont, 30, 30, ELM_XDND_ACTION_MOVE);
+   ck_assert_int_eq(t.lookups, 1);
+   ck_assert_ptr_eq(t.got, t.item);
+
+   _elm_drop_item_container_pos(cont, 40, 40, ELM_XDND_ACTION_MOVE);
+   _elm_drop_item_container_pos(cont, 40, 40, ELM_XDND_ACTION_MOVE);
+   ck_assert_int_eq(t.lookups, 2);
+
+   /* items may have moved once rendered */
+   evas_event_callback_call(evas, EVAS_CALLBACK_RENDER_POST, NULL);
+   _elm_drop_item_container_pos(cont, 40, 40, ELM_XDND_ACTION_MOVE);
+   ck_assert_int_eq(t.lookups, 3);
+   ck_assert_ptr_eq(t.got, t.item);
+
+   /* a deleted item is not handed out, but looked up again */
+   elm_object_item_del(t.item);
+   t.item = NULL;
+   _elm_drop_item_container_pos(cont, 40, 40, ELM_XDND_ACTION_MOVE);
+   ck_assert_int_eq(t.lookups, 4);
+   ck_assert_ptr_eq(t.got, NULL);
+
+   /* and no item under the pointer is kept too */
+   _elm_drop_item_container_pos(cont, 40, 40, ELM_XDND_ACTION_MOVE);
+   ck_assert_int_eq(t.lookups, 4);
+   ck_assert_ptr_eq(t.got, NULL);
+
+   ck_assert(elm_drop_item_container_del(cont));
+   elm_shutdown();
+}
+END_TEST
+
+void elm_test_cnp(TCase *tc)
+{
+   tcase_add_test(tc, elm_cnp_stream_chunks);
+   tcase_add_test(tc, elm_cnp_stream_stop);
+   tcase_add_test(tc, elm_cnp_drop_index);
+   tcase_add_test(tc, elm_cnp_drop_item_hit_cache);
+   tcase_add_test(tc, elm_cnp_stream_pieces);
+}
@@ -347,6 +347,178 @@ START_TEST (elm_atspi_role_get)
 }
 END_TEST
 
+static Eina_Bool
+_windowed_quit_cb(void *data EINA_UNUSED)
+{
+   ecore_main_loop_quit();
+   return ECORE_CALLBACK_CANCEL;
+}
+
+START_TEST (elm_entry_windowed)
+{
+   Evas_Object *win, *entry;
+   Eina_Strbuf *buf;
+   const char *laid;
+   int i;
+
+   elm_init(1, NULL);
+   win = elm_win_add(NULL, "entry", ELM_WIN_BASIC);
+   evas_object_resize(win, 200, 200);
+   evas_object_show(win);
+
+   entry = elm_entry_add(win);
+   evas_object_resize(entry, 200, 200);
+   evas_object_show(entry);
+
+   buf = eina_strbuf_new();
+   for (i = 0; i < 5000; i++)
+     eina_strbuf_append_printf(buf, "line %d<br/>", i);
+
+   elm_entry_windowed_set(entry, EINA_TRUE);
+   ck_assert(elm_entry_windowed_get(entry));
+   ck_assert(elm_entry_scrollable_get(entry));
+   ck_assert(!elm_entry_editable_get(entry));
+
+   elm_object_text_set(entry, eina_strbuf_string_get(buf));
+   ecore_timer_add(0.2, _windowed_quit_cb, NULL);
+   elm_run();
+
+   /* only what is around the viewport is laid out */
+   ck_assert_str_eq(elm_object_text_get(entry), eina_strbuf_string_get(buf));
+   laid = evas_object_textblock_text_markup_get(elm_entry_textblock_get(entry));
+   ck_assert(strlen(laid) < eina_strbuf_length_get(buf) / 10);
+
+   elm_entry_entry_append(entry, "last");
+   eina_strbuf_append(buf, "last");
+   ck_assert_str_eq(elm_object_text_get(entry), eina_strbuf_string_get(buf));
+
+   /* a break split over two appends */
+   elm_entry_entry_append(entry, "<b");
+   elm_entry_entry_append(entry, "r/>tail");
+   eina_strbuf_append(buf, "<br/>tail");
+   ck_assert_str_eq(elm_object_text_get(entry), eina_strbuf_string_get(buf));
+   ck_assert(!elm_entry_is_empty(entry));
+
+   /* editing turns it off, with the whole text back in the textblock */
+   elm_entry_editable_set(entry, EINA_TRUE);
+   ck_assert(!elm_entry_windowed_get(entry));
+   ck_assert_str_eq(elm_object_text_get(entry), eina_strbuf_string_get(buf));
+
+   eina_strbuf_free(buf);
+   elm_shutdown();
+}
+END_TEST
+
+START_TEST (elm_entry_recalc_coalesced)
+{
+   Evas_Object *win, *entry;
+   unsigned int before, calcs;
+   int i;
+
+   elm_init(1, NULL);
+   win = elm_win_add(NULL, "entry", ELM_WIN_BASIC);
+   evas_object_resize(win, 200, 200);
+   evas_object_show(win);
+
+   entry = elm_entry_add(win);
+   elm_entry_scrollable_set(entry, EINA_TRUE);
+   evas_object_resize(entry, 200, 200);
+   evas_object_show(entry);
+   evas_smart_objects_calculate(evas_object_evas_get(win));
+
+   /* edits within a frame only mark the entry dirty */
+   elm_entry_recalc_stats_get(entry, &before, NULL);
+   for (i = 0; i < 20; i++)
+     elm_entry_entry_insert(entry, "text<br/>");
+   elm_entry_recalc_stats_get(entry, &calcs, NULL);
+   ck_assert_int_eq(calcs, before);
+
+   evas_smart_objects_calculate(evas_object_evas_get(win));
+   elm_entry_recalc_stats_get(entry, &calcs, NULL);
+   ck_assert(calcs > before);
+   ck_assert(calcs - before < 20);
+
+   /* calc_force is still done right away */
+   before = calcs;
+   elm_entry_calc_force(entry);
+   elm_entry_recalc_stats_get(entry, &calcs, NULL);
+   ck_assert_int_eq(calcs, before + 1);
+
+   elm_shutdown();
+}
+END_TEST
+
+START_TEST (elm_entry_markup_filters)
+{
+   Evas_Object *win, *entry;
+   Elm_Entry_Filter_Limit_Size limit = { 6, 0 };
+   Elm_Entry_Filter_Accept_Set accept = { "0123456789", NULL };
+   char *text;
+
+   elm_init(1, NULL);
+   win = elm_win_add(NULL, "entry", ELM_WIN_BASIC);
+
+   /* called directly */
+   entry = elm_entry_add(win);
+   elm_object_text_set(entry, "abcd");
+   text = strdup("ef<br/>gh");
+   elm_entry_filter_limit_size(&limit, entry, &text);
+   ck_assert_str_eq(text, "ef");
+   free(text);
+
+   text = strdup("a1b&amp;2");
+   elm_entry_filter_accept_set(&accept, entry, &text);
+   ck_assert_str_eq(text, "12");
+   free(text);
+
+   /* new line, accept and limit filters in one pass */
+   entry = elm_entry_add(win);
+   elm_entry_single_line_set(entry, EINA_TRUE);
+   limit.max_char_count = 3;
+   elm_entry_markup_filter_append(entry, elm_entry_filter_accept_set, &accept);
+   elm_entry_markup_filter_append(entry, elm_entry_filter_limit_size, &limit);
+   elm_entry_entry_insert(entry, "1a<br/>2b34");
+   ck_assert_str_eq(evas_object_textblock_text_markup_get
+                    (elm_entry_textblock_get(entry)), "123");
+
+   elm_shutdown();
+}
+END_TEST
+
+START_TEST (elm_entry_limit_size_queued)
+{
+   Evas_Object *win, *entry, *edje;
+   Elm_Entry_Filter_Limit_Size limit = { 5, 0 };
+
+   elm_init(1, NULL);
+   win = elm_win_add(NULL, "entry", ELM_WIN_BASIC);
+
+   entry = elm_entry_add(win);
+   edje = elm_layout_edje_get(entry);
+   elm_entry_markup_filter_append(entry, elm_entry_filter_limit_size, &limit);
+   elm_object_text_set(entry, "abc");
+   elm_entry_cursor_end_set(entry);
+
+   /* two user inserts before their signals get delivered: the second
+    * one has to see the first */
+   edje_object_part_text_user_insert(edje, "elm.text", "d");
+   edje_object_part_text_user_insert(edje, "elm.text", "ef");
+   ck_assert_str_eq(elm_object_text_get(entry), "abcde");
+
+   /* and the signals, once delivered, don't count them twice */
+   edje_message_signal_process();
+   ecore_main_loop_iterate();
+   /* the filter keeps its own copy of the limit */
+   elm_entry_markup_filter_remove(entry, elm_entry_filter_limit_size, &limit);
+   limit.max_char_count = 6;
+   elm_entry_markup_filter_append(entry, elm_entry_filter_limit_size, &limit);
+   edje_object_part_text_user_insert(edje, "elm.text", "gh");
+   ck_assert_str_eq(elm_object_text_get(entry), "abcdeg");
+
+   elm_shutdown();
+}
+END_TEST
+
 void elm_test_entry(TCase *tc)
 {
    tcase_add_test(tc, elm_entry_del);
@@ -359,4 +531,8 @@ void elm_test_entry(TCase *tc)
    tcase_add_test(tc, elm_entry_atspi_text_text_get);
    tcase_add_test(tc, elm_entry_atspi_text_selections);
    tcase_add_test(tc, elm_atspi_role_get);
+   tcase_add_test(tc, elm_entry_windowed);
+   tcase_add_test(tc, elm_entry_recalc_coalesced);
+   tcase_add_test(tc, elm_entry_markup_filters);
+   tcase_add_test(tc, elm_entry_limit_size_queued);
 }
@@ -2,8 +2,11 @@
 # include "elementary_config.h"
 #endif
 
+#define ELM_INTERNAL_API_ARGESFSDFEFC
 #define ELM_INTERFACE_ATSPI_ACCESSIBLE_PROTECTED
 #include <Elementary.h>
+#include "elm_priv.h"
+#include "elm_widget_gengrid.h"
 #include "elm_suite.h"
 #include "elm_test_helper.h"
 
@@ -74,9 +77,112 @@ START_TEST(elm_atspi_children_parent)
 END_TEST
 #endif
 
+static void
+_flag_set_cb(void *data, Evas_Object *obj EINA_UNUSED,
+             void *event_info EINA_UNUSED)
+{
+   *(Eina_Bool *)data = EINA_TRUE;
+}
+
+static Eina_Bool
+_flag_timer_cb(void *data)
+{
+   *(Eina_Bool *)data = EINA_TRUE;
+   return ECORE_CALLBACK_CANCEL;
+}
+
+static void
+_item_view_pos_get(Elm_Object_Item *eo_it, Evas_Coord *x, Evas_Coord *y)
+{
+   ELM_GENGRID_ITEM_DATA_GET(eo_it, it);
+
+   evas_object_geometry_get(VIEW(it), x, y, NULL, NULL);
+}
+
+START_TEST (elm_gengrid_drag_reorder)
+{
+   static Elm_Gengrid_Item_Class itc;
+   Evas_Object *win, *gengrid;
+   Elm_Gengrid_Data *sd;
+   Elm_Object_Item *items[9], *eo_it;
+   Evas_Coord cx[3], cy[3], x, y;
+   Eina_Bool longpressed = EINA_FALSE, slid = EINA_FALSE;
+   Evas *evas;
+   int i;
+   static const int order[] = { 1, 2, 0, 3, 4, 5, 6, 7, 8 };
+
+   elm_init(1, NULL);
+   elm_config_longpress_timeout_set(0.1);
+   win = elm_win_add(NULL, "gengrid", ELM_WIN_BASIC);
+   evas_object_resize(win, 300, 300);
+   evas = evas_object_evas_get(win);
+
+   gengrid = elm_gengrid_add(win);
+   evas_object_resize(gengrid, 300, 300);
+   elm_gengrid_item_size_set(gengrid, 100, 100);
+   elm_gengrid_reorder_mode_set(gengrid, EINA_TRUE);
+   evas_object_smart_callback_add(gengrid, "longpressed",
+                                  _flag_set_cb, &longpressed);
+
+   itc.item_style = "default";
+   for (i = 0; i < 9; i++)
+     items[i] = elm_gengrid_item_append(gengrid, &itc,
+                                        (void *)(uintptr_t)i, NULL, NULL);
+
+   evas_object_show(gengrid);
+   evas_object_show(win);
+   ecore_main_loop_iterate();
+   evas_smart_objects_calculate(evas);
+
+   sd = eo_data_scope_get(gengrid, ELM_GENGRID_CLASS);
+   for (i = 0; i < 3; i++)
+     _item_view_pos_get(items[i], &cx[i], &cy[i]);
+
+   /* hold the first item, then drag it onto the third cell */
+   evas_event_feed_mouse_move(evas, cx[0] + 50, cy[0] + 50, 0, NULL);
+   evas_event_feed_mouse_down(evas, 1, EVAS_BUTTON_NONE, 0, NULL);
+   ck_assert(elm_test_helper_wait_flag(2.0, &longpressed));
+   ck_assert_ptr_eq(EO_OBJ(sd->reorder_it), items[0]);
+   for (i = 1; i <= 4; i++)
+     evas_event_feed_mouse_move(evas, cx[0] + 50 + (i * (cx[2] - cx[0]) / 4),
+                                cy[0] + 50, 0, NULL);
+   evas_event_feed_mouse_up(evas, 1, EVAS_BUTTON_NONE, 0, NULL);
+
+   i = 0;
+   for (eo_it = elm_gengrid_first_item_get(gengrid); eo_it;
+        eo_it = elm_gengrid_item_next_get(eo_it))
+     {
+        ck_assert(i < 9);
+        ck_assert_int_eq((uintptr_t)elm_object_item_data_get(eo_it),
+                         order[i++]);
+     }
+   ck_assert_int_eq(i, 9);
+
+   /* the displaced items finish their way to their cells */
+   ck_assert(sd->reorder_move.animator != NULL);
+   ecore_timer_add(1.0, _flag_timer_cb, &slid);
+   ck_assert(elm_test_helper_wait_flag(3.0, &slid));
+   ck_assert(sd->reorder_move.animator == NULL);
+   ck_assert(!sd->reorder_move.items);
+
+   _item_view_pos_get(items[1], &x, &y);
+   ck_assert_int_eq(x, cx[0]);
+   ck_assert_int_eq(y, cy[0]);
+   _item_view_pos_get(items[2], &x, &y);
+   ck_assert_int_eq(x, cx[1]);
+   ck_assert_int_eq(y, cy[1]);
+   _item_view_pos_get(items[0], &x, &y);
+   ck_assert_int_eq(x, cx[2]);
+   ck_assert_int_eq(y, cy[2]);
+
+   elm_shutdown();
+}
+END_TEST
+
 void elm_test_gengrid(TCase *tc)
 {
    tcase_add_test(tc, elm_atspi_role_get);
+   tcase_add_test(tc, elm_gengrid_drag_reorder);
 #if 0
    tcase_add_test(tc, elm_atspi_children_parent);
 #endif
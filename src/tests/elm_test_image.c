@@ -2,8 +2,11 @@
 # include "elementary_config.h"
 #endif
 
+#define ELM_INTERNAL_API_ARGESFSDFEFC
 #define ELM_INTERFACE_ATSPI_ACCESSIBLE_PROTECTED
 #include <Elementary.h>
+#include "elm_priv.h"
+#include "elm_widget_image.h"
 #include "elm_suite.h"
 
 static const char pathfmt[] =  ELM_IMAGE_DATA_DIR"/images/icon_%02d.png";
@@ -160,9 +163,114 @@ START_TEST (elm_image_async_mmap)
 }
 END_TEST
 
+static Eina_Bool
+_anim_quit_cb(void *data EINA_UNUSED)
+{
+   ecore_main_loop_quit();
+   return ECORE_CALLBACK_CANCEL;
+}
+
+START_TEST (elm_image_animated_scheduler)
+{
+   Evas_Object *win, *image;
+   unsigned int shown = 0, dropped = 0, hidden_shown;
+
+   elm_init(1, NULL);
+   win = elm_win_add(NULL, "image", ELM_WIN_BASIC);
+   evas_object_resize(win, 100, 100);
+   evas_object_show(win);
+
+   image = elm_image_add(win);
+   elm_image_preload_disabled_set(image, EINA_TRUE);
+   ck_assert(elm_image_file_set(image, ELM_IMAGE_DATA_DIR"/images/animated_logo.gif", NULL));
+   evas_object_resize(image, 100, 100);
+   evas_object_show(image);
+   ck_assert(elm_image_animated_available_get(image));
+
+   elm_image_animated_set(image, EINA_TRUE);
+   elm_image_animated_play_set(image, EINA_TRUE);
+   ecore_timer_add(1.0, _anim_quit_cb, NULL);
+   elm_run();
+
+   elm_image_animated_stats_get(image, &shown, &dropped);
+   ck_assert(shown > 0);
+
+   /* hidden images are not advanced */
+   evas_object_hide(image);
+   elm_image_animated_stats_get(image, &hidden_shown, NULL);
+   ecore_timer_add(0.5, _anim_quit_cb, NULL);
+   elm_run();
+   elm_image_animated_stats_get(image, &shown, NULL);
+   ck_assert(shown == hidden_shown);
+
+   /* and resume when shown again */
+   evas_object_show(image);
+   ecore_timer_add(1.0, _anim_quit_cb, NULL);
+   elm_run();
+   elm_image_animated_stats_get(image, &shown, NULL);
+   ck_assert(shown > hidden_shown);
+
+   elm_image_animated_play_set(image, EINA_FALSE);
+   elm_image_animated_stats_get(image, &hidden_shown, NULL);
+   ecore_timer_add(0.5, _anim_quit_cb, NULL);
+   elm_run();
+   elm_image_animated_stats_get(image, &shown, NULL);
+   ck_assert(shown == hidden_shown);
+
+   elm_shutdown();
+}
+END_TEST
+
+START_TEST (elm_image_animated_preload)
+{
+   Evas_Object *win, *image;
+   Elm_Image_Data *sd;
+   int i, next, after;
+
+   elm_init(1, NULL);
+   win = elm_win_add(NULL, "image", ELM_WIN_BASIC);
+   evas_object_resize(win, 100, 100);
+   evas_object_show(win);
+
+   image = elm_image_add(win);
+   elm_image_preload_disabled_set(image, EINA_TRUE);
+   ck_assert(elm_image_file_set(image, ELM_IMAGE_DATA_DIR"/images/animated_logo.gif", NULL));
+   evas_object_resize(image, 100, 100);
+   evas_object_show(image);
+
+   elm_image_animated_set(image, EINA_TRUE);
+   elm_image_animated_play_set(image, EINA_TRUE);
+   ecore_timer_add(0.5, _anim_quit_cb, NULL);
+   elm_run();
+
+   /* the frames following the shown one are in the ring */
+   sd = eo_data_scope_get(image, ELM_IMAGE_CLASS);
+   ck_assert(sd->frame_count > ELM_IMAGE_ANIM_PRELOAD_FRAMES);
+   next = (sd->cur_frame % sd->frame_count) + 1;
+   after = (next % sd->frame_count) + 1;
+   for (i = 0; i < ELM_IMAGE_ANIM_PRELOAD_FRAMES; i++)
+     {
+        ck_assert(sd->sched.ring[i] != NULL);
+        ck_assert(!evas_object_visible_get(sd->sched.ring[i]));
+        ck_assert((sd->sched.ring_frame[i] == next) ||
+                  (sd->sched.ring_frame[i] == after));
+     }
+   ck_assert(sd->sched.ring_frame[0] != sd->sched.ring_frame[1]);
+
+   /* and dropped once the animation stops */
+   elm_image_animated_play_set(image, EINA_FALSE);
+   for (i = 0; i < ELM_IMAGE_ANIM_PRELOAD_FRAMES; i++)
+     ck_assert(sd->sched.ring[i] == NULL);
+
+   elm_shutdown();
+}
+END_TEST
+
 void elm_test_image(TCase *tc)
 {
     tcase_add_test(tc, elm_atspi_role_get);
     tcase_add_test(tc, elm_image_async_path);
     tcase_add_test(tc, elm_image_async_mmap);
+    tcase_add_test(tc, elm_image_animated_scheduler);
+    tcase_add_test(tc, elm_image_animated_preload);
 }
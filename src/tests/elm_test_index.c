@@ -24,7 +24,40 @@ START_TEST (elm_atspi_role_get)
 }
 END_TEST
 
+START_TEST (elm_index_selected_item)
+{
+   Evas_Object *win, *idx;
+   Elm_Object_Item *it1, *it2;
+
+   elm_init(1, NULL);
+   win = elm_win_add(NULL, "index", ELM_WIN_BASIC);
+
+   idx = elm_index_add(win);
+   it1 = elm_index_item_append(idx, "A", NULL, NULL);
+   it2 = elm_index_item_append(idx, "B", NULL, NULL);
+   elm_index_level_go(idx, 0);
+
+   ck_assert(elm_index_selected_item_get(idx, 0) == NULL);
+
+   elm_index_item_selected_set(it1, EINA_TRUE);
+   ck_assert(elm_index_selected_item_get(idx, 0) == it1);
+
+   elm_index_item_selected_set(it2, EINA_TRUE);
+   ck_assert(elm_index_selected_item_get(idx, 0) == it2);
+
+   elm_index_item_selected_set(it2, EINA_FALSE);
+   ck_assert(elm_index_selected_item_get(idx, 0) == NULL);
+
+   elm_index_item_selected_set(it1, EINA_TRUE);
+   elm_object_item_del(it1);
+   ck_assert(elm_index_selected_item_get(idx, 0) == NULL);
+
+   elm_shutdown();
+}
+END_TEST
+
 void elm_test_index(TCase *tc)
 {
  tcase_add_test(tc, elm_atspi_role_get);
+ tcase_add_test(tc, elm_index_selected_item);
 }
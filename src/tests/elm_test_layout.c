@@ -2,8 +2,10 @@
 # include "elementary_config.h"
 #endif
 
+#define ELM_INTERNAL_API_ARGESFSDFEFC
 #define ELM_INTERFACE_ATSPI_ACCESSIBLE_PROTECTED
 #include <Elementary.h>
+#include "elm_priv.h"
 #include "elm_suite.h"
 
 
@@ -24,7 +26,51 @@ START_TEST (elm_atspi_role_get)
 }
 END_TEST
 
+static void
+_label_calc(Evas_Object *layout, const char *label)
+{
+   elm_object_text_set(layout, label);
+   edje_message_signal_process();
+   evas_smart_objects_calculate(evas_object_evas_get(layout));
+}
+
+START_TEST (elm_layout_size_memo)
+{
+   Evas_Object *win, *button;
+   unsigned int hits, misses, hits2, misses2, all;
+
+   elm_init(1, NULL);
+   win = elm_win_add(NULL, "layout", ELM_WIN_BASIC);
+
+   button = elm_button_add(win);
+   evas_object_show(button);
+   _label_calc(button, "a");
+   _label_calc(button, "bb");
+   _elm_layout_size_memo_stats_get(button, &hits, &misses);
+
+   /* a label toggling between two strings is answered from the memo */
+   _label_calc(button, "a");
+   _elm_layout_size_memo_stats_get(button, &hits2, &misses2);
+   ck_assert_int_eq(hits2, hits + 1);
+   ck_assert_int_eq(misses2, misses);
+
+   /* and pointer signals don't tell of any new state */
+   edje_object_signal_emit(elm_layout_edje_get(button), "mouse,in", "");
+   edje_object_signal_emit(elm_layout_edje_get(button), "mouse,move", "");
+   _label_calc(button, "bb");
+   _elm_layout_size_memo_stats_get(button, &hits, &misses);
+   ck_assert_int_eq(hits, hits2 + 1);
+   ck_assert_int_eq(misses, misses2);
+
+   _elm_layout_size_memo_stats_get(NULL, &all, NULL);
+   ck_assert(all >= hits);
+
+   elm_shutdown();
+}
+END_TEST
+
 void elm_test_layout(TCase *tc)
 {
  tcase_add_test(tc, elm_atspi_role_get);
+ tcase_add_test(tc, elm_layout_size_memo);
 }
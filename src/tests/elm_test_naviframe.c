@@ -24,7 +24,126 @@ START_TEST (elm_atspi_role_get)
 }
 END_TEST
 
+static Eina_Bool
+_content_build(void *data EINA_UNUSED, Elm_Object_Item *it EINA_UNUSED,
+               Evas_Object **content EINA_UNUSED)
+{
+   return EINA_TRUE;
+}
+
+START_TEST (elm_naviframe_deferred_push)
+{
+   Evas_Object *win, *naviframe, *placeholder;
+   Elm_Object_Item *it;
+   double first_frame, complete;
+
+   elm_init(1, NULL);
+   win = elm_win_add(NULL, "naviframe", ELM_WIN_BASIC);
+
+   naviframe = elm_naviframe_add(win);
+   placeholder = evas_object_rectangle_add(evas_object_evas_get(win));
+
+   it = elm_naviframe_item_deferred_push(naviframe, "title", NULL, NULL,
+                                         placeholder, NULL, NULL, NULL);
+   ck_assert(it == NULL);
+
+   it = elm_naviframe_item_deferred_push(naviframe, "title", NULL, NULL,
+                                         placeholder, _content_build, NULL,
+                                         NULL);
+   ck_assert(it != NULL);
+   ck_assert(elm_object_item_content_get(it) == placeholder);
+
+   // nothing is built before the first frame is rendered
+   elm_naviframe_item_build_times_get(it, &first_frame, &complete);
+   ck_assert(first_frame < 0.0);
+   ck_assert(complete < 0.0);
+
+   elm_naviframe_content_build_budget_set(naviframe, 0.005);
+   ck_assert(elm_naviframe_content_build_budget_get(naviframe) == 0.005);
+
+   elm_object_item_del(it);
+   ck_assert(elm_naviframe_top_item_get(naviframe) == NULL);
+
+   elm_shutdown();
+}
+END_TEST
+
+typedef struct
+{
+   Evas_Object *content;
+   int steps;
+   Eina_Bool built;
+} Build_Data;
+
+static Eina_Bool
+_content_build_steps(void *data, Elm_Object_Item *it,
+                     Evas_Object **content)
+{
+   Build_Data *bd = data;
+
+   if (!*content)
+     {
+        *content = evas_object_rectangle_add
+          (evas_object_evas_get(elm_object_item_widget_get(it)));
+        bd->content = *content;
+     }
+   return ++bd->steps == 3;
+}
+
+static void
+_content_built_cb(void *data, Evas_Object *obj EINA_UNUSED,
+                  void *event_info EINA_UNUSED)
+{
+   Build_Data *bd = data;
+
+   bd->built = EINA_TRUE;
+}
+
+START_TEST (elm_naviframe_deferred_push_build)
+{
+   Evas_Object *win, *naviframe, *placeholder;
+   Elm_Object_Item *it;
+   Build_Data bd = { NULL, 0, EINA_FALSE };
+   double first_frame, complete;
+
+   elm_init(1, NULL);
+   win = elm_win_add(NULL, "naviframe", ELM_WIN_BASIC);
+   evas_object_resize(win, 200, 200);
+
+   naviframe = elm_naviframe_add(win);
+   evas_object_size_hint_weight_set(naviframe, EVAS_HINT_EXPAND,
+                                    EVAS_HINT_EXPAND);
+   elm_win_resize_object_add(win, naviframe);
+   evas_object_smart_callback_add(naviframe, "content,built",
+                                  _content_built_cb, &bd);
+   evas_object_show(naviframe);
+   evas_object_show(win);
+
+   placeholder = evas_object_rectangle_add(evas_object_evas_get(win));
+   it = elm_naviframe_item_deferred_push(naviframe, "title", NULL, NULL,
+                                         placeholder, _content_build_steps,
+                                         &bd, NULL);
+   ck_assert(it != NULL);
+
+   ck_assert(elm_test_helper_wait_flag(10, &bd.built));
+
+   // the content took a step per call and replaced the placeholder
+   ck_assert_int_eq(bd.steps, 3);
+   ck_assert(bd.content != NULL);
+   ck_assert(elm_object_item_content_get(it) == bd.content);
+
+   // the placeholder went out on a frame before the content was done
+   elm_naviframe_item_build_times_get(it, &first_frame, &complete);
+   ck_assert(first_frame >= 0.0);
+   ck_assert(complete >= first_frame);
+
+   elm_shutdown();
+}
+END_TEST
+
 void elm_test_naviframe(TCase *tc)
 {
  tcase_add_test(tc, elm_atspi_role_get);
+ tcase_add_test(tc, elm_naviframe_deferred_push);
+ tcase_add_test(tc, elm_naviframe_deferred_push_build);
 }
@@ -2,10 +2,15 @@
 # include "elementary_config.h"
 #endif
 
+#define ELM_INTERNAL_API_ARGESFSDFEFC
 #define ELM_INTERFACE_ATSPI_ACCESSIBLE_PROTECTED
 #include <Elementary.h>
+#include "elm_priv.h"
+#include "elm_widget_prefs.h"
 #include "elm_suite.h"
 
+#define TEST_PREFS_FILE TESTS_BUILD_DIR "/elm_test_prefs.epb"
+
 
 START_TEST (elm_atspi_role_get)
 {
@@ -24,7 +29,245 @@ START_TEST (elm_atspi_role_get)
 }
 END_TEST
 
+static void
+_prefs_data_int_set(Elm_Prefs_Data *prefs_data, const char *path, int i)
+{
+   Eina_Value v;
+
+   eina_value_setup(&v, EINA_VALUE_TYPE_INT);
+   eina_value_set(&v, i);
+   ck_assert(elm_prefs_data_value_set(prefs_data, path, ELM_PREFS_TYPE_INT, &v));
+   eina_value_flush(&v);
+}
+
+static int
+_prefs_data_int_get(Elm_Prefs_Data *prefs_data, const char *path)
+{
+   Elm_Prefs_Item_Type type;
+   Eina_Value v;
+   int i = -1;
+
+   ck_assert(elm_prefs_data_value_get(prefs_data, path, &type, &v));
+   ck_assert(type == ELM_PREFS_TYPE_INT);
+   eina_value_get(&v, &i);
+   eina_value_flush(&v);
+
+   return i;
+}
+
+START_TEST (elm_prefs_data_save_modes)
+{
+   Elm_Prefs_Data *prefs_data;
+   Eina_Tmpstr *file;
+   char journal[PATH_MAX], bkp[PATH_MAX];
+   int fd;
+
+   elm_init(1, NULL);
+   fd = eina_file_mkstemp("elm_test_prefs_XXXXXX", &file);
+   ck_assert(fd >= 0);
+   close(fd);
+   snprintf(journal, sizeof(journal), "%s.journal", file);
+   snprintf(bkp, sizeof(bkp), "%s.bkp", file);
+
+   /* async: the last unref writes what's pending */
+   prefs_data = elm_prefs_data_new(file, NULL, EET_FILE_MODE_READ_WRITE);
+   elm_prefs_data_save_mode_set(prefs_data, ELM_PREFS_DATA_SAVE_MODE_ASYNC);
+   ck_assert(elm_prefs_data_save_mode_get(prefs_data) == ELM_PREFS_DATA_SAVE_MODE_ASYNC);
+   _prefs_data_int_set(prefs_data, "main:a", 1);
+   _prefs_data_int_set(prefs_data, "main:b", 2);
+   elm_prefs_data_unref(prefs_data);
+
+   prefs_data = elm_prefs_data_new(file, NULL, EET_FILE_MODE_READ_WRITE);
+   ck_assert_int_eq(_prefs_data_int_get(prefs_data, "main:a"), 1);
+   ck_assert_int_eq(_prefs_data_int_get(prefs_data, "main:b"), 2);
+
+   /* journal: changes after a full save only go to the journal */
+   elm_prefs_data_save_mode_set(prefs_data, ELM_PREFS_DATA_SAVE_MODE_JOURNAL);
+   ck_assert(elm_prefs_data_save(prefs_data, NULL, NULL));
+   ck_assert(!ecore_file_exists(journal));
+   _prefs_data_int_set(prefs_data, "main:a", 3);
+   _prefs_data_int_set(prefs_data, "main:c", 4);
+   elm_prefs_data_unref(prefs_data);
+   ck_assert(ecore_file_exists(journal));
+
+   prefs_data = elm_prefs_data_new(file, NULL, EET_FILE_MODE_READ);
+   ck_assert_int_eq(_prefs_data_int_get(prefs_data, "main:a"), 3);
+   ck_assert_int_eq(_prefs_data_int_get(prefs_data, "main:b"), 2);
+   ck_assert_int_eq(_prefs_data_int_get(prefs_data, "main:c"), 4);
+   elm_prefs_data_unref(prefs_data);
+
+   ecore_file_unlink(journal);
+   ecore_file_unlink(bkp);
+   ecore_file_unlink(file);
+   eina_tmpstr_del(file);
+   elm_shutdown();
+}
+END_TEST
+
+static Evas_Object *
+_prefs_add(Evas_Object *win)
+{
+   Evas_Object *prefs;
+
+   prefs = elm_prefs_add(win);
+   ck_assert(elm_prefs_file_set(prefs, TEST_PREFS_FILE, NULL));
+
+   return prefs;
+}
+
+static Elm_Prefs_Item_Node *
+_prefs_item_node_get(Evas_Object *prefs, const char *name)
+{
+   ELM_PREFS_DATA_GET(prefs, sd);
+
+   return eina_hash_find(sd->items, name);
+}
+
+static void
+_prefs_item_int_set(Evas_Object *prefs, const char *name, int i)
+{
+   Eina_Value v;
+
+   eina_value_setup(&v, EINA_VALUE_TYPE_INT);
+   eina_value_set(&v, i);
+   ck_assert(elm_prefs_item_value_set(prefs, name, &v));
+   eina_value_flush(&v);
+}
+
+static int
+_prefs_item_int_get(Evas_Object *prefs, const char *name)
+{
+   Eina_Value v;
+   int i = -1;
+
+   ck_assert(elm_prefs_item_value_get(prefs, name, &v));
+   eina_value_get(&v, &i);
+   eina_value_flush(&v);
+
+   return i;
+}
+
+START_TEST (elm_prefs_items_index)
+{
+   Evas_Object *win, *prefs;
+   Elm_Prefs_Item_Node *it;
+
+   elm_init(1, NULL);
+   win = elm_win_add(NULL, "prefs", ELM_WIN_BASIC);
+   prefs = _prefs_add(win);
+
+   /* every item of the tree is indexed by its full path, subpages
+    * included */
+   it = _prefs_item_node_get(prefs, "main:universe");
+   ck_assert(it != NULL);
+   ck_assert_str_eq(it->name, "universe");
+   it = _prefs_item_node_get(prefs, "main:options");
+   ck_assert(it != NULL);
+   ck_assert(it->subpage != NULL);
+   it = _prefs_item_node_get(prefs, "main:options:count");
+   ck_assert(it != NULL);
+   ck_assert_str_eq(it->page->name, "main:options");
+
+   ck_assert(_prefs_item_node_get(prefs, "main:count") == NULL);
+   ck_assert(elm_prefs_item_object_get(prefs, "main:nope") == NULL);
+
+   elm_shutdown();
+}
+END_TEST
+
+START_TEST (elm_prefs_page_lazy_build)
+{
+   Evas_Object *win, *prefs;
+   Elm_Prefs_Item_Node *it;
+
+   elm_init(1, NULL);
+   win = elm_win_add(NULL, "prefs", ELM_WIN_BASIC);
+
+   /* subpages get their widgets on the first access to one of their
+    * items */
+   prefs = _prefs_add(win);
+   it = _prefs_item_node_get(prefs, "main:options:count");
+   ck_assert(it->page->owner == _prefs_item_node_get(prefs, "main:options"));
+   ck_assert(_prefs_item_node_get(prefs, "main:universe")->page->built);
+   ck_assert(!it->page->built);
+   ck_assert(it->w_obj == NULL);
+
+   ck_assert(elm_prefs_item_object_get(prefs, "main:options:count") != NULL);
+   ck_assert(it->page->built);
+   ck_assert(it->w_obj != NULL);
+   ck_assert_int_eq(_prefs_item_int_get(prefs, "main:options:count"), 3);
+   evas_object_del(prefs);
+
+   /* ... or once the prefs widget is about to be seen */
+   prefs = _prefs_add(win);
+   it = _prefs_item_node_get(prefs, "main:options:count");
+   ck_assert(!it->page->built);
+   evas_object_show(prefs);
+   ck_assert(!it->page->built);
+   ecore_main_loop_iterate();
+   ck_assert(it->page->built);
+
+   elm_shutdown();
+}
+END_TEST
+
+START_TEST (elm_prefs_pending_values)
+{
+   Evas_Object *win, *prefs;
+   Elm_Prefs_Data *prefs_data;
+   Elm_Prefs_Item_Node *it;
+   Eina_Tmpstr *file;
+   char bkp[PATH_MAX];
+   int fd;
+
+   elm_init(1, NULL);
+   win = elm_win_add(NULL, "prefs", ELM_WIN_BASIC);
+
+   /* with no user data, the value waits on the item for its page */
+   prefs = _prefs_add(win);
+   it = _prefs_item_node_get(prefs, "main:options:count");
+   _prefs_item_int_set(prefs, "main:options:count", 9);
+   ck_assert(!it->page->built);
+   ck_assert(it->pending != NULL);
+
+   ck_assert_int_eq(_prefs_item_int_get(prefs, "main:options:count"), 9);
+   ck_assert(it->page->built);
+   ck_assert(it->pending == NULL);
+   evas_object_del(prefs);
+
+   /* with user data, the value is written through right away and the
+    * page picks it up from there */
+   fd = eina_file_mkstemp("elm_test_prefs_XXXXXX", &file);
+   ck_assert(fd >= 0);
+   close(fd);
+   snprintf(bkp, sizeof(bkp), "%s.bkp", file);
+
+   prefs_data = elm_prefs_data_new(file, NULL, EET_FILE_MODE_WRITE);
+   prefs = _prefs_add(win);
+   ck_assert(elm_prefs_data_set(prefs, prefs_data));
+   it = _prefs_item_node_get(prefs, "main:options:count");
+   _prefs_item_int_set(prefs, "main:options:count", 7);
+   ck_assert(!it->page->built);
+   ck_assert(it->pending == NULL);
+   ck_assert_int_eq(_prefs_data_int_get(prefs_data, "main:options:count"), 7);
+
+   ck_assert_int_eq(_prefs_item_int_get(prefs, "main:options:count"), 7);
+   ck_assert(it->page->built);
+   evas_object_del(prefs);
+   elm_prefs_data_unref(prefs_data);
+
+   ecore_file_unlink(bkp);
+   ecore_file_unlink(file);
+   eina_tmpstr_del(file);
+   elm_shutdown();
+}
+END_TEST
+
 void elm_test_prefs(TCase *tc)
 {
  tcase_add_test(tc, elm_atspi_role_get);
+ tcase_add_test(tc, elm_prefs_data_save_modes);
+ tcase_add_test(tc, elm_prefs_items_index);
+ tcase_add_test(tc, elm_prefs_page_lazy_build);
+ tcase_add_test(tc, elm_prefs_pending_values);
 }
@@ -24,7 +24,117 @@ START_TEST (elm_atspi_role_get)
 }
 END_TEST
 
+START_TEST (elm_scroller_predicted_pos)
+{
+   Evas_Object *win, *scroller, *rect;
+   Evas_Coord x = -1, y = -1;
+   Eina_Bool predict;
+
+   elm_init(1, NULL);
+   predict = elm_config_scroll_momentum_predict_get();
+   elm_config_scroll_momentum_predict_set(EINA_TRUE);
+   ck_assert(elm_config_scroll_momentum_predict_get() == EINA_TRUE);
+
+   win = elm_win_add(NULL, "scroller", ELM_WIN_BASIC);
+   scroller = elm_scroller_add(win);
+   rect = evas_object_rectangle_add(evas_object_evas_get(win));
+   evas_object_size_hint_min_set(rect, 1000, 1000);
+   elm_object_content_set(scroller, rect);
+   evas_object_resize(scroller, 100, 100);
+   evas_object_show(scroller);
+   evas_object_show(win);
+   evas_smart_objects_calculate(evas_object_evas_get(win));
+   elm_scroller_region_show(scroller, 0, 300, 100, 100);
+
+   /* no flick running, so the current position is all there is */
+   ck_assert(!elm_interface_scrollable_predicted_pos_get(scroller, &x, &y));
+   ck_assert_int_eq(y, 300);
+
+   elm_config_scroll_momentum_predict_set(predict);
+   elm_shutdown();
+}
+END_TEST
+
+typedef struct
+{
+   Evas_Coord y;
+   Eina_Bool valid;
+   Eina_Bool predicted;
+} Predicted_Data;
+
+static Eina_Bool
+_predicted_cb(void *data, const Eo_Event *event)
+{
+   Predicted_Data *pd = data;
+
+   pd->valid = elm_interface_scrollable_predicted_pos_get
+     (event->obj, NULL, &pd->y);
+   pd->predicted = EINA_TRUE;
+
+   return EO_CALLBACK_CONTINUE;
+}
+
+START_TEST (elm_scroller_predicted_flick)
+{
+   Evas_Object *win, *scroller, *rect;
+   Evas *e;
+   Predicted_Data pd = { -1, EINA_FALSE, EINA_FALSE };
+   Evas_Coord y = -1;
+   Eina_Bool predict, thumbscroll;
+   unsigned int ts = 1000;
+   int i;
+
+   elm_init(1, NULL);
+   predict = elm_config_scroll_momentum_predict_get();
+   thumbscroll = elm_config_scroll_thumbscroll_enabled_get();
+   elm_config_scroll_momentum_predict_set(EINA_TRUE);
+   elm_config_scroll_thumbscroll_enabled_set(EINA_TRUE);
+
+   win = elm_win_add(NULL, "scroller", ELM_WIN_BASIC);
+   e = evas_object_evas_get(win);
+   scroller = elm_scroller_add(win);
+   rect = evas_object_rectangle_add(e);
+   evas_object_size_hint_min_set(rect, 1000, 1000);
+   elm_object_content_set(scroller, rect);
+   evas_object_move(scroller, 0, 0);
+   evas_object_resize(scroller, 100, 100);
+   evas_object_resize(win, 100, 100);
+   evas_object_show(scroller);
+   evas_object_show(win);
+   evas_smart_objects_calculate(e);
+   elm_scroller_region_show(scroller, 0, 300, 100, 100);
+   eo_event_callback_add(scroller, ELM_INTERFACE_SCROLLABLE_EVENT_PREDICTED,
+                         _predicted_cb, &pd);
+
+   /* a steady upwards drag, 10 pixels every 10 ms, let go while still
+    * moving so the fit over the samples gives a flick */
+   evas_event_feed_mouse_move(e, 50, 90, ts, NULL);
+   evas_event_feed_mouse_down(e, 1, EVAS_BUTTON_NONE, ts, NULL);
+   for (i = 1; i <= 6; i++)
+     {
+        ts += 10;
+        evas_event_feed_mouse_move(e, 50, 90 - (i * 10), ts, NULL);
+     }
+   ts += 10;
+   evas_event_feed_mouse_up(e, 1, EVAS_BUTTON_NONE, ts, NULL);
+
+   ck_assert(elm_test_helper_wait_flag(10, &pd.predicted));
+
+   /* the flick carries on past where the finger left the content */
+   ck_assert(pd.valid);
+   ck_assert(pd.y > 300);
+   if (elm_interface_scrollable_predicted_pos_get(scroller, NULL, &y))
+     ck_assert(y >= pd.y);
+
+   elm_config_scroll_thumbscroll_enabled_set(thumbscroll);
+   elm_config_scroll_momentum_predict_set(predict);
+   elm_shutdown();
+}
+END_TEST
+
 void elm_test_scroller(TCase *tc)
 {
  tcase_add_test(tc, elm_atspi_role_get);
+ tcase_add_test(tc, elm_scroller_predicted_pos);
+ tcase_add_test(tc, elm_scroller_predicted_flick);
 }
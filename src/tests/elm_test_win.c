@@ -2,10 +2,12 @@
 # include "elementary_config.h"
 #endif
 
+#define ELM_INTERNAL_API_ARGESFSDFEFC
 #define ELM_INTERFACE_ATSPI_ACCESSIBLE_PROTECTED
 #define ELM_INTERFACE_ATSPI_COMPONENT_PROTECTED
 #include <Elementary.h>
 #include <Ecore_X.h>
+#include "elm_priv.h"
 #include "elm_suite.h"
 
 static const double _timeout1 = 0.01;
@@ -192,14 +194,148 @@ START_TEST (elm_win_autohide_and_policy_quit_last_window_hidden)
 }
 END_TEST
 
+static Eina_Bool
+_frame_stats_cb(void *data, const Eo_Event *event)
+{
+   unsigned int *frames = data;
+   const Elm_Win_Frame_Stats *fs = event->info;
+
+   ck_assert(fs->end >= fs->start);
+   (*frames)++;
+   return EO_CALLBACK_CONTINUE;
+}
+
+START_TEST (elm_win_frame_stats)
+{
+   Elm_Win_Frame_Stats stats[8];
+   unsigned int frames = 0, n, i;
+
+   elm_init(0, NULL);
+
+   Eo *win = elm_win_add(NULL, "win", ELM_WIN_BASIC);
+   ck_assert(elm_win_frame_stats_enabled_get(win) == EINA_FALSE);
+   ck_assert(elm_win_frame_stats_get(win, stats, 8) == 0);
+
+   elm_win_frame_stats_enabled_set(win, EINA_TRUE);
+   ck_assert(elm_win_frame_stats_enabled_get(win) == EINA_TRUE);
+   eo_event_callback_add(win, ELM_WIN_EVENT_FRAME_STATS, _frame_stats_cb, &frames);
+
+   evas_object_resize(win, 100, 100);
+   efl_gfx_visible_set(win, EINA_TRUE);
+   ecore_timer_add(_timeout2, _timer_exit_cb, NULL);
+   elm_run();
+
+   n = elm_win_frame_stats_get(win, stats, 8);
+   ck_assert(n == ((frames < 8) ? frames : 8));
+   for (i = 1; i < n; i++)
+     ck_assert(stats[i].frame == stats[i - 1].frame + 1);
+
+   elm_win_frame_stats_clear(win);
+   ck_assert(elm_win_frame_stats_get(win, stats, 8) == 0);
+
+   elm_win_frame_stats_enabled_set(win, EINA_FALSE);
+   ck_assert(elm_win_frame_stats_get(win, stats, 8) == 0);
+
+   elm_shutdown();
+}
+END_TEST
+
+static Eo *
+_focus_grid_button_add(Eo *parent, Evas_Coord x, Evas_Coord y)
+{
+   Eo *bt = elm_button_add(parent);
+
+   evas_object_move(bt, x, y);
+   evas_object_resize(bt, 50, 50);
+   evas_object_show(bt);
+
+   return bt;
+}
+
+static Eina_Bool
+_focus_grid_marked(Eo *obj, unsigned int stamp)
+{
+   Elm_Widget_Smart_Data *wd = eo_data_scope_get(obj, ELM_WIDGET_CLASS);
+
+   return wd->focus_grid.stamp == stamp;
+}
+
+START_TEST (elm_win_focus_grid)
+{
+   Eo *win, *win2, *left, *base, *near, *far, *below;
+   Elm_Widget_Smart_Data *wd;
+   unsigned int stamp;
+   double limit;
+
+   elm_init(0, NULL);
+
+   win = elm_win_add(NULL, "win", ELM_WIN_BASIC);
+   evas_object_resize(win, 1024, 512);
+
+   left = _focus_grid_button_add(win, 0, 0);
+   base = _focus_grid_button_add(win, 200, 0);
+   near = _focus_grid_button_add(win, 300, 0);
+   far = _focus_grid_button_add(win, 900, 0);
+   below = _focus_grid_button_add(win, 900, 400);
+
+   /* right: the walk stops once nothing farther can beat near */
+   stamp = _elm_win_focus_grid_query(win, base, 90.0, &limit);
+   ck_assert(stamp != 0);
+   ck_assert(_focus_grid_marked(near, stamp));
+   ck_assert(!_focus_grid_marked(left, stamp));
+   ck_assert(!_focus_grid_marked(far, stamp));
+   ck_assert(!_focus_grid_marked(below, stamp));
+   ck_assert(limit > 0.0);
+   ck_assert((int)(limit * 1000000) <
+             (int)(_elm_widget_focus_direction_weight_get(base, near, 90.0) *
+                   1000000));
+
+   /* without a limit, every widget in front of base is a candidate */
+   stamp = _elm_win_focus_grid_query(win, base, 90.0, NULL);
+   ck_assert(_focus_grid_marked(near, stamp));
+   ck_assert(_focus_grid_marked(far, stamp));
+   ck_assert(_focus_grid_marked(below, stamp));
+   ck_assert(!_focus_grid_marked(left, stamp));
+
+   /* left: the columns right of base are never walked */
+   stamp = _elm_win_focus_grid_query(win, base, 270.0, &limit);
+   ck_assert(_focus_grid_marked(left, stamp));
+   ck_assert(!_focus_grid_marked(near, stamp));
+   ck_assert(!_focus_grid_marked(far, stamp));
+
+   /* moved widgets are found at their new place */
+   stamp = _elm_win_focus_grid_query(win, base, 0.0, NULL);
+   ck_assert(_focus_grid_marked(near, stamp));
+   evas_object_move(near, 300, 400);
+   stamp = _elm_win_focus_grid_query(win, base, 0.0, NULL);
+   ck_assert(!_focus_grid_marked(near, stamp));
+   stamp = _elm_win_focus_grid_query(win, base, 180.0, NULL);
+   ck_assert(_focus_grid_marked(near, stamp));
+
+   /* a widget moved to another window leaves the first one's index */
+   win2 = elm_win_add(NULL, "win2", ELM_WIN_BASIC);
+   evas_object_resize(win2, 512, 512);
+   elm_widget_sub_object_add(win2, far);
+   evas_object_move(far, 100, 100);
+   wd = eo_data_scope_get(far, ELM_WIDGET_CLASS);
+   ck_assert(wd->focus_grid.win == win2);
+   stamp = _elm_win_focus_grid_query(win, base, 90.0, NULL);
+   ck_assert(!_focus_grid_marked(far, stamp));
+
+   elm_shutdown();
+}
+END_TEST
+
 void elm_test_win(TCase *tc)
 {
    tcase_add_test(tc, elm_atspi_role_get);
    tcase_add_test(tc, elm_atspi_component_position);
    tcase_add_test(tc, elm_atspi_component_size);
    tcase_add_test(tc, elm_win_policy_quit_last_window_hidden);
+   tcase_add_test(tc, elm_win_frame_stats);
 #ifdef HAVE_ELEMENTARY_X
    tcase_add_test(tc, elm_win_autohide);
    tcase_add_test(tc, elm_win_autohide_and_policy_quit_last_window_hidden);
 #endif
+   tcase_add_test(tc, elm_win_focus_grid);
 }